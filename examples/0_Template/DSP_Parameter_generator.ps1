@@ -67,6 +67,65 @@ function Find-OptionalFile ($pattern) {
     return $file
 }
 
+# CRC-32 (zlib flavor) of a byte array as a hex string, the same checksum dspCrc32 calculates
+function Get-Crc32 ($data) {
+    $crc = [uint32]4294967295
+    foreach ($byte in $data) {
+        $crc = [uint32]($crc -bxor [uint32]$byte)
+        for ($k = 0; $k -lt 8; $k++) {
+            if ($crc -band 1) { $crc = [uint32](($crc -shr 1) -bxor [uint32]3988292384) }
+            else { $crc = [uint32]($crc -shr 1) }
+        }
+    }
+    $crc = [uint32]($crc -bxor [uint32]4294967295)
+    return $crc.ToString("X8")
+}
+
+# Zero-run encodes a byte array, the format DSPRLEStream decodes.
+# Control byte 0x00-0x7F: 1-128 literal bytes follow, 0x80-0xFF: run of 1-128 zero bytes
+function ConvertTo-ZeroRun ($data) {
+    $encoded = New-Object System.Collections.Generic.List[byte]
+    $literal = New-Object System.Collections.Generic.List[byte]
+    $i = 0
+    while ($i -lt $data.Count) {
+        $j = $i
+        while ($j -lt $data.Count -and $data[$j] -eq 0 -and $j - $i -lt 128) { $j++ }
+
+        # A lone zero is cheaper to keep in the literal record it interrupts
+        if ($j - $i -ge 2 -or ($j -gt $i -and $literal.Count -eq 0)) {
+            if ($literal.Count -gt 0) {
+                $encoded.Add([byte]($literal.Count - 1))
+                $encoded.AddRange($literal)
+                $literal.Clear()
+            }
+            $encoded.Add([byte](128 + $j - $i - 1))
+            $i = $j
+        }
+        else {
+            $literal.Add([byte]$data[$i])
+            $i++
+            if ($literal.Count -eq 128) {
+                $encoded.Add([byte]127)
+                $encoded.AddRange($literal)
+                $literal.Clear()
+            }
+        }
+    }
+    if ($literal.Count -gt 0) {
+        $encoded.Add([byte]($literal.Count - 1))
+        $encoded.AddRange($literal)
+    }
+    return ,$encoded.ToArray()
+}
+
+# Formats a byte array as the body of a C array, 16 bytes per line
+function Format-ByteArray ($data) {
+    $lines = for ($i = 0; $i -lt $data.Count; $i += 16) {
+        ($data[$i..([Math]::Min($i + 15, $data.Count - 1))] | ForEach-Object { "0x" + $_.ToString("X2") + "," }) -join " "
+    }
+    return $lines -join $lf
+}
+
 $dspParamFile = Find-File "*_IC_1_PARAM.h"
 $dspParamContent = Get-Content $dspParamFile
 
@@ -93,10 +152,50 @@ if ($null -eq $eepromHexFile) {
 else {
     # Generate C style array out from passed hex file
     $arrayLen = $eepromHexContent.Split(",", [System.StringSplitOptions]::RemoveEmptyEntries).Count
+
+    # CRC-32 of the firmware, stored in the EEPROM footer by writeFirmware
+    $hexBytes = ($eepromHexContent -Join ",").Split(",") | Where-Object { $_.Trim() -ne "" }
+    $crcHex = Get-Crc32 ($hexBytes | ForEach-Object { [Convert]::ToByte($_.Trim(), 16) })
+
+    # Zero-run encoded copy. Pass it to writeFirmware through a DSPRLEStream
+    $eepromRle = ConvertTo-ZeroRun ($hexBytes | ForEach-Object { [Convert]::ToByte($_.Trim(), 16) })
+
+    # Find the write record of the parameter RAM, so the image can serve as DSPShadow defaults
+    $eepromBytes = $hexBytes | ForEach-Object { [Convert]::ToByte($_.Trim(), 16) }
+    $parameterDefines = ""
+    $i = 0
+    while ($i -lt $eepromBytes.Count) {
+        if ($eepromBytes[$i] -eq 1) {
+            $len = $eepromBytes[$i + 1] * 256 + $eepromBytes[$i + 2]
+            if ($eepromBytes[$i + 4] * 256 + $eepromBytes[$i + 5] -eq 0) {
+                $parameterDefines = "/* Parameter RAM content inside the image, e.g. for
+attachShadow(shadow, DSP_eeprom_firmware + EE_PARAMETER_OFFSET, EE_PARAMETER_SIZE) */
+#define EE_PARAMETER_OFFSET $($i + 6)
+#define EE_PARAMETER_SIZE $($len - 3)"
+                break
+            }
+            $i += 3 + $len
+        }
+        elseif ($eepromBytes[$i] -eq 2) { $i += 3 }
+        elseif ($eepromBytes[$i] -eq 3) { $i++ }
+        else { break }
+    }
+
     $hexContent = $eepromHexContent -Join $lf | Out-String
     $hexContent = "/* This array contains the entire DSP program,
     and should be loaded into the external i2c EEPROM */
-    const uint8_t PROGMEM DSP_eeprom_firmware[$arrayLen] = {`n$hexContent};"
+    #define EE_SIZE $arrayLen
+    #define EE_CRC32 ((uint32_t)0x$($crcHex)UL)
+$parameterDefines
+    const uint8_t PROGMEM DSP_eeprom_firmware[EE_SIZE] = {`n$hexContent};
+
+/* Zero-run encoded copy of DSP_eeprom_firmware[]. Load it with
+DSPRLEStream stream(DSP_eeprom_firmware_rle, EE_RLE_SIZE); ee.writeFirmware(stream, EE_SIZE); */
+#define EE_RLE_SIZE $($eepromRle.Count)
+const uint8_t PROGMEM DSP_eeprom_firmware_rle[EE_RLE_SIZE] =
+{
+$(Format-ByteArray $eepromRle)
+};"
 }
 
 # Extract relevant comments and macros
@@ -131,10 +230,25 @@ else {
 $dspProgramContentSlice = $dspProgramContent[26..($dspProgramContent.length - 2)]
 
 $dspProgramData = ""
+
+# With a self-boot image, loadProgram() replays DSP_eeprom_firmware[] and the plain arrays would be a second copy
+$emit = ($null -eq $eepromHexFile)
+if (-not $emit) {
+    $dspProgramData += "/* The program, parameter and register data is loaded from DSP_eeprom_firmware[] by loadProgram() */$lf"
+}
+$sectionData = @{ "r0" = @(); "program" = @(); "param" = @(); "hwconf" = @(); "r4" = @() }
+$section = ""
 foreach ($line in $dspProgramContentSlice) {
     $parts = $line.Split(" ", [System.StringSplitOptions]::RemoveEmptyEntries)
     $last = $parts[-1]
 
+    # Keep track of which array the data belongs to
+    if ($line -match "ADI_REG_TYPE Program_Data") { $section = "program" }
+    elseif ($line -match "ADI_REG_TYPE Param_Data") { $section = "param" }
+    elseif ($line -match "ADI_REG_TYPE R0_COREREGISTER") { $section = "r0" }
+    elseif ($line -match "ADI_REG_TYPE R3_HWCONFIGURATION") { $section = "hwconf" }
+    elseif ($line -match "ADI_REG_TYPE R4_COREREGISTER") { $section = "r4" }
+
     if ($line -match "/* DSP" -or $line -match "/* Register") {
         $dspProgramData += "$line$lf"
     }
@@ -148,7 +262,7 @@ foreach ($line in $dspProgramContentSlice) {
 #define PROGRAM_ADDR $last $lf#define PROGRAM_REGSIZE 5 $lf"
     }
 
-    if ($line -match "ADI_REG_TYPE Program_Data") {
+    if ($emit -and $line -match "ADI_REG_TYPE Program_Data") {
         $dspProgramData += "const uint8_t PROGMEM DSP_program_data[PROGRAM_SIZE] = $lf{" 
     }
 
@@ -160,7 +274,7 @@ foreach ($line in $dspProgramContentSlice) {
         $dspProgramData += "#define PARAMETER_ADDR $last $lf#define PARAMETER_REGSIZE 4$lf"
     }
 
-    if ($line -match "ADI_REG_TYPE Param_Data") {
+    if ($emit -and $line -match "ADI_REG_TYPE Param_Data") {
         $dspProgramData += "const uint8_t PROGMEM DSP_parameter_data[PARAMETER_SIZE] = $lf{" 
     }
 
@@ -168,7 +282,7 @@ foreach ($line in $dspProgramContentSlice) {
         $dspProgramData += "#define CORE_REGISTER_R0_SIZE 2$lf"
         $dspProgramData += "#define CORE_REGISTER_R0_ADDR 0x081C$lf"
         $dspProgramData += "#define CORE_REGISTER_R0_REGSIZE 2$lf"
-        $dspProgramData += "const uint8_t PROGMEM DSP_core_register_R0_data[CORE_REGISTER_R0_SIZE] = $lf{$lf"        
+        if ($emit) { $dspProgramData += "const uint8_t PROGMEM DSP_core_register_R0_data[CORE_REGISTER_R0_SIZE] = $lf{$lf" }
     }
 
     if ($line -match "#define R3_HWCONFIGURATION_IC_1_SIZE") {
@@ -177,7 +291,7 @@ foreach ($line in $dspProgramContentSlice) {
         $dspProgramData += "#define HARDWARE_CONF_REGSIZE 1$lf$lf"
     }
 
-    if ($line -match "ADI_REG_TYPE R3_HWCONFIGURATION") {
+    if ($emit -and $line -match "ADI_REG_TYPE R3_HWCONFIGURATION") {
         $dspProgramData += "const uint8_t PROGMEM DSP_hardware_conf_data[HARDWARE_CONF_SIZE] = $lf{"
     }
 
@@ -185,22 +299,71 @@ foreach ($line in $dspProgramContentSlice) {
         $dspProgramData += "#define CORE_REGISTER_R4_SIZE 2$lf"
         $dspProgramData += "#define CORE_REGISTER_R4_ADDR 0x081C$lf"
         $dspProgramData += "#define CORE_REGISTER_R4_REGSIZE 2$lf"
-        $dspProgramData += "const uint8_t PROGMEM DSP_core_register_R4_data[CORE_REGISTER_R4_SIZE] = $lf{$lf"        
+        if ($emit) { $dspProgramData += "const uint8_t PROGMEM DSP_core_register_R4_data[CORE_REGISTER_R4_SIZE] = $lf{$lf" }
     }
 
 
     if ($line.StartsWith("0x")) {
-        $dspProgramData += $line
+        if ($emit) { $dspProgramData += $line }
+        if ($section -ne "") {
+            $sectionData[$section] += $line.Split(",") | Where-Object { $_.Trim() -ne "" } | ForEach-Object { [Convert]::ToByte($_.Trim(), 16) }
+        }
     }
 
-    if ($line.StartsWith("};")) {
+    if ($emit -and $line.StartsWith("};")) {
         $dspProgramData += "};$lf$lf"
     }
 
 
 }
 
+# Zero-run encoded copy of all arrays, in the order the stream version of loadProgram reads them
+$firmwareRle = ConvertTo-ZeroRun ($sectionData["r0"] + $sectionData["program"] + $sectionData["param"] + $sectionData["hwconf"] + $sectionData["r4"])
+$dspProgramData += "/* CRC-32 of the program RAM content. Pass it to verifyProgram() to check if the DSP already runs this program */
+#define PROGRAM_CRC32 0x$(Get-Crc32 $sectionData["program"])UL
+
+/* Zero-run encoded copy of the R0, program, parameter, hardware configuration
+and R4 data. Use loadCompressedProgram() to load it */
+#define DSP_FIRMWARE_RLE_SIZE $($firmwareRle.Count)
+const uint8_t PROGMEM DSP_firmware_rle[DSP_FIRMWARE_RLE_SIZE] =
+{
+$(Format-ByteArray $firmwareRle)
+};$lf"
+
 $date = get-date -Format "dd.MM.yyyy HH.mm.ss"
+# Replay the self-boot image if there is one, so only one copy of the program ends up in flash
+if ($null -eq $eepromHexFile) {
+    $loadProgram = "/**
+ * @brief Function to load DSP firmware from the microcontroller flash memory
+ * 
+ * @param myDSP SigmaDSP object
+ */
+inline void loadProgram(SigmaDSP &myDSP)
+{
+  DSPStatsScope scope(myDSP.getStats(), StatsLoadProgram);
+  myDSP.writeRegister(CORE_REGISTER_R0_ADDR, CORE_REGISTER_R0_SIZE, DSP_core_register_R0_data);
+  myDSP.writeRegisterBlock(PROGRAM_ADDR, PROGRAM_SIZE, DSP_program_data, PROGRAM_REGSIZE);
+  myDSP.writeRegisterBlock(PARAMETER_ADDR, PARAMETER_SIZE, DSP_parameter_data, PARAMETER_REGSIZE);
+  myDSP.writeRegister(HARDWARE_CONF_ADDR, HARDWARE_CONF_SIZE, DSP_hardware_conf_data);
+  myDSP.writeRegister(CORE_REGISTER_R4_ADDR, CORE_REGISTER_R4_SIZE, DSP_core_register_R4_data);
+}"
+}
+else {
+    $loadProgram = "/**
+ * @brief Function to load DSP firmware from the microcontroller flash memory
+ *        by replaying the self-boot image. RAM the image doesn't cover is filled first,
+ *        so the DSP ends up as if the full program and parameter arrays were loaded
+ * 
+ * @param myDSP SigmaDSP object
+ * @param ramCleared Set to true right after a DSP reset to skip zeroing the unused parameter RAM
+ */
+inline void loadProgram(SigmaDSP &myDSP, bool ramCleared = false)
+{
+  DSPStatsScope scope(myDSP.getStats(), StatsLoadProgram);
+  myDSP.loadSelfbootImage(DSP_eeprom_firmware, EE_SIZE, ramCleared);
+}"
+}
+
 $output = "#ifndef SIGMADSP_PARAMETERS_H
 #define SIGMADSP_PARAMETERS_H
 
@@ -258,18 +421,41 @@ $hexContent
 
 $dspProgramData
 
+$loadProgram
+
 /**
- * @brief Function to load DSP firmware from the microcontroller flash memory
- * 
+ * @brief Function to load DSP firmware from a stream (Serial, a file etc.)
+ *        instead of the microcontroller flash memory. The stream must hold the
+ *        core register R0, program, parameter, hardware configuration and core
+ *        register R4 data back to back, in that order
+ *
  * @param myDSP SigmaDSP object
+ * @param stream Stream to read the firmware from
+ * @param ramCleared Set to true right after a DSP reset to skip all-zero RAM registers
+ * @return true if the whole firmware was read from the stream
  */
-inline void loadProgram(SigmaDSP &myDSP)
+inline bool loadProgram(SigmaDSP &myDSP, Stream &stream, bool ramCleared = false)
 {
-  myDSP.writeRegister(CORE_REGISTER_R0_ADDR, CORE_REGISTER_R0_SIZE, DSP_core_register_R0_data);
-  myDSP.writeRegisterBlock(PROGRAM_ADDR, PROGRAM_SIZE, DSP_program_data, PROGRAM_REGSIZE);
-  myDSP.writeRegisterBlock(PARAMETER_ADDR, PARAMETER_SIZE, DSP_parameter_data, PARAMETER_REGSIZE);
-  myDSP.writeRegister(HARDWARE_CONF_ADDR, HARDWARE_CONF_SIZE, DSP_hardware_conf_data);
-  myDSP.writeRegister(CORE_REGISTER_R4_ADDR, CORE_REGISTER_R4_SIZE, DSP_core_register_R4_data);
+  DSPStatsScope scope(myDSP.getStats(), StatsLoadProgram);
+  return myDSP.writeRegisterBlock(CORE_REGISTER_R0_ADDR, CORE_REGISTER_R0_SIZE, stream, CORE_REGISTER_R0_SIZE)
+      && myDSP.writeRegisterBlock(PROGRAM_ADDR, PROGRAM_SIZE, stream, PROGRAM_REGSIZE, ramCleared)
+      && myDSP.writeRegisterBlock(PARAMETER_ADDR, PARAMETER_SIZE, stream, PARAMETER_REGSIZE, ramCleared)
+      && myDSP.writeRegisterBlock(HARDWARE_CONF_ADDR, HARDWARE_CONF_SIZE, stream, HARDWARE_CONF_SIZE)
+      && myDSP.writeRegisterBlock(CORE_REGISTER_R4_ADDR, CORE_REGISTER_R4_SIZE, stream, CORE_REGISTER_R4_SIZE);
+}
+
+/**
+ * @brief Function to load DSP firmware from the zero-run encoded DSP_firmware_rle[]
+ *        array. It takes up a fraction of the flash the plain arrays need
+ *
+ * @param myDSP SigmaDSP object
+ * @param ramCleared Set to true right after a DSP reset to skip all-zero RAM registers
+ * @return true if the whole firmware was loaded
+ */
+inline bool loadCompressedProgram(SigmaDSP &myDSP, bool ramCleared = false)
+{
+  DSPRLEStream stream(DSP_firmware_rle, DSP_FIRMWARE_RLE_SIZE);
+  return loadProgram(myDSP, stream, ramCleared);
 }
 #endif
 "
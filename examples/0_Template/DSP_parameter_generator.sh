@@ -85,6 +85,119 @@ fi
 
 
 
+# Awk functions shared by the array generators below
+AWK_FUNCTIONS='
+# Converts a "0x.." string into a number
+function hex2dec(h,    v, k)
+{
+  h = tolower(h)
+  gsub(/[^0-9a-fx]/, "", h)
+  sub(/^0x/, "", h)
+  v = 0
+  for(k = 1; k <= length(h); k++)
+    v = v * 16 + index("0123456789abcdef", substr(h, k, 1)) - 1
+  return v
+}
+
+# Bitwise xor of two 32-bit numbers, as plain awk has no bitwise operators
+function xor32(a, b,    r, bit, k)
+{
+  r = 0
+  bit = 1
+  for(k = 0; k < 32; k++)
+  {
+    if(int(a / bit) % 2 != int(b / bit) % 2)
+      r += bit
+    bit *= 2
+  }
+  return r
+}
+
+# CRC-32 (zlib flavor) of data[1..n], the same checksum dspCrc32 calculates
+function crc32(data, n,    crc, c, i, k)
+{
+  # Lookup table for the reflected 0x04C11DB7 polynomial
+  if(!(255 in crcTable))
+  {
+    for(i = 0; i < 256; i++)
+    {
+      c = i
+      for(k = 0; k < 8; k++)
+        c = (c % 2) ? xor32(int(c / 2), 3988292384) : int(c / 2)
+      crcTable[i] = c
+    }
+  }
+
+  crc = 4294967295
+  for(i = 1; i <= n; i++)
+    crc = xor32(crcTable[xor32(crc % 256, data[i])], int(crc / 256))
+  return 4294967295 - crc
+}
+
+# Formats a CRC-32 as a C unsigned long literal
+function crc32_hex(crc)
+{
+  return sprintf("0x%04X%04XUL", int(crc / 65536), crc % 65536)
+}
+
+# Appends one byte to the encoded output, 16 bytes per line
+function rle_byte(v)
+{
+  rle_size++
+  return sprintf("0x%02X,%s", v, (rle_size % 16) ? " " : "\n")
+}
+
+# Appends a literal record holding count bytes of data[], starting at first
+function rle_literal(data, first, count,    out, k)
+{
+  if(count == 0)
+    return ""
+  out = rle_byte(count - 1)
+  for(k = first; k < first + count; k++)
+    out = out rle_byte(data[k])
+  return out
+}
+
+# Zero-run encodes data[1..n], the format DSPRLEStream decodes.
+# Control byte 0x00-0x7F: 1-128 literal bytes follow, 0x80-0xFF: run of 1-128 zero bytes.
+# The encoded size ends up in rle_size
+function rle_encode(data, n,    out, i, j, lit)
+{
+  rle_size = 0
+  out = ""
+  lit = 0
+  i = 1
+  while(i <= n)
+  {
+    j = i
+    while(j <= n && data[j] == 0 && j - i < 128)
+      j++
+
+    # A lone zero is cheaper to keep in the literal record it interrupts
+    if(j - i >= 2 || (j > i && lit == 0))
+    {
+      out = out rle_literal(data, i - lit, lit)
+      lit = 0
+      out = out rle_byte(128 + j - i - 1)
+      i = j
+    }
+    else
+    {
+      lit++
+      i++
+      if(lit == 128)
+      {
+        out = out rle_literal(data, i - lit, lit)
+        lit = 0
+      }
+    }
+  }
+  return out rle_literal(data, i - lit, lit)
+}
+'
+
+
+
 # Choose the DSP macros we need in order to control the program modules
 echo -e "\x1B[0m"
 echo -e "Building header..."
@@ -197,7 +310,7 @@ then
   echo -e "\x1B[0mExtract and format EEPROM array from"
   echo -e "\x1B[1m$EEPROM_HEXFILE"
   echo -e "\x1B[31m"
-  awk '
+  awk "$AWK_FUNCTIONS"'
   BEGIN {
     FS=" * , *"
     RS="^$"
@@ -205,17 +318,52 @@ then
   }
 
   {
-    printf("#define EE_SIZE " NF-1 "\n\n")
+    # CRC-32 of the firmware, stored in the EEPROM footer by writeFirmware
+    for(i = 1; i < NF; i++)
+      firmware[i] = hex2dec($i)
+    crc = crc32(firmware, NF - 1)
+
+    printf("#define EE_SIZE " NF-1 "\n")
+    printf("#define EE_CRC32 ((uint32_t)%s)\n\n", crc32_hex(crc))
+
+    # Find the write record of the parameter RAM, so the image can serve as DSPShadow defaults
+    for(i = 1; i < NF; )
+    {
+      if(firmware[i] == 1)
+      {
+        len = firmware[i + 1] * 256 + firmware[i + 2]
+        if(firmware[i + 4] * 256 + firmware[i + 5] == 0)
+        {
+          printf("/* Parameter RAM content inside the image, e.g. for\n")
+          printf("attachShadow(shadow, DSP_eeprom_firmware + EE_PARAMETER_OFFSET, EE_PARAMETER_SIZE) */\n")
+          printf("#define EE_PARAMETER_OFFSET %d\n", i + 5)
+          printf("#define EE_PARAMETER_SIZE %d\n\n", len - 3)
+          break
+        }
+        i += 3 + len
+      }
+      else if(firmware[i] == 2)
+        i += 3
+      else if(firmware[i] == 3)
+        i++
+      else
+        break
+    }
+
     printf("const uint8_t PROGMEM DSP_eeprom_firmware[EE_SIZE] =\n{\n")
     for(i = 1; i < NF; i++)
     {
       sub("\r","") # Get rid of all CR characters from the input file
       printf("%s", $i ", ")
     }
-  }
-
-  END {
     printf("\n};")
+
+    # Zero-run encoded copy. Pass it to writeFirmware through a DSPRLEStream
+    rle = rle_encode(firmware, NF - 1)
+    printf("\n\n/* Zero-run encoded copy of DSP_eeprom_firmware[]. Load it with\n")
+    printf("DSPRLEStream stream(DSP_eeprom_firmware_rle, EE_RLE_SIZE); ee.writeFirmware(stream, EE_SIZE); */\n")
+    printf("#define EE_RLE_SIZE %d\n\n", rle_size)
+    printf("const uint8_t PROGMEM DSP_eeprom_firmware_rle[EE_RLE_SIZE] =\n{\n%s\n};", rle)
   }' "$EEPROM_HEXFILE" >> "$(dirname "$0")/SigmaDSP_parameters.h"
 fi
 
@@ -225,10 +373,15 @@ fi
 echo -e "\x1B[0mExtract and format arrays from:"
 echo -e "\x1B[1m$DSP_PROGRAM_FILE"
 echo -e "\x1B[31m"
-awk '
+awk -v selfboot="$EEPROM_HEXFILE" "$AWK_FUNCTIONS"'
 BEGIN {
   printf("\n\n")
   j = 1
+
+  # With a self-boot image, loadProgram() replays DSP_eeprom_firmware[] and the plain arrays would be a second copy
+  emit = (selfboot == "")
+  if (!emit)
+    printf("/* The program, parameter and register data is loaded from DSP_eeprom_firmware[] by loadProgram() */\n")
 }
 
 {
@@ -249,7 +402,7 @@ BEGIN {
       printf("#define PROGRAM_REGSIZE 5\n\n")
     }
 
-    if ($1 == "ADI_REG_TYPE" && $2 ~ "Program_Data.")
+    if (emit && $1 == "ADI_REG_TYPE" && $2 ~ "Program_Data.")
       printf("const uint8_t PROGMEM DSP_program_data[PROGRAM_SIZE] = \n{\n")
 
     if ($2 == "PARAM_SIZE_IC_1")
@@ -261,7 +414,7 @@ BEGIN {
       printf("#define PARAMETER_REGSIZE 4\n\n")
     }
 
-    if ($1 == "ADI_REG_TYPE" && $2 ~ "Param_Data.")
+    if (emit && $1 == "ADI_REG_TYPE" && $2 ~ "Param_Data.")
       printf("const uint8_t PROGMEM DSP_parameter_data[PARAMETER_SIZE] = \n{\n")
 
     if ($1 == "ADI_REG_TYPE" && $2 ~ "R0_COREREGISTER.")
@@ -269,7 +422,8 @@ BEGIN {
       printf("#define CORE_REGISTER_R0_SIZE 2\n")
       printf("#define CORE_REGISTER_R0_ADDR 0x081C\n")
       printf("#define CORE_REGISTER_R0_REGSIZE 2\n\n")
-      printf("const uint8_t PROGMEM DSP_core_register_R0_data[CORE_REGISTER_R0_SIZE] = \n{\n")
+      if (emit)
+        printf("const uint8_t PROGMEM DSP_core_register_R0_data[CORE_REGISTER_R0_SIZE] = \n{\n")
     }
 
     if ($2 == "R3_HWCONFIGURATION_IC_1_SIZE")
@@ -279,7 +433,7 @@ BEGIN {
       printf("#define HARDWARE_CONF_REGSIZE 1\n\n")
     }
 
-    if ($1 == "ADI_REG_TYPE" && $2 ~ "R3_HWCONFIGURATION.")
+    if (emit && $1 == "ADI_REG_TYPE" && $2 ~ "R3_HWCONFIGURATION.")
       printf("const uint8_t PROGMEM DSP_hardware_conf_data[HARDWARE_CONF_SIZE] = \n{\n")
 
     if ($1 == "ADI_REG_TYPE" && $2 ~ "R4_COREREGISTER.")
@@ -287,15 +441,26 @@ BEGIN {
       printf("#define CORE_REGISTER_R4_SIZE 2\n")
       printf("#define CORE_REGISTER_R4_ADDR 0x081C\n")
       printf("#define CORE_REGISTER_R4_REGSIZE 2\n\n")
-      printf("const uint8_t PROGMEM DSP_core_register_R4_data[CORE_REGISTER_R4_SIZE] = \n{\n")
+      if (emit)
+        printf("const uint8_t PROGMEM DSP_core_register_R4_data[CORE_REGISTER_R4_SIZE] = \n{\n")
     }
 
+    # Keep track of which array the data belongs to
+    if ($1 == "ADI_REG_TYPE")
+      section = ($2 ~ "Program_Data.") ? "program" : ($2 ~ "Param_Data.") ? "param" : ($2 ~ "R0_COREREGISTER.") ? "r0" : ($2 ~ "R3_HWCONFIGURATION.") ? "hwconf" : ($2 ~ "R4_COREREGISTER.") ? "r4" : ""
+
     # Print out all lines that thats with 0x
     if ($1 ~ "0x.")
-      printf($0)
+    {
+      if (emit)
+        printf($0)
+      for (k = 1; k <= NF; k++)
+        if ($k ~ "0x.")
+          sectionData[section, ++sectionSize[section]] = hex2dec($k)
+    }
 
     # Print out all end brackets
-    if ($1 ~ "}.")
+    if (emit && $1 ~ "}.")
       printf("%s\n\n", $0)
 
     # Escape
@@ -305,19 +470,88 @@ BEGIN {
 }
 
 END {
+  # Zero-run encoded copy of all arrays, in the order the stream version of loadProgram reads them
+  n = 0
+  split("r0 program param hwconf r4", order, " ")
+  for (s = 1; s <= 5; s++)
+    for (k = 1; k <= sectionSize[order[s]]; k++)
+      firmware[++n] = sectionData[order[s], k]
+  for (k = 1; k <= sectionSize["program"]; k++)
+    programData[k] = sectionData["program", k]
+  rle = rle_encode(firmware, n)
+
+  # Checksum of the program, for verifyProgram() to tell if the DSP already runs it
+  printf("/* CRC-32 of the program RAM content. Pass it to verifyProgram() to check if the DSP already runs this program */\n")
+  printf("#define PROGRAM_CRC32 %s\n\n", crc32_hex(crc32(programData, sectionSize["program"])))
+
+  printf("/* Zero-run encoded copy of the R0, program, parameter, hardware configuration\n")
+  printf("and R4 data. Use loadCompressedProgram() to load it */\n")
+  printf("#define DSP_FIRMWARE_RLE_SIZE %d\n\n", rle_size)
+  printf("const uint8_t PROGMEM DSP_firmware_rle[DSP_FIRMWARE_RLE_SIZE] =\n{\n%s\n};\n\n", rle)
+
   printf("\n")
   printf("/**\n")
   printf("* @brief Function to load DSP firmware from the microcontroller flash memory\n")
+  if(selfboot != "")
+  {
+    printf("*        by replaying the self-boot image. RAM the image doesn\x27t cover is filled first,\n")
+    printf("*        so the DSP ends up as if the full program and parameter arrays were loaded\n")
+  }
   printf("*\n")
   printf("* @param myDSP SigmaDSP object\n")
+  if(selfboot != "")
+    printf("* @param ramCleared Set to true right after a DSP reset to skip zeroing the unused parameter RAM\n")
   printf("*/\n")
-  printf("inline void loadProgram(SigmaDSP &myDSP)\n")
+  if(selfboot != "")
+    printf("inline void loadProgram(SigmaDSP &myDSP, bool ramCleared = false)\n")
+  else
+    printf("inline void loadProgram(SigmaDSP &myDSP)\n")
+  printf("{\n")
+  printf("  DSPStatsScope scope(myDSP.getStats(), StatsLoadProgram);\n")
+  # Replay the self-boot image if there is one, so only one copy of the program ends up in flash
+  if(selfboot != "")
+    printf("  myDSP.loadSelfbootImage(DSP_eeprom_firmware, EE_SIZE, ramCleared);\n")
+  else
+  {
+    printf("  myDSP.writeRegister(CORE_REGISTER_R0_ADDR, CORE_REGISTER_R0_SIZE, DSP_core_register_R0_data);\n")
+    printf("  myDSP.writeRegisterBlock(PROGRAM_ADDR, PROGRAM_SIZE, DSP_program_data, PROGRAM_REGSIZE);\n")
+    printf("  myDSP.writeRegisterBlock(PARAMETER_ADDR, PARAMETER_SIZE, DSP_parameter_data, PARAMETER_REGSIZE);\n")
+    printf("  myDSP.writeRegister(HARDWARE_CONF_ADDR, HARDWARE_CONF_SIZE, DSP_hardware_conf_data);\n")
+    printf("  myDSP.writeRegister(CORE_REGISTER_R4_ADDR, CORE_REGISTER_R4_SIZE, DSP_core_register_R4_data);\n")
+  }
+  printf("}\n\n")
+  printf("/**\n")
+  printf(" * @brief Function to load DSP firmware from a stream (Serial, a file etc.)\n")
+  printf(" *        instead of the microcontroller flash memory. The stream must hold the\n")
+  printf(" *        core register R0, program, parameter, hardware configuration and core\n")
+  printf(" *        register R4 data back to back, in that order\n")
+  printf(" *\n")
+  printf(" * @param myDSP SigmaDSP object\n")
+  printf(" * @param stream Stream to read the firmware from\n")
+  printf(" * @param ramCleared Set to true right after a DSP reset to skip all-zero RAM registers\n")
+  printf(" * @return true if the whole firmware was read from the stream\n")
+  printf(" */\n")
+  printf("inline bool loadProgram(SigmaDSP &myDSP, Stream &stream, bool ramCleared = false)\n")
+  printf("{\n")
+  printf("  DSPStatsScope scope(myDSP.getStats(), StatsLoadProgram);\n")
+  printf("  return myDSP.writeRegisterBlock(CORE_REGISTER_R0_ADDR, CORE_REGISTER_R0_SIZE, stream, CORE_REGISTER_R0_SIZE)\n")
+  printf("      && myDSP.writeRegisterBlock(PROGRAM_ADDR, PROGRAM_SIZE, stream, PROGRAM_REGSIZE, ramCleared)\n")
+  printf("      && myDSP.writeRegisterBlock(PARAMETER_ADDR, PARAMETER_SIZE, stream, PARAMETER_REGSIZE, ramCleared)\n")
+  printf("      && myDSP.writeRegisterBlock(HARDWARE_CONF_ADDR, HARDWARE_CONF_SIZE, stream, HARDWARE_CONF_SIZE)\n")
+  printf("      && myDSP.writeRegisterBlock(CORE_REGISTER_R4_ADDR, CORE_REGISTER_R4_SIZE, stream, CORE_REGISTER_R4_SIZE);\n")
+  printf("}\n\n")
+  printf("/**\n")
+  printf(" * @brief Function to load DSP firmware from the zero-run encoded DSP_firmware_rle[]\n")
+  printf(" *        array. It takes up a fraction of the flash the plain arrays need\n")
+  printf(" *\n")
+  printf(" * @param myDSP SigmaDSP object\n")
+  printf(" * @param ramCleared Set to true right after a DSP reset to skip all-zero RAM registers\n")
+  printf(" * @return true if the whole firmware was loaded\n")
+  printf(" */\n")
+  printf("inline bool loadCompressedProgram(SigmaDSP &myDSP, bool ramCleared = false)\n")
   printf("{\n")
-  printf("  myDSP.writeRegister(CORE_REGISTER_R0_ADDR, CORE_REGISTER_R0_SIZE, DSP_core_register_R0_data);\n")
-  printf("  myDSP.writeRegisterBlock(PROGRAM_ADDR, PROGRAM_SIZE, DSP_program_data, PROGRAM_REGSIZE);\n")
-  printf("  myDSP.writeRegisterBlock(PARAMETER_ADDR, PARAMETER_SIZE, DSP_parameter_data, PARAMETER_REGSIZE);\n")
-  printf("  myDSP.writeRegister(HARDWARE_CONF_ADDR, HARDWARE_CONF_SIZE, DSP_hardware_conf_data);\n")
-  printf("  myDSP.writeRegister(CORE_REGISTER_R4_ADDR, CORE_REGISTER_R4_SIZE, DSP_core_register_R4_data);\n")
+  printf("  DSPRLEStream stream(DSP_firmware_rle, DSP_FIRMWARE_RLE_SIZE);\n")
+  printf("  return loadProgram(myDSP, stream, ramCleared);\n")
   printf("}\n\n")
   printf("#endif\n")
 }' "$DSP_PROGRAM_FILE" >> "$(dirname "$0")/SigmaDSP_parameters.h"
@@ -48,7 +48,8 @@ void setup()
   dsp.begin();
   //ee.begin();
 
-  delay(2000);
+  // Wait for the DSP to start up and answer on the bus
+  dsp.waitForBoot(2000, BootIdle);
 
 
   Serial.println(F("Pinging i2c lines...\n0 -> deveice is present\n2 -> device is not present"));
@@ -59,16 +60,22 @@ void setup()
 
 
   // Use this step if no EEPROM is present
+  // The program isn't reloaded if the DSP still runs it, e.g. when only the microcontroller was reset
   Serial.print(F("\nLoading DSP program... "));
-  loadProgram(dsp);
-  Serial.println("Done!\n");
+  if(dsp.verifyProgram(PROGRAM_CRC32, PROGRAM_SIZE))
+    Serial.println(F("Already running!\n"));
+  else
+  {
+    loadProgram(dsp);
+    Serial.println("Done!\n");
+  }
 
 
-  // Comment out the three code lines above and use this step instead if EEPROM is present
+  // Comment out the code lines above and use this step instead if EEPROM is present
   // The last parameter in writeFirmware is the FW version, and prevents the MCU from overwriting on every reboot
-  //ee.writeFirmware(DSP_eeprom_firmware, sizeof(DSP_eeprom_firmware), 0);
+  //ee.writeFirmware(DSP_eeprom_firmware, EE_SIZE, EE_CRC32, 0);
   //dsp.reset();
-  //delay(2000); // Wait for the FW to load from the EEPROM
+  //dsp.waitForBoot(2000); // Wait for the FW to load from the EEPROM
 
 
   // Initilize EQ band 1
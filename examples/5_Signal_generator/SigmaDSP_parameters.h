@@ -4,20 +4,21 @@
 #include <SigmaDSP.h>
 
 /****************************************************************************
-| File name: SigmaDSP_parameters.h                                          |
+| Filename: SigmaDSP_parameters.h                                           |
 | Generation tool: AWK + bash                                               |
-| Date and time: 12.08.2018 17:18:39                                        |
+| Date and time: 18.10.2026 03:53:36                                        |
+| Generated from: 5_Signal_generator.dspproj                                |
 |                                                                           |
 | ADAU1701 parameter and program file header                                |
-| SigmaDSP library and its content is developed and maintained by MCUdude.  |
+| SigmaDSP library and its content are developed and maintained by MCUdude. |
 | https://github.com/MCUdude/SigmaDSP                                       |
 |                                                                           |
 | Huge thanks to the Aida DSP team who have reverse engineered a lot of the |
-| Sigma DSP algorithms and made them open source and available to everyone. |
+| Sigma DSP algorithms and made them open-source and available to everyone. |
 | This library would never have existed if it wasn't for the Aida DSP team  |
 | and their incredible work.                                                |
 |                                                                           |
-| This file have been generated with the Sigmastudio_parameter_generator.sh |
+| This file has been generated with the Sigmastudio_parameter_generator.sh  |
 | script. This file contains all the DSP function block parameters and      |
 | addresses. It also contains the program that will be loaded to the        |
 | external EEPROM.                                                          |
@@ -26,11 +27,14 @@
 | module takes.                                                             |
 |                                                                           |
 | The *_ADDR macro holds the current address for the module. Use this macro |
-| when changing the behaviour of the modules (EQs, volume etc.).            |
+| when changing the behavior of the modules (EQs, volume, etc.).            |
 |                                                                           |
 | The *_FIXFT macros holds the default value of the module. Use this when   |
 | restoring the default parameters.                                         |
 |                                                                           |
+| The *_VALUES macros holds the address of what module to read from if      |
+| you are using the readout blocks.                                         |
+|                                                                           |
 | The DSP_eeprom_firmware[] array contains the DSP firmware, and can be     |
 | loaded using the writeFirmware method in the DSPEEPROM class.             |
 | When stored in the external i2c EEPROM, the firmware is automatically     |
@@ -44,11 +48,10 @@
 
 /* 7-bit i2c addresses */
 #define DSP_I2C_ADDRESS (0x68 >> 1) & 0xFE
-#define EEPROM_I2C_ADDRESS (0xa0 >> 1) & 0xFE
-
+#define EEPROM_I2C_ADDRESS (0xA0 >> 1) & 0xFE
 
 /* Module Sawtooth - Sawtooth wave*/
-#define MOD_SAWTOOTH_COUNT                             2
+#define MOD_SAWTOOTH_COUNT 2
 
 #define MOD_SAWTOOTH_ALG0_FREQ_ADDR                    1
 #define MOD_SAWTOOTH_ALG0_FREQ_FIXPT                   0x00012C5F
@@ -58,7 +61,7 @@
 
 
 /* Module Sine - Sine Tone*/
-#define MOD_SINE_COUNT                                 3
+#define MOD_SINE_COUNT 3
 
 #define MOD_STATIC_SINE_ALG0_MASK_ADDR                 3
 #define MOD_STATIC_SINE_ALG0_MASK_FIXPT                0x000000FF
@@ -71,7 +74,7 @@
 
 
 /* Module Square - Square wave*/
-#define MOD_SQUARE_COUNT                               3
+#define MOD_SQUARE_COUNT 3
 
 #define MOD_STATIC_SQUARE_ALG0_MASK_ADDR               6
 #define MOD_STATIC_SQUARE_ALG0_MASK_FIXPT              0x000000FF
@@ -84,7 +87,7 @@
 
 
 /* Module Triangle - Triangle wave*/
-#define MOD_TRIANGLE_COUNT                             7
+#define MOD_TRIANGLE_COUNT 7
 
 #define MOD_TRIANGLE_ALG0_TRI0_ADDR                    9
 #define MOD_TRIANGLE_ALG0_TRI0_FIXPT                   0x00000000
@@ -109,7 +112,7 @@
 
 
 /* Module Gen1stOrder1 - General (1st order)*/
-#define MOD_GEN1STORDER1_COUNT                         3
+#define MOD_GEN1STORDER1_COUNT 3
 
 #define MOD_GEN1STORDER1_ALG0_PARAMB00_ADDR            16
 #define MOD_GEN1STORDER1_ALG0_PARAMB00_FIXPT           0x0076E845
@@ -122,28 +125,28 @@
 
 
 /* Module Waveform_select - Mono Switch Nx1*/
-#define MOD_WAVEFORM_SELECT_COUNT                      1
+#define MOD_WAVEFORM_SELECT_COUNT 1
 
 #define MOD_WAVEFORM_SELECT_MONOSWSLEW_ADDR            19
 #define MOD_WAVEFORM_SELECT_MONOSWSLEW_FIXPT           0x00000000
 
 
 /* Module Waveform_gain - Linear Gain*/
-#define MOD_WAVEFORM_GAIN_COUNT                        1
+#define MOD_WAVEFORM_GAIN_COUNT 1
 
 #define MOD_WAVEFORM_GAIN_GAIN1940ALGNS1_ADDR          20
 #define MOD_WAVEFORM_GAIN_GAIN1940ALGNS1_FIXPT         0x00199999
 
 
 /* Module Source_select - Stereo Switch Nx2*/
-#define MOD_SOURCE_SELECT_COUNT                        1
+#define MOD_SOURCE_SELECT_COUNT 1
 
 #define MOD_SOURCE_SELECT_STEREOSWSLEW_ADDR            21
 #define MOD_SOURCE_SELECT_STEREOSWSLEW_FIXPT           0x00000000
 
 
 /* Module SW vol 1 - Single SW slew vol (adjustable)*/
-#define MOD_SWVOL1_COUNT                               2
+#define MOD_SWVOL1_COUNT 2
 
 #define MOD_SWVOL1_ALG0_TARGET_ADDR                    22
 #define MOD_SWVOL1_ALG0_TARGET_FIXPT                   0x00800000
@@ -155,197 +158,296 @@
 
 /* This array contains the entire DSP program,
 and should be loaded into the external i2c EEPROM */
+
 #define EE_SIZE 1472
+#define EE_CRC32 ((uint32_t)0x39EFF426UL)
+
+/* Parameter RAM content inside the image, e.g. for
+attachShadow(shadow, DSP_eeprom_firmware + EE_PARAMETER_OFFSET, EE_PARAMETER_SIZE) */
+#define EE_PARAMETER_OFFSET 70
+#define EE_PARAMETER_SIZE 96
 
 const uint8_t PROGMEM DSP_eeprom_firmware[EE_SIZE] =
 {
-0x01, 0x00, 0x05, 0x00, 0x08, 0x1C, 0x00, 0x58,
-0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-0x03, 0x03, 0x01, 0x00, 0x23, 0x00, 0x08, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x01, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x01, 0x2C, 0x60, 0x00, 0x80,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x02,
-0x58, 0xBF, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xFF, 0x00, 0x02, 0x58, 0xBF, 0x00, 0x80,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02,
-0x58, 0xBF, 0x00, 0x80, 0x00, 0x00, 0x00, 0x76,
-0xE8, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-0x80, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
-0x99, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x04,
-0x86, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x01, 0x00, 0x00, 0x00, 0xE8, 0x01, 0x00, 0x00,
-0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0xE8, 0x01,
-0x00, 0x29, 0x1F, 0x20, 0x01, 0x00, 0x19, 0x08,
-0x22, 0x01, 0x00, 0x02, 0x01, 0xA0, 0x01, 0xFF,
-0xE1, 0x1F, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x01, 0x00, 0x20, 0x00, 0xEA, 0x01, 0x00, 0x30,
-0x00, 0xF2, 0x01, 0x00, 0x31, 0x07, 0x20, 0x41,
-0xFF, 0xF1, 0x08, 0x22, 0x01, 0x00, 0x38, 0x00,
-0xE2, 0x01, 0x00, 0x3A, 0x02, 0x20, 0x01, 0x00,
-0x10, 0x00, 0xE2, 0x01, 0x00, 0x59, 0x1F, 0x20,
-0x01, 0x00, 0x49, 0x08, 0x22, 0x01, 0x00, 0x02,
-0x04, 0xA0, 0x01, 0xFF, 0xE1, 0x18, 0x22, 0x01,
-0x00, 0x02, 0x03, 0xA0, 0x01, 0x00, 0x50, 0x00,
-0xEA, 0x01, 0x00, 0x60, 0x00, 0xF2, 0x01, 0x00,
-0x50, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x01, 0xFF, 0xF0, 0x01, 0x21, 0x01, 0x00, 0x00,
-0x00, 0xA1, 0x01, 0xFF, 0xE1, 0x08, 0x22, 0x41,
-0x00, 0x68, 0x00, 0xE2, 0x01, 0x00, 0x60, 0x00,
-0xC0, 0x01, 0x00, 0x6F, 0xFF, 0x20, 0x01, 0xFF,
-0xE1, 0x08, 0x22, 0x01, 0x00, 0x38, 0x00, 0xE2,
-0x01, 0x00, 0x3A, 0x05, 0x20, 0x01, 0x00, 0x40,
-0x00, 0xE2, 0x01, 0x00, 0x89, 0x1F, 0x20, 0x01,
-0x00, 0x79, 0x08, 0x22, 0x01, 0x00, 0x02, 0x07,
-0xA0, 0x01, 0xFF, 0xE1, 0x18, 0x22, 0x01, 0x00,
-0x02, 0x06, 0xA0, 0x01, 0x00, 0x80, 0x00, 0xEA,
-0x01, 0x00, 0x90, 0x00, 0xF2, 0x01, 0x00, 0x80,
-0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x01, 0xA1, 0x01, 0xFF, 0xE1, 0x08,
-0x20, 0x01, 0x00, 0x00, 0x00, 0xA1, 0x01, 0xFF,
-0xE1, 0x08, 0x22, 0x41, 0x00, 0x98, 0x00, 0xE2,
-0x01, 0x00, 0x90, 0x00, 0xC0, 0x01, 0x00, 0x9F,
-0xFF, 0x20, 0x01, 0xFF, 0xE1, 0x08, 0x22, 0x09,
-0xFF, 0xF1, 0x08, 0x20, 0x01, 0xFF, 0xF1, 0x08,
-0x20, 0x67, 0x00, 0x38, 0x00, 0xE2, 0x01, 0x00,
-0x3A, 0x08, 0x20, 0x01, 0x00, 0xD8, 0x00, 0xE2,
-0x01, 0x00, 0xB9, 0x1F, 0x20, 0x01, 0x00, 0xA9,
-0x08, 0x22, 0x01, 0x00, 0x02, 0x0E, 0xA0, 0x01,
-0xFF, 0xE1, 0x1E, 0x22, 0x01, 0x00, 0x02, 0x0D,
-0xA0, 0x01, 0x00, 0xB0, 0x00, 0xEA, 0x01, 0x00,
-0xC0, 0x00, 0xF2, 0x01, 0x00, 0xB0, 0x00, 0xC0,
-0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02,
-0x0A, 0xA1, 0x01, 0xFF, 0xE1, 0x08, 0x20, 0x01,
-0x00, 0x02, 0x09, 0xA1, 0x01, 0xFF, 0xE1, 0x08,
-0x22, 0x41, 0x00, 0xC8, 0x00, 0xE2, 0x01, 0x00,
-0xC0, 0x00, 0xC0, 0x01, 0x00, 0xCF, 0xFF, 0x20,
-0x01, 0xFF, 0xE1, 0x08, 0x22, 0x01, 0x00, 0x38,
-0x00, 0xE2, 0x01, 0x00, 0x3A, 0x0F, 0x20, 0x01,
-0x00, 0xA0, 0x00, 0xE2, 0x01, 0x00, 0xF2, 0x12,
-0x20, 0x01, 0x00, 0xE2, 0x12, 0x34, 0x01, 0x00,
-0xDA, 0x10, 0x22, 0x01, 0x00, 0xD2, 0x11, 0x22,
-0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xE8,
-0x00, 0xE2, 0x01, 0x00, 0xF8, 0x00, 0xF2, 0x01,
-0xFF, 0xF2, 0x13, 0x20, 0x01, 0x01, 0x30, 0x00,
-0xE2, 0x01, 0x00, 0x41, 0x08, 0x20, 0x01, 0x01,
-0x08, 0x00, 0xE2, 0x01, 0x00, 0xA1, 0x08, 0x20,
-0x01, 0x01, 0x10, 0x00, 0xE2, 0x01, 0x00, 0x11,
-0x08, 0x20, 0x01, 0x01, 0x18, 0x00, 0xE2, 0x01,
-0x00, 0xE9, 0x08, 0x20, 0x01, 0x01, 0x20, 0x00,
-0xE2, 0x01, 0xFF, 0xE9, 0x08, 0x20, 0x01, 0x01,
-0x88, 0x00, 0xE2, 0x01, 0x01, 0x29, 0x08, 0x20,
-0x01, 0x01, 0x31, 0x08, 0x22, 0x49, 0xFF, 0xF1,
-0x08, 0x20, 0x26, 0x01, 0x88, 0x00, 0xE2, 0x01,
-0x01, 0x49, 0x08, 0x20, 0x01, 0xFF, 0xF1, 0x13,
-0x22, 0x49, 0x01, 0x29, 0x08, 0x20, 0x01, 0x01,
-0x69, 0x08, 0x20, 0x25, 0x01, 0x70, 0x00, 0xE2,
-0x01, 0x01, 0x59, 0x08, 0x20, 0x01, 0xFF, 0xF1,
-0x13, 0x22, 0x49, 0x01, 0x29, 0x08, 0x20, 0x01,
-0x01, 0x79, 0x08, 0x20, 0x25, 0x01, 0x80, 0x00,
-0xE2, 0x01, 0x01, 0x91, 0x08, 0x20, 0x01, 0x00,
-0x00, 0x00, 0x00, 0x01, 0x01, 0xA0, 0x00, 0xF0,
-0x01, 0x01, 0xA1, 0x08, 0x20, 0x01, 0xFF, 0xF1,
-0x13, 0x22, 0x49, 0x01, 0x89, 0x08, 0x20, 0x01,
-0xFF, 0xE9, 0x08, 0x20, 0x25, 0x01, 0x88, 0x00,
-0xE2, 0x01, 0x01, 0x29, 0x08, 0x20, 0x01, 0x01,
-0x30, 0x00, 0xE2, 0x25, 0x01, 0x39, 0x08, 0x20,
-0x01, 0x01, 0x49, 0x08, 0x22, 0x41, 0x01, 0x98,
-0x00, 0xE2, 0x01, 0x01, 0x49, 0x08, 0x20, 0x01,
-0x01, 0x99, 0x14, 0x22, 0x01, 0x01, 0x50, 0x00,
-0xE2, 0x01, 0x01, 0x70, 0x00, 0xC0, 0x01, 0x00,
-0x07, 0xFF, 0xA0, 0x01, 0x01, 0x50, 0x00, 0xC0,
-0x01, 0x01, 0x0F, 0xFF, 0x20, 0x81, 0x01, 0x00,
-0x00, 0xE2, 0x01, 0xFF, 0xF1, 0x08, 0x20, 0x01,
-0xFF, 0xF7, 0xFF, 0x22, 0x41, 0x01, 0x60, 0x00,
-0xE2, 0x01, 0x01, 0x80, 0x00, 0xC0, 0x01, 0x00,
-0x07, 0xFF, 0xA0, 0x01, 0x01, 0x60, 0x00, 0xC0,
-0x01, 0x01, 0x0F, 0xFF, 0x20, 0x81, 0x01, 0x01,
-0x08, 0x22, 0x01, 0x01, 0x00, 0x00, 0xE2, 0x01,
-0x01, 0x39, 0x08, 0x20, 0x01, 0x01, 0x89, 0x08,
-0x22, 0x41, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-0x40, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x01, 0x01, 0x02, 0x14, 0x20, 0x01, 0x01, 0xA8,
-0x00, 0xE2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
-0xFF, 0xF2, 0x15, 0x20, 0x01, 0x01, 0xE8, 0x00,
-0xE2, 0x01, 0x01, 0xA9, 0x08, 0x20, 0x01, 0x01,
-0xC0, 0x00, 0xE2, 0x01, 0x01, 0xA9, 0x08, 0x20,
-0x01, 0x01, 0xD0, 0x00, 0xE2, 0x01, 0x00, 0x01,
-0x08, 0x20, 0x01, 0x01, 0xC8, 0x00, 0xE2, 0x01,
-0x00, 0x09, 0x08, 0x20, 0x01, 0x01, 0xD8, 0x00,
-0xE2, 0x01, 0xFF, 0xE9, 0x08, 0x20, 0x01, 0x02,
-0x40, 0x00, 0xE2, 0x01, 0x01, 0xE1, 0x08, 0x20,
-0x01, 0x01, 0xE9, 0x08, 0x22, 0x49, 0xFF, 0xF1,
-0x08, 0x20, 0x26, 0x02, 0x40, 0x00, 0xE2, 0x01,
-0x02, 0x01, 0x08, 0x20, 0x01, 0xFF, 0xF1, 0x13,
-0x22, 0x49, 0x01, 0xE1, 0x08, 0x20, 0x01, 0x02,
-0x21, 0x08, 0x20, 0x25, 0x02, 0x28, 0x00, 0xE2,
-0x01, 0x02, 0x11, 0x08, 0x20, 0x01, 0xFF, 0xF1,
-0x13, 0x22, 0x49, 0x01, 0xE1, 0x08, 0x20, 0x01,
-0x02, 0x31, 0x08, 0x20, 0x25, 0x02, 0x38, 0x00,
-0xE2, 0x01, 0x02, 0x49, 0x08, 0x20, 0x01, 0x00,
-0x00, 0x00, 0x00, 0x01, 0x02, 0x58, 0x00, 0xF0,
-0x01, 0x02, 0x59, 0x08, 0x20, 0x01, 0xFF, 0xF1,
-0x13, 0x22, 0x49, 0x02, 0x41, 0x08, 0x20, 0x01,
-0xFF, 0xE9, 0x08, 0x20, 0x25, 0x02, 0x40, 0x00,
-0xE2, 0x01, 0x01, 0xE1, 0x08, 0x20, 0x01, 0x01,
-0xE8, 0x00, 0xE2, 0x25, 0x01, 0xF1, 0x08, 0x20,
-0x01, 0x02, 0x01, 0x08, 0x22, 0x41, 0x02, 0x50,
-0x00, 0xE2, 0x01, 0x02, 0x01, 0x08, 0x20, 0x01,
-0x02, 0x51, 0x14, 0x22, 0x01, 0x02, 0x08, 0x00,
-0xE2, 0x01, 0x02, 0x28, 0x00, 0xC0, 0x01, 0x00,
-0x07, 0xFF, 0xA0, 0x01, 0x02, 0x08, 0x00, 0xC0,
-0x01, 0x01, 0xC7, 0xFF, 0x20, 0x81, 0x01, 0xB0,
-0x00, 0xE2, 0x01, 0x01, 0xD7, 0xFF, 0x40, 0x81,
-0x01, 0xB8, 0x00, 0xE4, 0x01, 0xFF, 0xF1, 0x08,
-0x20, 0x01, 0xFF, 0xF7, 0xFF, 0x22, 0x41, 0x02,
-0x18, 0x00, 0xE2, 0x01, 0x02, 0x38, 0x00, 0xC0,
-0x01, 0x00, 0x07, 0xFF, 0xA0, 0x01, 0x02, 0x18,
-0x00, 0xC0, 0x01, 0x01, 0xC7, 0xFF, 0x20, 0x81,
-0x01, 0xB1, 0x08, 0x22, 0x01, 0x01, 0xB0, 0x00,
-0xE2, 0x01, 0x01, 0xD7, 0xFF, 0x40, 0x81, 0x01,
-0xB9, 0x08, 0x44, 0x01, 0x01, 0xB8, 0x00, 0xE4,
-0x01, 0x01, 0xF1, 0x08, 0x20, 0x01, 0x02, 0x41,
-0x08, 0x22, 0x41, 0x00, 0x00, 0x00, 0x00, 0x01,
-0x01, 0xF8, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00,
-0x00, 0x01, 0xFF, 0xF2, 0x16, 0x20, 0x01, 0x02,
-0x71, 0x08, 0x22, 0x41, 0x02, 0x90, 0x00, 0xE2,
-0x01, 0x02, 0x81, 0x08, 0x20, 0x01, 0x02, 0x71,
-0x08, 0x34, 0x01, 0x02, 0x92, 0x17, 0x22, 0x01,
-0x02, 0x78, 0x00, 0xE2, 0x01, 0x02, 0x78, 0x00,
-0xC0, 0x01, 0x02, 0x88, 0x00, 0xF2, 0x01, 0x01,
-0xB7, 0xFF, 0x20, 0x01, 0x02, 0x60, 0x00, 0xE2,
-0x01, 0x01, 0xBF, 0xFF, 0x20, 0x01, 0x02, 0x68,
-0x00, 0xE2, 0x01, 0x02, 0x61, 0x08, 0x20, 0x01,
-0xFF, 0x68, 0x00, 0x02, 0x01, 0x02, 0x69, 0x08,
-0x20, 0x01, 0xFF, 0x70, 0x00, 0x02, 0x01, 0x01,
-0x00, 0x05, 0x00, 0x08, 0x1C, 0x00, 0x1C, 0x01,
-0x00, 0x04, 0x00, 0x08, 0x1D, 0x08, 0x01, 0x00,
-0x05, 0x00, 0x08, 0x1E, 0x00, 0x00, 0x01, 0x00,
-0x04, 0x00, 0x08, 0x1F, 0x00, 0x01, 0x00, 0x06,
-0x00, 0x08, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00,
-0x06, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x05, 0x00, 0x08, 0x22, 0x00, 0x00, 0x01,
-0x00, 0x05, 0x00, 0x08, 0x23, 0x00, 0x00, 0x01,
-0x00, 0x05, 0x00, 0x08, 0x24, 0x80, 0x00, 0x01,
-0x00, 0x05, 0x00, 0x08, 0x25, 0x00, 0x00, 0x01,
-0x00, 0x05, 0x00, 0x08, 0x26, 0x00, 0x00, 0x01,
-0x00, 0x05, 0x00, 0x08, 0x27, 0x00, 0x01, 0x01,
-0x00, 0x05, 0x00, 0x08, 0x1C, 0x00, 0x1C, 0x06,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x05, 0x00, 0x08, 0x1C, 0x00, 0x58, 
+0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+0x03, 0x03, 0x01, 0x00, 0x23, 0x00, 0x08, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0x2C, 0x60, 0x00, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x02, 
+0x58, 0xBF, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0xFF, 0x00, 0x02, 0x58, 0xBF, 0x00, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 
+0x58, 0xBF, 0x00, 0x80, 0x00, 0x00, 0x00, 0x76, 
+0xE8, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 
+0x80, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 
+0x99, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
+0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x04, 
+0x86, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 0xE8, 0x01, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0xE8, 0x01, 
+0x00, 0x29, 0x1F, 0x20, 0x01, 0x00, 0x19, 0x08, 
+0x22, 0x01, 0x00, 0x02, 0x01, 0xA0, 0x01, 0xFF, 
+0xE1, 0x1F, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x20, 0x00, 0xEA, 0x01, 0x00, 0x30, 
+0x00, 0xF2, 0x01, 0x00, 0x31, 0x07, 0x20, 0x41, 
+0xFF, 0xF1, 0x08, 0x22, 0x01, 0x00, 0x38, 0x00, 
+0xE2, 0x01, 0x00, 0x3A, 0x02, 0x20, 0x01, 0x00, 
+0x10, 0x00, 0xE2, 0x01, 0x00, 0x59, 0x1F, 0x20, 
+0x01, 0x00, 0x49, 0x08, 0x22, 0x01, 0x00, 0x02, 
+0x04, 0xA0, 0x01, 0xFF, 0xE1, 0x18, 0x22, 0x01, 
+0x00, 0x02, 0x03, 0xA0, 0x01, 0x00, 0x50, 0x00, 
+0xEA, 0x01, 0x00, 0x60, 0x00, 0xF2, 0x01, 0x00, 
+0x50, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0xFF, 0xF0, 0x01, 0x21, 0x01, 0x00, 0x00, 
+0x00, 0xA1, 0x01, 0xFF, 0xE1, 0x08, 0x22, 0x41, 
+0x00, 0x68, 0x00, 0xE2, 0x01, 0x00, 0x60, 0x00, 
+0xC0, 0x01, 0x00, 0x6F, 0xFF, 0x20, 0x01, 0xFF, 
+0xE1, 0x08, 0x22, 0x01, 0x00, 0x38, 0x00, 0xE2, 
+0x01, 0x00, 0x3A, 0x05, 0x20, 0x01, 0x00, 0x40, 
+0x00, 0xE2, 0x01, 0x00, 0x89, 0x1F, 0x20, 0x01, 
+0x00, 0x79, 0x08, 0x22, 0x01, 0x00, 0x02, 0x07, 
+0xA0, 0x01, 0xFF, 0xE1, 0x18, 0x22, 0x01, 0x00, 
+0x02, 0x06, 0xA0, 0x01, 0x00, 0x80, 0x00, 0xEA, 
+0x01, 0x00, 0x90, 0x00, 0xF2, 0x01, 0x00, 0x80, 
+0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0x00, 0x00, 0x01, 0xA1, 0x01, 0xFF, 0xE1, 0x08, 
+0x20, 0x01, 0x00, 0x00, 0x00, 0xA1, 0x01, 0xFF, 
+0xE1, 0x08, 0x22, 0x41, 0x00, 0x98, 0x00, 0xE2, 
+0x01, 0x00, 0x90, 0x00, 0xC0, 0x01, 0x00, 0x9F, 
+0xFF, 0x20, 0x01, 0xFF, 0xE1, 0x08, 0x22, 0x09, 
+0xFF, 0xF1, 0x08, 0x20, 0x01, 0xFF, 0xF1, 0x08, 
+0x20, 0x67, 0x00, 0x38, 0x00, 0xE2, 0x01, 0x00, 
+0x3A, 0x08, 0x20, 0x01, 0x00, 0xD8, 0x00, 0xE2, 
+0x01, 0x00, 0xB9, 0x1F, 0x20, 0x01, 0x00, 0xA9, 
+0x08, 0x22, 0x01, 0x00, 0x02, 0x0E, 0xA0, 0x01, 
+0xFF, 0xE1, 0x1E, 0x22, 0x01, 0x00, 0x02, 0x0D, 
+0xA0, 0x01, 0x00, 0xB0, 0x00, 0xEA, 0x01, 0x00, 
+0xC0, 0x00, 0xF2, 0x01, 0x00, 0xB0, 0x00, 0xC0, 
+0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 
+0x0A, 0xA1, 0x01, 0xFF, 0xE1, 0x08, 0x20, 0x01, 
+0x00, 0x02, 0x09, 0xA1, 0x01, 0xFF, 0xE1, 0x08, 
+0x22, 0x41, 0x00, 0xC8, 0x00, 0xE2, 0x01, 0x00, 
+0xC0, 0x00, 0xC0, 0x01, 0x00, 0xCF, 0xFF, 0x20, 
+0x01, 0xFF, 0xE1, 0x08, 0x22, 0x01, 0x00, 0x38, 
+0x00, 0xE2, 0x01, 0x00, 0x3A, 0x0F, 0x20, 0x01, 
+0x00, 0xA0, 0x00, 0xE2, 0x01, 0x00, 0xF2, 0x12, 
+0x20, 0x01, 0x00, 0xE2, 0x12, 0x34, 0x01, 0x00, 
+0xDA, 0x10, 0x22, 0x01, 0x00, 0xD2, 0x11, 0x22, 
+0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xE8, 
+0x00, 0xE2, 0x01, 0x00, 0xF8, 0x00, 0xF2, 0x01, 
+0xFF, 0xF2, 0x13, 0x20, 0x01, 0x01, 0x30, 0x00, 
+0xE2, 0x01, 0x00, 0x41, 0x08, 0x20, 0x01, 0x01, 
+0x08, 0x00, 0xE2, 0x01, 0x00, 0xA1, 0x08, 0x20, 
+0x01, 0x01, 0x10, 0x00, 0xE2, 0x01, 0x00, 0x11, 
+0x08, 0x20, 0x01, 0x01, 0x18, 0x00, 0xE2, 0x01, 
+0x00, 0xE9, 0x08, 0x20, 0x01, 0x01, 0x20, 0x00, 
+0xE2, 0x01, 0xFF, 0xE9, 0x08, 0x20, 0x01, 0x01, 
+0x88, 0x00, 0xE2, 0x01, 0x01, 0x29, 0x08, 0x20, 
+0x01, 0x01, 0x31, 0x08, 0x22, 0x49, 0xFF, 0xF1, 
+0x08, 0x20, 0x26, 0x01, 0x88, 0x00, 0xE2, 0x01, 
+0x01, 0x49, 0x08, 0x20, 0x01, 0xFF, 0xF1, 0x13, 
+0x22, 0x49, 0x01, 0x29, 0x08, 0x20, 0x01, 0x01, 
+0x69, 0x08, 0x20, 0x25, 0x01, 0x70, 0x00, 0xE2, 
+0x01, 0x01, 0x59, 0x08, 0x20, 0x01, 0xFF, 0xF1, 
+0x13, 0x22, 0x49, 0x01, 0x29, 0x08, 0x20, 0x01, 
+0x01, 0x79, 0x08, 0x20, 0x25, 0x01, 0x80, 0x00, 
+0xE2, 0x01, 0x01, 0x91, 0x08, 0x20, 0x01, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0x01, 0xA0, 0x00, 0xF0, 
+0x01, 0x01, 0xA1, 0x08, 0x20, 0x01, 0xFF, 0xF1, 
+0x13, 0x22, 0x49, 0x01, 0x89, 0x08, 0x20, 0x01, 
+0xFF, 0xE9, 0x08, 0x20, 0x25, 0x01, 0x88, 0x00, 
+0xE2, 0x01, 0x01, 0x29, 0x08, 0x20, 0x01, 0x01, 
+0x30, 0x00, 0xE2, 0x25, 0x01, 0x39, 0x08, 0x20, 
+0x01, 0x01, 0x49, 0x08, 0x22, 0x41, 0x01, 0x98, 
+0x00, 0xE2, 0x01, 0x01, 0x49, 0x08, 0x20, 0x01, 
+0x01, 0x99, 0x14, 0x22, 0x01, 0x01, 0x50, 0x00, 
+0xE2, 0x01, 0x01, 0x70, 0x00, 0xC0, 0x01, 0x00, 
+0x07, 0xFF, 0xA0, 0x01, 0x01, 0x50, 0x00, 0xC0, 
+0x01, 0x01, 0x0F, 0xFF, 0x20, 0x81, 0x01, 0x00, 
+0x00, 0xE2, 0x01, 0xFF, 0xF1, 0x08, 0x20, 0x01, 
+0xFF, 0xF7, 0xFF, 0x22, 0x41, 0x01, 0x60, 0x00, 
+0xE2, 0x01, 0x01, 0x80, 0x00, 0xC0, 0x01, 0x00, 
+0x07, 0xFF, 0xA0, 0x01, 0x01, 0x60, 0x00, 0xC0, 
+0x01, 0x01, 0x0F, 0xFF, 0x20, 0x81, 0x01, 0x01, 
+0x08, 0x22, 0x01, 0x01, 0x00, 0x00, 0xE2, 0x01, 
+0x01, 0x39, 0x08, 0x20, 0x01, 0x01, 0x89, 0x08, 
+0x22, 0x41, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 
+0x40, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0x01, 0x02, 0x14, 0x20, 0x01, 0x01, 0xA8, 
+0x00, 0xE2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0xFF, 0xF2, 0x15, 0x20, 0x01, 0x01, 0xE8, 0x00, 
+0xE2, 0x01, 0x01, 0xA9, 0x08, 0x20, 0x01, 0x01, 
+0xC0, 0x00, 0xE2, 0x01, 0x01, 0xA9, 0x08, 0x20, 
+0x01, 0x01, 0xD0, 0x00, 0xE2, 0x01, 0x00, 0x01, 
+0x08, 0x20, 0x01, 0x01, 0xC8, 0x00, 0xE2, 0x01, 
+0x00, 0x09, 0x08, 0x20, 0x01, 0x01, 0xD8, 0x00, 
+0xE2, 0x01, 0xFF, 0xE9, 0x08, 0x20, 0x01, 0x02, 
+0x40, 0x00, 0xE2, 0x01, 0x01, 0xE1, 0x08, 0x20, 
+0x01, 0x01, 0xE9, 0x08, 0x22, 0x49, 0xFF, 0xF1, 
+0x08, 0x20, 0x26, 0x02, 0x40, 0x00, 0xE2, 0x01, 
+0x02, 0x01, 0x08, 0x20, 0x01, 0xFF, 0xF1, 0x13, 
+0x22, 0x49, 0x01, 0xE1, 0x08, 0x20, 0x01, 0x02, 
+0x21, 0x08, 0x20, 0x25, 0x02, 0x28, 0x00, 0xE2, 
+0x01, 0x02, 0x11, 0x08, 0x20, 0x01, 0xFF, 0xF1, 
+0x13, 0x22, 0x49, 0x01, 0xE1, 0x08, 0x20, 0x01, 
+0x02, 0x31, 0x08, 0x20, 0x25, 0x02, 0x38, 0x00, 
+0xE2, 0x01, 0x02, 0x49, 0x08, 0x20, 0x01, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0x02, 0x58, 0x00, 0xF0, 
+0x01, 0x02, 0x59, 0x08, 0x20, 0x01, 0xFF, 0xF1, 
+0x13, 0x22, 0x49, 0x02, 0x41, 0x08, 0x20, 0x01, 
+0xFF, 0xE9, 0x08, 0x20, 0x25, 0x02, 0x40, 0x00, 
+0xE2, 0x01, 0x01, 0xE1, 0x08, 0x20, 0x01, 0x01, 
+0xE8, 0x00, 0xE2, 0x25, 0x01, 0xF1, 0x08, 0x20, 
+0x01, 0x02, 0x01, 0x08, 0x22, 0x41, 0x02, 0x50, 
+0x00, 0xE2, 0x01, 0x02, 0x01, 0x08, 0x20, 0x01, 
+0x02, 0x51, 0x14, 0x22, 0x01, 0x02, 0x08, 0x00, 
+0xE2, 0x01, 0x02, 0x28, 0x00, 0xC0, 0x01, 0x00, 
+0x07, 0xFF, 0xA0, 0x01, 0x02, 0x08, 0x00, 0xC0, 
+0x01, 0x01, 0xC7, 0xFF, 0x20, 0x81, 0x01, 0xB0, 
+0x00, 0xE2, 0x01, 0x01, 0xD7, 0xFF, 0x40, 0x81, 
+0x01, 0xB8, 0x00, 0xE4, 0x01, 0xFF, 0xF1, 0x08, 
+0x20, 0x01, 0xFF, 0xF7, 0xFF, 0x22, 0x41, 0x02, 
+0x18, 0x00, 0xE2, 0x01, 0x02, 0x38, 0x00, 0xC0, 
+0x01, 0x00, 0x07, 0xFF, 0xA0, 0x01, 0x02, 0x18, 
+0x00, 0xC0, 0x01, 0x01, 0xC7, 0xFF, 0x20, 0x81, 
+0x01, 0xB1, 0x08, 0x22, 0x01, 0x01, 0xB0, 0x00, 
+0xE2, 0x01, 0x01, 0xD7, 0xFF, 0x40, 0x81, 0x01, 
+0xB9, 0x08, 0x44, 0x01, 0x01, 0xB8, 0x00, 0xE4, 
+0x01, 0x01, 0xF1, 0x08, 0x20, 0x01, 0x02, 0x41, 
+0x08, 0x22, 0x41, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0x01, 0xF8, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0xFF, 0xF2, 0x16, 0x20, 0x01, 0x02, 
+0x71, 0x08, 0x22, 0x41, 0x02, 0x90, 0x00, 0xE2, 
+0x01, 0x02, 0x81, 0x08, 0x20, 0x01, 0x02, 0x71, 
+0x08, 0x34, 0x01, 0x02, 0x92, 0x17, 0x22, 0x01, 
+0x02, 0x78, 0x00, 0xE2, 0x01, 0x02, 0x78, 0x00, 
+0xC0, 0x01, 0x02, 0x88, 0x00, 0xF2, 0x01, 0x01, 
+0xB7, 0xFF, 0x20, 0x01, 0x02, 0x60, 0x00, 0xE2, 
+0x01, 0x01, 0xBF, 0xFF, 0x20, 0x01, 0x02, 0x68, 
+0x00, 0xE2, 0x01, 0x02, 0x61, 0x08, 0x20, 0x01, 
+0xFF, 0x68, 0x00, 0x02, 0x01, 0x02, 0x69, 0x08, 
+0x20, 0x01, 0xFF, 0x70, 0x00, 0x02, 0x01, 0x01, 
+0x00, 0x05, 0x00, 0x08, 0x1C, 0x00, 0x1C, 0x01, 
+0x00, 0x04, 0x00, 0x08, 0x1D, 0x08, 0x01, 0x00, 
+0x05, 0x00, 0x08, 0x1E, 0x00, 0x00, 0x01, 0x00, 
+0x04, 0x00, 0x08, 0x1F, 0x00, 0x01, 0x00, 0x06, 
+0x00, 0x08, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 
+0x06, 0x00, 0x08, 0x21, 0x00, 0x00, 0x00, 0x01, 
+0x00, 0x05, 0x00, 0x08, 0x22, 0x00, 0x00, 0x01, 
+0x00, 0x05, 0x00, 0x08, 0x23, 0x00, 0x00, 0x01, 
+0x00, 0x05, 0x00, 0x08, 0x24, 0x80, 0x00, 0x01, 
+0x00, 0x05, 0x00, 0x08, 0x25, 0x00, 0x00, 0x01, 
+0x00, 0x05, 0x00, 0x08, 0x26, 0x00, 0x00, 0x01, 
+0x00, 0x05, 0x00, 0x08, 0x27, 0x00, 0x01, 0x01, 
+0x00, 0x05, 0x00, 0x08, 0x1C, 0x00, 0x1C, 0x06, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 };
 
+/* Zero-run encoded copy of DSP_eeprom_firmware[]. Load it with
+DSPRLEStream stream(DSP_eeprom_firmware_rle, EE_RLE_SIZE); ee.writeFirmware(stream, EE_SIZE); */
+#define EE_RLE_SIZE 1336
 
+const uint8_t PROGMEM DSP_eeprom_firmware_rle[EE_RLE_SIZE] =
+{
+0x1E, 0x01, 0x00, 0x05, 0x00, 0x08, 0x1C, 0x00, 0x58, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x23, 0x00, 0x08,
+0xA0, 0x02, 0x01, 0x00, 0x63, 0x87, 0x04, 0x01, 0x2C, 0x60, 0x00, 0x80, 0x84, 0x06, 0xFF, 0x00,
+0x02, 0x58, 0xBF, 0x00, 0x80, 0x84, 0x06, 0xFF, 0x00, 0x02, 0x58, 0xBF, 0x00, 0x80, 0x86, 0x00,
+0x80, 0x85, 0x01, 0xFF, 0x80, 0x84, 0x06, 0x03, 0x00, 0x02, 0x58, 0xBF, 0x00, 0x80, 0x82, 0x02,
+0x76, 0xE8, 0x45, 0x84, 0x02, 0x09, 0x80, 0xAF, 0x84, 0x02, 0x19, 0x99, 0x9A, 0x84, 0x00, 0x80,
+0x83, 0x06, 0x08, 0x00, 0x01, 0x04, 0x86, 0x00, 0x04, 0x84, 0x00, 0x01, 0x82, 0x01, 0xE8, 0x01,
+0x83, 0x19, 0x01, 0x00, 0x08, 0x00, 0xE8, 0x01, 0x00, 0x29, 0x1F, 0x20, 0x01, 0x00, 0x19, 0x08,
+0x22, 0x01, 0x00, 0x02, 0x01, 0xA0, 0x01, 0xFF, 0xE1, 0x1F, 0x22, 0x01, 0x83, 0x4B, 0x01, 0x00,
+0x20, 0x00, 0xEA, 0x01, 0x00, 0x30, 0x00, 0xF2, 0x01, 0x00, 0x31, 0x07, 0x20, 0x41, 0xFF, 0xF1,
+0x08, 0x22, 0x01, 0x00, 0x38, 0x00, 0xE2, 0x01, 0x00, 0x3A, 0x02, 0x20, 0x01, 0x00, 0x10, 0x00,
+0xE2, 0x01, 0x00, 0x59, 0x1F, 0x20, 0x01, 0x00, 0x49, 0x08, 0x22, 0x01, 0x00, 0x02, 0x04, 0xA0,
+0x01, 0xFF, 0xE1, 0x18, 0x22, 0x01, 0x00, 0x02, 0x03, 0xA0, 0x01, 0x00, 0x50, 0x00, 0xEA, 0x01,
+0x00, 0x60, 0x00, 0xF2, 0x01, 0x00, 0x50, 0x00, 0xC0, 0x01, 0x83, 0x05, 0x01, 0xFF, 0xF0, 0x01,
+0x21, 0x01, 0x82, 0x51, 0xA1, 0x01, 0xFF, 0xE1, 0x08, 0x22, 0x41, 0x00, 0x68, 0x00, 0xE2, 0x01,
+0x00, 0x60, 0x00, 0xC0, 0x01, 0x00, 0x6F, 0xFF, 0x20, 0x01, 0xFF, 0xE1, 0x08, 0x22, 0x01, 0x00,
+0x38, 0x00, 0xE2, 0x01, 0x00, 0x3A, 0x05, 0x20, 0x01, 0x00, 0x40, 0x00, 0xE2, 0x01, 0x00, 0x89,
+0x1F, 0x20, 0x01, 0x00, 0x79, 0x08, 0x22, 0x01, 0x00, 0x02, 0x07, 0xA0, 0x01, 0xFF, 0xE1, 0x18,
+0x22, 0x01, 0x00, 0x02, 0x06, 0xA0, 0x01, 0x00, 0x80, 0x00, 0xEA, 0x01, 0x00, 0x90, 0x00, 0xF2,
+0x01, 0x00, 0x80, 0x00, 0xC0, 0x01, 0x83, 0x00, 0x01, 0x81, 0x07, 0x01, 0xA1, 0x01, 0xFF, 0xE1,
+0x08, 0x20, 0x01, 0x82, 0x5B, 0xA1, 0x01, 0xFF, 0xE1, 0x08, 0x22, 0x41, 0x00, 0x98, 0x00, 0xE2,
+0x01, 0x00, 0x90, 0x00, 0xC0, 0x01, 0x00, 0x9F, 0xFF, 0x20, 0x01, 0xFF, 0xE1, 0x08, 0x22, 0x09,
+0xFF, 0xF1, 0x08, 0x20, 0x01, 0xFF, 0xF1, 0x08, 0x20, 0x67, 0x00, 0x38, 0x00, 0xE2, 0x01, 0x00,
+0x3A, 0x08, 0x20, 0x01, 0x00, 0xD8, 0x00, 0xE2, 0x01, 0x00, 0xB9, 0x1F, 0x20, 0x01, 0x00, 0xA9,
+0x08, 0x22, 0x01, 0x00, 0x02, 0x0E, 0xA0, 0x01, 0xFF, 0xE1, 0x1E, 0x22, 0x01, 0x00, 0x02, 0x0D,
+0xA0, 0x01, 0x00, 0xB0, 0x00, 0xEA, 0x01, 0x00, 0xC0, 0x00, 0xF2, 0x01, 0x00, 0xB0, 0x00, 0xC0,
+0x01, 0x83, 0x4B, 0x01, 0x00, 0x02, 0x0A, 0xA1, 0x01, 0xFF, 0xE1, 0x08, 0x20, 0x01, 0x00, 0x02,
+0x09, 0xA1, 0x01, 0xFF, 0xE1, 0x08, 0x22, 0x41, 0x00, 0xC8, 0x00, 0xE2, 0x01, 0x00, 0xC0, 0x00,
+0xC0, 0x01, 0x00, 0xCF, 0xFF, 0x20, 0x01, 0xFF, 0xE1, 0x08, 0x22, 0x01, 0x00, 0x38, 0x00, 0xE2,
+0x01, 0x00, 0x3A, 0x0F, 0x20, 0x01, 0x00, 0xA0, 0x00, 0xE2, 0x01, 0x00, 0xF2, 0x12, 0x20, 0x01,
+0x00, 0xE2, 0x12, 0x34, 0x01, 0x00, 0xDA, 0x10, 0x22, 0x01, 0x00, 0xD2, 0x11, 0x22, 0x01, 0x83,
+0x7F, 0x01, 0x00, 0xE8, 0x00, 0xE2, 0x01, 0x00, 0xF8, 0x00, 0xF2, 0x01, 0xFF, 0xF2, 0x13, 0x20,
+0x01, 0x01, 0x30, 0x00, 0xE2, 0x01, 0x00, 0x41, 0x08, 0x20, 0x01, 0x01, 0x08, 0x00, 0xE2, 0x01,
+0x00, 0xA1, 0x08, 0x20, 0x01, 0x01, 0x10, 0x00, 0xE2, 0x01, 0x00, 0x11, 0x08, 0x20, 0x01, 0x01,
+0x18, 0x00, 0xE2, 0x01, 0x00, 0xE9, 0x08, 0x20, 0x01, 0x01, 0x20, 0x00, 0xE2, 0x01, 0xFF, 0xE9,
+0x08, 0x20, 0x01, 0x01, 0x88, 0x00, 0xE2, 0x01, 0x01, 0x29, 0x08, 0x20, 0x01, 0x01, 0x31, 0x08,
+0x22, 0x49, 0xFF, 0xF1, 0x08, 0x20, 0x26, 0x01, 0x88, 0x00, 0xE2, 0x01, 0x01, 0x49, 0x08, 0x20,
+0x01, 0xFF, 0xF1, 0x13, 0x22, 0x49, 0x01, 0x29, 0x08, 0x20, 0x01, 0x01, 0x69, 0x08, 0x20, 0x25,
+0x01, 0x70, 0x00, 0xE2, 0x01, 0x01, 0x59, 0x08, 0x20, 0x01, 0xFF, 0xF1, 0x13, 0x22, 0x49, 0x01,
+0x29, 0x11, 0x08, 0x20, 0x01, 0x01, 0x79, 0x08, 0x20, 0x25, 0x01, 0x80, 0x00, 0xE2, 0x01, 0x01,
+0x91, 0x08, 0x20, 0x01, 0x83, 0x5B, 0x01, 0x01, 0xA0, 0x00, 0xF0, 0x01, 0x01, 0xA1, 0x08, 0x20,
+0x01, 0xFF, 0xF1, 0x13, 0x22, 0x49, 0x01, 0x89, 0x08, 0x20, 0x01, 0xFF, 0xE9, 0x08, 0x20, 0x25,
+0x01, 0x88, 0x00, 0xE2, 0x01, 0x01, 0x29, 0x08, 0x20, 0x01, 0x01, 0x30, 0x00, 0xE2, 0x25, 0x01,
+0x39, 0x08, 0x20, 0x01, 0x01, 0x49, 0x08, 0x22, 0x41, 0x01, 0x98, 0x00, 0xE2, 0x01, 0x01, 0x49,
+0x08, 0x20, 0x01, 0x01, 0x99, 0x14, 0x22, 0x01, 0x01, 0x50, 0x00, 0xE2, 0x01, 0x01, 0x70, 0x00,
+0xC0, 0x01, 0x00, 0x07, 0xFF, 0xA0, 0x01, 0x01, 0x50, 0x00, 0xC0, 0x01, 0x01, 0x0F, 0xFF, 0x20,
+0x81, 0x01, 0x81, 0x2A, 0xE2, 0x01, 0xFF, 0xF1, 0x08, 0x20, 0x01, 0xFF, 0xF7, 0xFF, 0x22, 0x41,
+0x01, 0x60, 0x00, 0xE2, 0x01, 0x01, 0x80, 0x00, 0xC0, 0x01, 0x00, 0x07, 0xFF, 0xA0, 0x01, 0x01,
+0x60, 0x00, 0xC0, 0x01, 0x01, 0x0F, 0xFF, 0x20, 0x81, 0x01, 0x01, 0x08, 0x22, 0x01, 0x01, 0x81,
+0x0B, 0xE2, 0x01, 0x01, 0x39, 0x08, 0x20, 0x01, 0x01, 0x89, 0x08, 0x22, 0x41, 0x83, 0x05, 0x01,
+0x01, 0x40, 0x00, 0xF0, 0x01, 0x83, 0x0A, 0x01, 0x01, 0x02, 0x14, 0x20, 0x01, 0x01, 0xA8, 0x00,
+0xE2, 0x01, 0x83, 0x7F, 0x01, 0xFF, 0xF2, 0x15, 0x20, 0x01, 0x01, 0xE8, 0x00, 0xE2, 0x01, 0x01,
+0xA9, 0x08, 0x20, 0x01, 0x01, 0xC0, 0x00, 0xE2, 0x01, 0x01, 0xA9, 0x08, 0x20, 0x01, 0x01, 0xD0,
+0x00, 0xE2, 0x01, 0x00, 0x01, 0x08, 0x20, 0x01, 0x01, 0xC8, 0x00, 0xE2, 0x01, 0x00, 0x09, 0x08,
+0x20, 0x01, 0x01, 0xD8, 0x00, 0xE2, 0x01, 0xFF, 0xE9, 0x08, 0x20, 0x01, 0x02, 0x40, 0x00, 0xE2,
+0x01, 0x01, 0xE1, 0x08, 0x20, 0x01, 0x01, 0xE9, 0x08, 0x22, 0x49, 0xFF, 0xF1, 0x08, 0x20, 0x26,
+0x02, 0x40, 0x00, 0xE2, 0x01, 0x02, 0x01, 0x08, 0x20, 0x01, 0xFF, 0xF1, 0x13, 0x22, 0x49, 0x01,
+0xE1, 0x08, 0x20, 0x01, 0x02, 0x21, 0x08, 0x20, 0x25, 0x02, 0x28, 0x00, 0xE2, 0x01, 0x02, 0x11,
+0x08, 0x20, 0x01, 0xFF, 0xF1, 0x13, 0x22, 0x49, 0x01, 0xE1, 0x08, 0x20, 0x01, 0x02, 0x31, 0x08,
+0x20, 0x25, 0x02, 0x38, 0x80, 0x06, 0xE2, 0x01, 0x02, 0x49, 0x08, 0x20, 0x01, 0x83, 0x7F, 0x01,
+0x02, 0x58, 0x00, 0xF0, 0x01, 0x02, 0x59, 0x08, 0x20, 0x01, 0xFF, 0xF1, 0x13, 0x22, 0x49, 0x02,
+0x41, 0x08, 0x20, 0x01, 0xFF, 0xE9, 0x08, 0x20, 0x25, 0x02, 0x40, 0x00, 0xE2, 0x01, 0x01, 0xE1,
+0x08, 0x20, 0x01, 0x01, 0xE8, 0x00, 0xE2, 0x25, 0x01, 0xF1, 0x08, 0x20, 0x01, 0x02, 0x01, 0x08,
+0x22, 0x41, 0x02, 0x50, 0x00, 0xE2, 0x01, 0x02, 0x01, 0x08, 0x20, 0x01, 0x02, 0x51, 0x14, 0x22,
+0x01, 0x02, 0x08, 0x00, 0xE2, 0x01, 0x02, 0x28, 0x00, 0xC0, 0x01, 0x00, 0x07, 0xFF, 0xA0, 0x01,
+0x02, 0x08, 0x00, 0xC0, 0x01, 0x01, 0xC7, 0xFF, 0x20, 0x81, 0x01, 0xB0, 0x00, 0xE2, 0x01, 0x01,
+0xD7, 0xFF, 0x40, 0x81, 0x01, 0xB8, 0x00, 0xE4, 0x01, 0xFF, 0xF1, 0x08, 0x20, 0x01, 0xFF, 0xF7,
+0xFF, 0x22, 0x41, 0x02, 0x18, 0x00, 0xE2, 0x01, 0x02, 0x38, 0x00, 0xC0, 0x01, 0x00, 0x07, 0x2F,
+0xFF, 0xA0, 0x01, 0x02, 0x18, 0x00, 0xC0, 0x01, 0x01, 0xC7, 0xFF, 0x20, 0x81, 0x01, 0xB1, 0x08,
+0x22, 0x01, 0x01, 0xB0, 0x00, 0xE2, 0x01, 0x01, 0xD7, 0xFF, 0x40, 0x81, 0x01, 0xB9, 0x08, 0x44,
+0x01, 0x01, 0xB8, 0x00, 0xE4, 0x01, 0x01, 0xF1, 0x08, 0x20, 0x01, 0x02, 0x41, 0x08, 0x22, 0x41,
+0x83, 0x05, 0x01, 0x01, 0xF8, 0x00, 0xF0, 0x01, 0x83, 0x6A, 0x01, 0xFF, 0xF2, 0x16, 0x20, 0x01,
+0x02, 0x71, 0x08, 0x22, 0x41, 0x02, 0x90, 0x00, 0xE2, 0x01, 0x02, 0x81, 0x08, 0x20, 0x01, 0x02,
+0x71, 0x08, 0x34, 0x01, 0x02, 0x92, 0x17, 0x22, 0x01, 0x02, 0x78, 0x00, 0xE2, 0x01, 0x02, 0x78,
+0x00, 0xC0, 0x01, 0x02, 0x88, 0x00, 0xF2, 0x01, 0x01, 0xB7, 0xFF, 0x20, 0x01, 0x02, 0x60, 0x00,
+0xE2, 0x01, 0x01, 0xBF, 0xFF, 0x20, 0x01, 0x02, 0x68, 0x00, 0xE2, 0x01, 0x02, 0x61, 0x08, 0x20,
+0x01, 0xFF, 0x68, 0x00, 0x02, 0x01, 0x02, 0x69, 0x08, 0x20, 0x01, 0xFF, 0x70, 0x00, 0x02, 0x01,
+0x01, 0x00, 0x05, 0x00, 0x08, 0x1C, 0x00, 0x1C, 0x01, 0x00, 0x04, 0x00, 0x08, 0x1D, 0x08, 0x01,
+0x00, 0x05, 0x00, 0x08, 0x1E, 0x81, 0x0C, 0x01, 0x00, 0x04, 0x00, 0x08, 0x1F, 0x00, 0x01, 0x00,
+0x06, 0x00, 0x08, 0x20, 0x82, 0x05, 0x01, 0x00, 0x06, 0x00, 0x08, 0x21, 0x82, 0x05, 0x01, 0x00,
+0x05, 0x00, 0x08, 0x22, 0x81, 0x05, 0x01, 0x00, 0x05, 0x00, 0x08, 0x23, 0x81, 0x0D, 0x01, 0x00,
+0x05, 0x00, 0x08, 0x24, 0x80, 0x00, 0x01, 0x00, 0x05, 0x00, 0x08, 0x25, 0x81, 0x05, 0x01, 0x00,
+0x05, 0x00, 0x08, 0x26, 0x81, 0x10, 0x01, 0x00, 0x05, 0x00, 0x08, 0x27, 0x00, 0x01, 0x01, 0x00,
+0x05, 0x00, 0x08, 0x1C, 0x00, 0x1C, 0x06, 0xA7, 
+};
+
+/* The program, parameter and register data is loaded from DSP_eeprom_firmware[] by loadProgram() */
 
 /* DSP Program Data */
 
@@ -353,1035 +455,6 @@ const uint8_t PROGMEM DSP_eeprom_firmware[EE_SIZE] =
 #define PROGRAM_ADDR 1024
 #define PROGRAM_REGSIZE 5
 
-const uint8_t PROGMEM DSP_program_data[PROGRAM_SIZE] =
-{
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0xE8, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x08, 0x00, 0xE8, 0x01,
-0x00, 0x29, 0x1F, 0x20, 0x01,
-0x00, 0x19, 0x08, 0x22, 0x01,
-0x00, 0x02, 0x01, 0xA0, 0x01,
-0xFF, 0xE1, 0x1F, 0x22, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x20, 0x00, 0xEA, 0x01,
-0x00, 0x30, 0x00, 0xF2, 0x01,
-0x00, 0x31, 0x07, 0x20, 0x41,
-0xFF, 0xF1, 0x08, 0x22, 0x01,
-0x00, 0x38, 0x00, 0xE2, 0x01,
-0x00, 0x3A, 0x02, 0x20, 0x01,
-0x00, 0x10, 0x00, 0xE2, 0x01,
-0x00, 0x59, 0x1F, 0x20, 0x01,
-0x00, 0x49, 0x08, 0x22, 0x01,
-0x00, 0x02, 0x04, 0xA0, 0x01,
-0xFF, 0xE1, 0x18, 0x22, 0x01,
-0x00, 0x02, 0x03, 0xA0, 0x01,
-0x00, 0x50, 0x00, 0xEA, 0x01,
-0x00, 0x60, 0x00, 0xF2, 0x01,
-0x00, 0x50, 0x00, 0xC0, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0xFF, 0xF0, 0x01, 0x21, 0x01,
-0x00, 0x00, 0x00, 0xA1, 0x01,
-0xFF, 0xE1, 0x08, 0x22, 0x41,
-0x00, 0x68, 0x00, 0xE2, 0x01,
-0x00, 0x60, 0x00, 0xC0, 0x01,
-0x00, 0x6F, 0xFF, 0x20, 0x01,
-0xFF, 0xE1, 0x08, 0x22, 0x01,
-0x00, 0x38, 0x00, 0xE2, 0x01,
-0x00, 0x3A, 0x05, 0x20, 0x01,
-0x00, 0x40, 0x00, 0xE2, 0x01,
-0x00, 0x89, 0x1F, 0x20, 0x01,
-0x00, 0x79, 0x08, 0x22, 0x01,
-0x00, 0x02, 0x07, 0xA0, 0x01,
-0xFF, 0xE1, 0x18, 0x22, 0x01,
-0x00, 0x02, 0x06, 0xA0, 0x01,
-0x00, 0x80, 0x00, 0xEA, 0x01,
-0x00, 0x90, 0x00, 0xF2, 0x01,
-0x00, 0x80, 0x00, 0xC0, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x01, 0xA1, 0x01,
-0xFF, 0xE1, 0x08, 0x20, 0x01,
-0x00, 0x00, 0x00, 0xA1, 0x01,
-0xFF, 0xE1, 0x08, 0x22, 0x41,
-0x00, 0x98, 0x00, 0xE2, 0x01,
-0x00, 0x90, 0x00, 0xC0, 0x01,
-0x00, 0x9F, 0xFF, 0x20, 0x01,
-0xFF, 0xE1, 0x08, 0x22, 0x09,
-0xFF, 0xF1, 0x08, 0x20, 0x01,
-0xFF, 0xF1, 0x08, 0x20, 0x67,
-0x00, 0x38, 0x00, 0xE2, 0x01,
-0x00, 0x3A, 0x08, 0x20, 0x01,
-0x00, 0xD8, 0x00, 0xE2, 0x01,
-0x00, 0xB9, 0x1F, 0x20, 0x01,
-0x00, 0xA9, 0x08, 0x22, 0x01,
-0x00, 0x02, 0x0E, 0xA0, 0x01,
-0xFF, 0xE1, 0x1E, 0x22, 0x01,
-0x00, 0x02, 0x0D, 0xA0, 0x01,
-0x00, 0xB0, 0x00, 0xEA, 0x01,
-0x00, 0xC0, 0x00, 0xF2, 0x01,
-0x00, 0xB0, 0x00, 0xC0, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x02, 0x0A, 0xA1, 0x01,
-0xFF, 0xE1, 0x08, 0x20, 0x01,
-0x00, 0x02, 0x09, 0xA1, 0x01,
-0xFF, 0xE1, 0x08, 0x22, 0x41,
-0x00, 0xC8, 0x00, 0xE2, 0x01,
-0x00, 0xC0, 0x00, 0xC0, 0x01,
-0x00, 0xCF, 0xFF, 0x20, 0x01,
-0xFF, 0xE1, 0x08, 0x22, 0x01,
-0x00, 0x38, 0x00, 0xE2, 0x01,
-0x00, 0x3A, 0x0F, 0x20, 0x01,
-0x00, 0xA0, 0x00, 0xE2, 0x01,
-0x00, 0xF2, 0x12, 0x20, 0x01,
-0x00, 0xE2, 0x12, 0x34, 0x01,
-0x00, 0xDA, 0x10, 0x22, 0x01,
-0x00, 0xD2, 0x11, 0x22, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0xE8, 0x00, 0xE2, 0x01,
-0x00, 0xF8, 0x00, 0xF2, 0x01,
-0xFF, 0xF2, 0x13, 0x20, 0x01,
-0x01, 0x30, 0x00, 0xE2, 0x01,
-0x00, 0x41, 0x08, 0x20, 0x01,
-0x01, 0x08, 0x00, 0xE2, 0x01,
-0x00, 0xA1, 0x08, 0x20, 0x01,
-0x01, 0x10, 0x00, 0xE2, 0x01,
-0x00, 0x11, 0x08, 0x20, 0x01,
-0x01, 0x18, 0x00, 0xE2, 0x01,
-0x00, 0xE9, 0x08, 0x20, 0x01,
-0x01, 0x20, 0x00, 0xE2, 0x01,
-0xFF, 0xE9, 0x08, 0x20, 0x01,
-0x01, 0x88, 0x00, 0xE2, 0x01,
-0x01, 0x29, 0x08, 0x20, 0x01,
-0x01, 0x31, 0x08, 0x22, 0x49,
-0xFF, 0xF1, 0x08, 0x20, 0x26,
-0x01, 0x88, 0x00, 0xE2, 0x01,
-0x01, 0x49, 0x08, 0x20, 0x01,
-0xFF, 0xF1, 0x13, 0x22, 0x49,
-0x01, 0x29, 0x08, 0x20, 0x01,
-0x01, 0x69, 0x08, 0x20, 0x25,
-0x01, 0x70, 0x00, 0xE2, 0x01,
-0x01, 0x59, 0x08, 0x20, 0x01,
-0xFF, 0xF1, 0x13, 0x22, 0x49,
-0x01, 0x29, 0x08, 0x20, 0x01,
-0x01, 0x79, 0x08, 0x20, 0x25,
-0x01, 0x80, 0x00, 0xE2, 0x01,
-0x01, 0x91, 0x08, 0x20, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x01, 0xA0, 0x00, 0xF0, 0x01,
-0x01, 0xA1, 0x08, 0x20, 0x01,
-0xFF, 0xF1, 0x13, 0x22, 0x49,
-0x01, 0x89, 0x08, 0x20, 0x01,
-0xFF, 0xE9, 0x08, 0x20, 0x25,
-0x01, 0x88, 0x00, 0xE2, 0x01,
-0x01, 0x29, 0x08, 0x20, 0x01,
-0x01, 0x30, 0x00, 0xE2, 0x25,
-0x01, 0x39, 0x08, 0x20, 0x01,
-0x01, 0x49, 0x08, 0x22, 0x41,
-0x01, 0x98, 0x00, 0xE2, 0x01,
-0x01, 0x49, 0x08, 0x20, 0x01,
-0x01, 0x99, 0x14, 0x22, 0x01,
-0x01, 0x50, 0x00, 0xE2, 0x01,
-0x01, 0x70, 0x00, 0xC0, 0x01,
-0x00, 0x07, 0xFF, 0xA0, 0x01,
-0x01, 0x50, 0x00, 0xC0, 0x01,
-0x01, 0x0F, 0xFF, 0x20, 0x81,
-0x01, 0x00, 0x00, 0xE2, 0x01,
-0xFF, 0xF1, 0x08, 0x20, 0x01,
-0xFF, 0xF7, 0xFF, 0x22, 0x41,
-0x01, 0x60, 0x00, 0xE2, 0x01,
-0x01, 0x80, 0x00, 0xC0, 0x01,
-0x00, 0x07, 0xFF, 0xA0, 0x01,
-0x01, 0x60, 0x00, 0xC0, 0x01,
-0x01, 0x0F, 0xFF, 0x20, 0x81,
-0x01, 0x01, 0x08, 0x22, 0x01,
-0x01, 0x00, 0x00, 0xE2, 0x01,
-0x01, 0x39, 0x08, 0x20, 0x01,
-0x01, 0x89, 0x08, 0x22, 0x41,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x01, 0x40, 0x00, 0xF0, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x01, 0x02, 0x14, 0x20, 0x01,
-0x01, 0xA8, 0x00, 0xE2, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0xFF, 0xF2, 0x15, 0x20, 0x01,
-0x01, 0xE8, 0x00, 0xE2, 0x01,
-0x01, 0xA9, 0x08, 0x20, 0x01,
-0x01, 0xC0, 0x00, 0xE2, 0x01,
-0x01, 0xA9, 0x08, 0x20, 0x01,
-0x01, 0xD0, 0x00, 0xE2, 0x01,
-0x00, 0x01, 0x08, 0x20, 0x01,
-0x01, 0xC8, 0x00, 0xE2, 0x01,
-0x00, 0x09, 0x08, 0x20, 0x01,
-0x01, 0xD8, 0x00, 0xE2, 0x01,
-0xFF, 0xE9, 0x08, 0x20, 0x01,
-0x02, 0x40, 0x00, 0xE2, 0x01,
-0x01, 0xE1, 0x08, 0x20, 0x01,
-0x01, 0xE9, 0x08, 0x22, 0x49,
-0xFF, 0xF1, 0x08, 0x20, 0x26,
-0x02, 0x40, 0x00, 0xE2, 0x01,
-0x02, 0x01, 0x08, 0x20, 0x01,
-0xFF, 0xF1, 0x13, 0x22, 0x49,
-0x01, 0xE1, 0x08, 0x20, 0x01,
-0x02, 0x21, 0x08, 0x20, 0x25,
-0x02, 0x28, 0x00, 0xE2, 0x01,
-0x02, 0x11, 0x08, 0x20, 0x01,
-0xFF, 0xF1, 0x13, 0x22, 0x49,
-0x01, 0xE1, 0x08, 0x20, 0x01,
-0x02, 0x31, 0x08, 0x20, 0x25,
-0x02, 0x38, 0x00, 0xE2, 0x01,
-0x02, 0x49, 0x08, 0x20, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x02, 0x58, 0x00, 0xF0, 0x01,
-0x02, 0x59, 0x08, 0x20, 0x01,
-0xFF, 0xF1, 0x13, 0x22, 0x49,
-0x02, 0x41, 0x08, 0x20, 0x01,
-0xFF, 0xE9, 0x08, 0x20, 0x25,
-0x02, 0x40, 0x00, 0xE2, 0x01,
-0x01, 0xE1, 0x08, 0x20, 0x01,
-0x01, 0xE8, 0x00, 0xE2, 0x25,
-0x01, 0xF1, 0x08, 0x20, 0x01,
-0x02, 0x01, 0x08, 0x22, 0x41,
-0x02, 0x50, 0x00, 0xE2, 0x01,
-0x02, 0x01, 0x08, 0x20, 0x01,
-0x02, 0x51, 0x14, 0x22, 0x01,
-0x02, 0x08, 0x00, 0xE2, 0x01,
-0x02, 0x28, 0x00, 0xC0, 0x01,
-0x00, 0x07, 0xFF, 0xA0, 0x01,
-0x02, 0x08, 0x00, 0xC0, 0x01,
-0x01, 0xC7, 0xFF, 0x20, 0x81,
-0x01, 0xB0, 0x00, 0xE2, 0x01,
-0x01, 0xD7, 0xFF, 0x40, 0x81,
-0x01, 0xB8, 0x00, 0xE4, 0x01,
-0xFF, 0xF1, 0x08, 0x20, 0x01,
-0xFF, 0xF7, 0xFF, 0x22, 0x41,
-0x02, 0x18, 0x00, 0xE2, 0x01,
-0x02, 0x38, 0x00, 0xC0, 0x01,
-0x00, 0x07, 0xFF, 0xA0, 0x01,
-0x02, 0x18, 0x00, 0xC0, 0x01,
-0x01, 0xC7, 0xFF, 0x20, 0x81,
-0x01, 0xB1, 0x08, 0x22, 0x01,
-0x01, 0xB0, 0x00, 0xE2, 0x01,
-0x01, 0xD7, 0xFF, 0x40, 0x81,
-0x01, 0xB9, 0x08, 0x44, 0x01,
-0x01, 0xB8, 0x00, 0xE4, 0x01,
-0x01, 0xF1, 0x08, 0x20, 0x01,
-0x02, 0x41, 0x08, 0x22, 0x41,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x01, 0xF8, 0x00, 0xF0, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0xFF, 0xF2, 0x16, 0x20, 0x01,
-0x02, 0x71, 0x08, 0x22, 0x41,
-0x02, 0x90, 0x00, 0xE2, 0x01,
-0x02, 0x81, 0x08, 0x20, 0x01,
-0x02, 0x71, 0x08, 0x34, 0x01,
-0x02, 0x92, 0x17, 0x22, 0x01,
-0x02, 0x78, 0x00, 0xE2, 0x01,
-0x02, 0x78, 0x00, 0xC0, 0x01,
-0x02, 0x88, 0x00, 0xF2, 0x01,
-0x01, 0xB7, 0xFF, 0x20, 0x01,
-0x02, 0x60, 0x00, 0xE2, 0x01,
-0x01, 0xBF, 0xFF, 0x20, 0x01,
-0x02, 0x68, 0x00, 0xE2, 0x01,
-0x02, 0x61, 0x08, 0x20, 0x01,
-0xFF, 0x68, 0x00, 0x02, 0x01,
-0x02, 0x69, 0x08, 0x20, 0x01,
-0xFF, 0x70, 0x00, 0x02, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01,
-};
-
-
 
 /* DSP Parameter (Coefficient) Data */
 
@@ -1389,1035 +462,6 @@ const uint8_t PROGMEM DSP_program_data[PROGRAM_SIZE] =
 #define PARAMETER_ADDR 0
 #define PARAMETER_REGSIZE 4
 
-const uint8_t PROGMEM DSP_parameter_data[PARAMETER_SIZE] =
-{
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x01, 0x2C, 0x60,
-0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xFF,
-0x00, 0x02, 0x58, 0xBF,
-0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xFF,
-0x00, 0x02, 0x58, 0xBF,
-0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0xFF, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x03,
-0x00, 0x02, 0x58, 0xBF,
-0x00, 0x80, 0x00, 0x00,
-0x00, 0x76, 0xE8, 0x45,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x09, 0x80, 0xAF,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x19, 0x99, 0x9A,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x08, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00,
-};
-
-
 
 /* Register Default - IC 1.CoreRegister */
 
@@ -2425,12 +469,6 @@ const uint8_t PROGMEM DSP_parameter_data[PARAMETER_SIZE] =
 #define CORE_REGISTER_R0_ADDR 0x081C
 #define CORE_REGISTER_R0_REGSIZE 2
 
-const uint8_t PROGMEM DSP_core_register_R0_data[CORE_REGISTER_R0_SIZE] =
-{
-0x00, 0x18
-};
-
-
 
 /* Register Default - IC 1.HWConFiguration */
 
@@ -2438,12 +476,6 @@ const uint8_t PROGMEM DSP_core_register_R0_data[CORE_REGISTER_R0_SIZE] =
 #define HARDWARE_CONF_ADDR 0x081C
 #define HARDWARE_CONF_REGSIZE 1
 
-const uint8_t PROGMEM DSP_hardware_conf_data[HARDWARE_CONF_SIZE] =
-{
-0x00, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
-};
-
-
 
 /* Register Default - IC 1.CoreRegister */
 
@@ -2451,22 +483,291 @@ const uint8_t PROGMEM DSP_hardware_conf_data[HARDWARE_CONF_SIZE] =
 #define CORE_REGISTER_R4_ADDR 0x081C
 #define CORE_REGISTER_R4_REGSIZE 2
 
-const uint8_t PROGMEM DSP_core_register_R4_data[CORE_REGISTER_R4_SIZE] =
+/* CRC-32 of the program RAM content. Pass it to verifyProgram() to check if the DSP already runs this program */
+#define PROGRAM_CRC32 0x38A53729UL
+
+/* Zero-run encoded copy of the R0, program, parameter, hardware configuration
+and R4 data. Use loadCompressedProgram() to load it */
+#define DSP_FIRMWARE_RLE_SIZE 3614
+
+const uint8_t PROGMEM DSP_firmware_rle[DSP_FIRMWARE_RLE_SIZE] =
 {
-0x00, 0x1C
+0x80, 0x00, 0x18, 0x83, 0x00, 0x01, 0x82, 0x01, 0xE8, 0x01, 0x83, 0x19, 0x01, 0x00, 0x08, 0x00,
+0xE8, 0x01, 0x00, 0x29, 0x1F, 0x20, 0x01, 0x00, 0x19, 0x08, 0x22, 0x01, 0x00, 0x02, 0x01, 0xA0,
+0x01, 0xFF, 0xE1, 0x1F, 0x22, 0x01, 0x83, 0x4B, 0x01, 0x00, 0x20, 0x00, 0xEA, 0x01, 0x00, 0x30,
+0x00, 0xF2, 0x01, 0x00, 0x31, 0x07, 0x20, 0x41, 0xFF, 0xF1, 0x08, 0x22, 0x01, 0x00, 0x38, 0x00,
+0xE2, 0x01, 0x00, 0x3A, 0x02, 0x20, 0x01, 0x00, 0x10, 0x00, 0xE2, 0x01, 0x00, 0x59, 0x1F, 0x20,
+0x01, 0x00, 0x49, 0x08, 0x22, 0x01, 0x00, 0x02, 0x04, 0xA0, 0x01, 0xFF, 0xE1, 0x18, 0x22, 0x01,
+0x00, 0x02, 0x03, 0xA0, 0x01, 0x00, 0x50, 0x00, 0xEA, 0x01, 0x00, 0x60, 0x00, 0xF2, 0x01, 0x00,
+0x50, 0x00, 0xC0, 0x01, 0x83, 0x05, 0x01, 0xFF, 0xF0, 0x01, 0x21, 0x01, 0x82, 0x51, 0xA1, 0x01,
+0xFF, 0xE1, 0x08, 0x22, 0x41, 0x00, 0x68, 0x00, 0xE2, 0x01, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x00,
+0x6F, 0xFF, 0x20, 0x01, 0xFF, 0xE1, 0x08, 0x22, 0x01, 0x00, 0x38, 0x00, 0xE2, 0x01, 0x00, 0x3A,
+0x05, 0x20, 0x01, 0x00, 0x40, 0x00, 0xE2, 0x01, 0x00, 0x89, 0x1F, 0x20, 0x01, 0x00, 0x79, 0x08,
+0x22, 0x01, 0x00, 0x02, 0x07, 0xA0, 0x01, 0xFF, 0xE1, 0x18, 0x22, 0x01, 0x00, 0x02, 0x06, 0xA0,
+0x01, 0x00, 0x80, 0x00, 0xEA, 0x01, 0x00, 0x90, 0x00, 0xF2, 0x01, 0x00, 0x80, 0x00, 0xC0, 0x01,
+0x83, 0x00, 0x01, 0x81, 0x07, 0x01, 0xA1, 0x01, 0xFF, 0xE1, 0x08, 0x20, 0x01, 0x82, 0x5B, 0xA1,
+0x01, 0xFF, 0xE1, 0x08, 0x22, 0x41, 0x00, 0x98, 0x00, 0xE2, 0x01, 0x00, 0x90, 0x00, 0xC0, 0x01,
+0x00, 0x9F, 0xFF, 0x20, 0x01, 0xFF, 0xE1, 0x08, 0x22, 0x09, 0xFF, 0xF1, 0x08, 0x20, 0x01, 0xFF,
+0xF1, 0x08, 0x20, 0x67, 0x00, 0x38, 0x00, 0xE2, 0x01, 0x00, 0x3A, 0x08, 0x20, 0x01, 0x00, 0xD8,
+0x00, 0xE2, 0x01, 0x00, 0xB9, 0x1F, 0x20, 0x01, 0x00, 0xA9, 0x08, 0x22, 0x01, 0x00, 0x02, 0x0E,
+0xA0, 0x01, 0xFF, 0xE1, 0x1E, 0x22, 0x01, 0x00, 0x02, 0x0D, 0xA0, 0x01, 0x00, 0xB0, 0x00, 0xEA,
+0x01, 0x00, 0xC0, 0x00, 0xF2, 0x01, 0x00, 0xB0, 0x00, 0xC0, 0x01, 0x83, 0x4B, 0x01, 0x00, 0x02,
+0x0A, 0xA1, 0x01, 0xFF, 0xE1, 0x08, 0x20, 0x01, 0x00, 0x02, 0x09, 0xA1, 0x01, 0xFF, 0xE1, 0x08,
+0x22, 0x41, 0x00, 0xC8, 0x00, 0xE2, 0x01, 0x00, 0xC0, 0x00, 0xC0, 0x01, 0x00, 0xCF, 0xFF, 0x20,
+0x01, 0xFF, 0xE1, 0x08, 0x22, 0x01, 0x00, 0x38, 0x00, 0xE2, 0x01, 0x00, 0x3A, 0x0F, 0x20, 0x01,
+0x00, 0xA0, 0x00, 0xE2, 0x01, 0x00, 0xF2, 0x12, 0x20, 0x01, 0x00, 0xE2, 0x12, 0x34, 0x01, 0x00,
+0xDA, 0x10, 0x22, 0x01, 0x00, 0xD2, 0x11, 0x22, 0x01, 0x83, 0x7F, 0x01, 0x00, 0xE8, 0x00, 0xE2,
+0x01, 0x00, 0xF8, 0x00, 0xF2, 0x01, 0xFF, 0xF2, 0x13, 0x20, 0x01, 0x01, 0x30, 0x00, 0xE2, 0x01,
+0x00, 0x41, 0x08, 0x20, 0x01, 0x01, 0x08, 0x00, 0xE2, 0x01, 0x00, 0xA1, 0x08, 0x20, 0x01, 0x01,
+0x10, 0x00, 0xE2, 0x01, 0x00, 0x11, 0x08, 0x20, 0x01, 0x01, 0x18, 0x00, 0xE2, 0x01, 0x00, 0xE9,
+0x08, 0x20, 0x01, 0x01, 0x20, 0x00, 0xE2, 0x01, 0xFF, 0xE9, 0x08, 0x20, 0x01, 0x01, 0x88, 0x00,
+0xE2, 0x01, 0x01, 0x29, 0x08, 0x20, 0x01, 0x01, 0x31, 0x08, 0x22, 0x49, 0xFF, 0xF1, 0x08, 0x20,
+0x26, 0x01, 0x88, 0x00, 0xE2, 0x01, 0x01, 0x49, 0x08, 0x20, 0x01, 0xFF, 0xF1, 0x13, 0x22, 0x49,
+0x01, 0x29, 0x08, 0x20, 0x01, 0x01, 0x69, 0x08, 0x20, 0x25, 0x01, 0x70, 0x00, 0xE2, 0x01, 0x01,
+0x59, 0x08, 0x20, 0x01, 0xFF, 0xF1, 0x13, 0x22, 0x49, 0x01, 0x29, 0x11, 0x08, 0x20, 0x01, 0x01,
+0x79, 0x08, 0x20, 0x25, 0x01, 0x80, 0x00, 0xE2, 0x01, 0x01, 0x91, 0x08, 0x20, 0x01, 0x83, 0x5B,
+0x01, 0x01, 0xA0, 0x00, 0xF0, 0x01, 0x01, 0xA1, 0x08, 0x20, 0x01, 0xFF, 0xF1, 0x13, 0x22, 0x49,
+0x01, 0x89, 0x08, 0x20, 0x01, 0xFF, 0xE9, 0x08, 0x20, 0x25, 0x01, 0x88, 0x00, 0xE2, 0x01, 0x01,
+0x29, 0x08, 0x20, 0x01, 0x01, 0x30, 0x00, 0xE2, 0x25, 0x01, 0x39, 0x08, 0x20, 0x01, 0x01, 0x49,
+0x08, 0x22, 0x41, 0x01, 0x98, 0x00, 0xE2, 0x01, 0x01, 0x49, 0x08, 0x20, 0x01, 0x01, 0x99, 0x14,
+0x22, 0x01, 0x01, 0x50, 0x00, 0xE2, 0x01, 0x01, 0x70, 0x00, 0xC0, 0x01, 0x00, 0x07, 0xFF, 0xA0,
+0x01, 0x01, 0x50, 0x00, 0xC0, 0x01, 0x01, 0x0F, 0xFF, 0x20, 0x81, 0x01, 0x81, 0x2A, 0xE2, 0x01,
+0xFF, 0xF1, 0x08, 0x20, 0x01, 0xFF, 0xF7, 0xFF, 0x22, 0x41, 0x01, 0x60, 0x00, 0xE2, 0x01, 0x01,
+0x80, 0x00, 0xC0, 0x01, 0x00, 0x07, 0xFF, 0xA0, 0x01, 0x01, 0x60, 0x00, 0xC0, 0x01, 0x01, 0x0F,
+0xFF, 0x20, 0x81, 0x01, 0x01, 0x08, 0x22, 0x01, 0x01, 0x81, 0x0B, 0xE2, 0x01, 0x01, 0x39, 0x08,
+0x20, 0x01, 0x01, 0x89, 0x08, 0x22, 0x41, 0x83, 0x05, 0x01, 0x01, 0x40, 0x00, 0xF0, 0x01, 0x83,
+0x0A, 0x01, 0x01, 0x02, 0x14, 0x20, 0x01, 0x01, 0xA8, 0x00, 0xE2, 0x01, 0x83, 0x7F, 0x01, 0xFF,
+0xF2, 0x15, 0x20, 0x01, 0x01, 0xE8, 0x00, 0xE2, 0x01, 0x01, 0xA9, 0x08, 0x20, 0x01, 0x01, 0xC0,
+0x00, 0xE2, 0x01, 0x01, 0xA9, 0x08, 0x20, 0x01, 0x01, 0xD0, 0x00, 0xE2, 0x01, 0x00, 0x01, 0x08,
+0x20, 0x01, 0x01, 0xC8, 0x00, 0xE2, 0x01, 0x00, 0x09, 0x08, 0x20, 0x01, 0x01, 0xD8, 0x00, 0xE2,
+0x01, 0xFF, 0xE9, 0x08, 0x20, 0x01, 0x02, 0x40, 0x00, 0xE2, 0x01, 0x01, 0xE1, 0x08, 0x20, 0x01,
+0x01, 0xE9, 0x08, 0x22, 0x49, 0xFF, 0xF1, 0x08, 0x20, 0x26, 0x02, 0x40, 0x00, 0xE2, 0x01, 0x02,
+0x01, 0x08, 0x20, 0x01, 0xFF, 0xF1, 0x13, 0x22, 0x49, 0x01, 0xE1, 0x08, 0x20, 0x01, 0x02, 0x21,
+0x08, 0x20, 0x25, 0x02, 0x28, 0x00, 0xE2, 0x01, 0x02, 0x11, 0x08, 0x20, 0x01, 0xFF, 0xF1, 0x13,
+0x22, 0x49, 0x01, 0xE1, 0x08, 0x20, 0x01, 0x02, 0x31, 0x08, 0x20, 0x25, 0x02, 0x38, 0x80, 0x06,
+0xE2, 0x01, 0x02, 0x49, 0x08, 0x20, 0x01, 0x83, 0x7F, 0x01, 0x02, 0x58, 0x00, 0xF0, 0x01, 0x02,
+0x59, 0x08, 0x20, 0x01, 0xFF, 0xF1, 0x13, 0x22, 0x49, 0x02, 0x41, 0x08, 0x20, 0x01, 0xFF, 0xE9,
+0x08, 0x20, 0x25, 0x02, 0x40, 0x00, 0xE2, 0x01, 0x01, 0xE1, 0x08, 0x20, 0x01, 0x01, 0xE8, 0x00,
+0xE2, 0x25, 0x01, 0xF1, 0x08, 0x20, 0x01, 0x02, 0x01, 0x08, 0x22, 0x41, 0x02, 0x50, 0x00, 0xE2,
+0x01, 0x02, 0x01, 0x08, 0x20, 0x01, 0x02, 0x51, 0x14, 0x22, 0x01, 0x02, 0x08, 0x00, 0xE2, 0x01,
+0x02, 0x28, 0x00, 0xC0, 0x01, 0x00, 0x07, 0xFF, 0xA0, 0x01, 0x02, 0x08, 0x00, 0xC0, 0x01, 0x01,
+0xC7, 0xFF, 0x20, 0x81, 0x01, 0xB0, 0x00, 0xE2, 0x01, 0x01, 0xD7, 0xFF, 0x40, 0x81, 0x01, 0xB8,
+0x00, 0xE4, 0x01, 0xFF, 0xF1, 0x08, 0x20, 0x01, 0xFF, 0xF7, 0xFF, 0x22, 0x41, 0x02, 0x18, 0x00,
+0xE2, 0x01, 0x02, 0x38, 0x00, 0xC0, 0x01, 0x00, 0x07, 0x2F, 0xFF, 0xA0, 0x01, 0x02, 0x18, 0x00,
+0xC0, 0x01, 0x01, 0xC7, 0xFF, 0x20, 0x81, 0x01, 0xB1, 0x08, 0x22, 0x01, 0x01, 0xB0, 0x00, 0xE2,
+0x01, 0x01, 0xD7, 0xFF, 0x40, 0x81, 0x01, 0xB9, 0x08, 0x44, 0x01, 0x01, 0xB8, 0x00, 0xE4, 0x01,
+0x01, 0xF1, 0x08, 0x20, 0x01, 0x02, 0x41, 0x08, 0x22, 0x41, 0x83, 0x05, 0x01, 0x01, 0xF8, 0x00,
+0xF0, 0x01, 0x83, 0x55, 0x01, 0xFF, 0xF2, 0x16, 0x20, 0x01, 0x02, 0x71, 0x08, 0x22, 0x41, 0x02,
+0x90, 0x00, 0xE2, 0x01, 0x02, 0x81, 0x08, 0x20, 0x01, 0x02, 0x71, 0x08, 0x34, 0x01, 0x02, 0x92,
+0x17, 0x22, 0x01, 0x02, 0x78, 0x00, 0xE2, 0x01, 0x02, 0x78, 0x00, 0xC0, 0x01, 0x02, 0x88, 0x00,
+0xF2, 0x01, 0x01, 0xB7, 0xFF, 0x20, 0x01, 0x02, 0x60, 0x00, 0xE2, 0x01, 0x01, 0xBF, 0xFF, 0x20,
+0x01, 0x02, 0x68, 0x00, 0xE2, 0x01, 0x02, 0x61, 0x08, 0x20, 0x01, 0xFF, 0x68, 0x00, 0x02, 0x01,
+0x02, 0x69, 0x08, 0x20, 0x01, 0xFF, 0x70, 0x00, 0x02, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00,
+0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01,
+0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83, 0x00, 0x01, 0x83,
+0x00, 0x01, 0x83, 0x00, 0x01, 0x84, 0x04, 0x01, 0x2C, 0x60, 0x00, 0x80, 0x84, 0x06, 0xFF, 0x00,
+0x02, 0x58, 0xBF, 0x00, 0x80, 0x84, 0x06, 0xFF, 0x00, 0x02, 0x58, 0xBF, 0x00, 0x80, 0x86, 0x00,
+0x80, 0x85, 0x01, 0xFF, 0x80, 0x84, 0x06, 0x03, 0x00, 0x02, 0x58, 0xBF, 0x00, 0x80, 0x82, 0x02,
+0x76, 0xE8, 0x45, 0x84, 0x02, 0x09, 0x80, 0xAF, 0x84, 0x02, 0x19, 0x99, 0x9A, 0x84, 0x00, 0x80,
+0x83, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xA1, 0x01, 0x18, 0x08, 0x8C, 0x00, 0x80, 0x85, 0x02, 0x01, 0x00, 0x1C, 
 };
 
 
+/**
+* @brief Function to load DSP firmware from the microcontroller flash memory
+*        by replaying the self-boot image. RAM the image doesn't cover is filled first,
+*        so the DSP ends up as if the full program and parameter arrays were loaded
+*
+* @param myDSP SigmaDSP object
+* @param ramCleared Set to true right after a DSP reset to skip zeroing the unused parameter RAM
+*/
+inline void loadProgram(SigmaDSP &myDSP, bool ramCleared = false)
+{
+  DSPStatsScope scope(myDSP.getStats(), StatsLoadProgram);
+  myDSP.loadSelfbootImage(DSP_eeprom_firmware, EE_SIZE, ramCleared);
+}
 
-/* Run this function to load DSP firmware directly */
-inline void loadProgram(SigmaDSP &myDSP)
+/**
+ * @brief Function to load DSP firmware from a stream (Serial, a file etc.)
+ *        instead of the microcontroller flash memory. The stream must hold the
+ *        core register R0, program, parameter, hardware configuration and core
+ *        register R4 data back to back, in that order
+ *
+ * @param myDSP SigmaDSP object
+ * @param stream Stream to read the firmware from
+ * @param ramCleared Set to true right after a DSP reset to skip all-zero RAM registers
+ * @return true if the whole firmware was read from the stream
+ */
+inline bool loadProgram(SigmaDSP &myDSP, Stream &stream, bool ramCleared = false)
 {
-  myDSP.writeRegisterBlock(CORE_REGISTER_R0_ADDR, CORE_REGISTER_R0_SIZE, DSP_core_register_R0_data, CORE_REGISTER_R0_REGSIZE);
-  myDSP.writeRegisterBlock(PROGRAM_ADDR, PROGRAM_SIZE, DSP_program_data, PROGRAM_REGSIZE);
-  myDSP.writeRegisterBlock(PARAMETER_ADDR, PARAMETER_SIZE, DSP_parameter_data, PARAMETER_REGSIZE);
-  myDSP.writeRegisterBlock(HARDWARE_CONF_ADDR, HARDWARE_CONF_SIZE, DSP_hardware_conf_data, HARDWARE_CONF_REGSIZE);
-  myDSP.writeRegisterBlock(CORE_REGISTER_R4_ADDR, CORE_REGISTER_R4_SIZE, DSP_core_register_R4_data, CORE_REGISTER_R4_REGSIZE);
+  DSPStatsScope scope(myDSP.getStats(), StatsLoadProgram);
+  return myDSP.writeRegisterBlock(CORE_REGISTER_R0_ADDR, CORE_REGISTER_R0_SIZE, stream, CORE_REGISTER_R0_SIZE)
+      && myDSP.writeRegisterBlock(PROGRAM_ADDR, PROGRAM_SIZE, stream, PROGRAM_REGSIZE, ramCleared)
+      && myDSP.writeRegisterBlock(PARAMETER_ADDR, PARAMETER_SIZE, stream, PARAMETER_REGSIZE, ramCleared)
+      && myDSP.writeRegisterBlock(HARDWARE_CONF_ADDR, HARDWARE_CONF_SIZE, stream, HARDWARE_CONF_SIZE)
+      && myDSP.writeRegisterBlock(CORE_REGISTER_R4_ADDR, CORE_REGISTER_R4_SIZE, stream, CORE_REGISTER_R4_SIZE);
 }
 
+/**
+ * @brief Function to load DSP firmware from the zero-run encoded DSP_firmware_rle[]
+ *        array. It takes up a fraction of the flash the plain arrays need
+ *
+ * @param myDSP SigmaDSP object
+ * @param ramCleared Set to true right after a DSP reset to skip all-zero RAM registers
+ * @return true if the whole firmware was loaded
+ */
+inline bool loadCompressedProgram(SigmaDSP &myDSP, bool ramCleared = false)
+{
+  DSPRLEStream stream(DSP_firmware_rle, DSP_FIRMWARE_RLE_SIZE);
+  return loadProgram(myDSP, stream, ramCleared);
+}
 
 #endif
@@ -0,0 +1,270 @@
+/*
+ * Host side accuracy report of the fixed-point coefficient designers.
+ * Sweeps every designer in DSPFilterDesign over its parameter range and compares
+ * the 5.23 words of the fixed-point path against the float path, converted the
+ * same way SigmaDSP::floatToFixed does. The compile-time designers in
+ * DSPConstDesign are compared against the float path as well.
+ *
+ * Build with CMake (target coefficient_accuracy) or directly:
+ * g++ -I../src coefficient_accuracy.cpp ../src/DSPFilterDesign.cpp ../src/DSPFixedPoint.cpp
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "DSPFilterDesign.h"
+#include "DSPConstDesign.h"
+
+#define SAMPLE_RATE 48000.0f
+
+// The sweeps below call the compile-time designers at runtime. These are evaluated by
+// the compiler, so a designer that isn't a valid constant expression fails the build.
+// A 0dB peaking filter is exactly 1, and b1 equals a1 for every peaking filter
+constexpr dspBiquadWords_t flatPeaking = dspConstSecondOrderEQ(parameters::filterType::peaking, 1000, SAMPLE_RATE, 1.41, 0);
+static_assert(flatPeaking.words[0] == 8388608 && flatPeaking.words[1] == -flatPeaking.words[3], "dspConstSecondOrderEQ");
+
+constexpr dspCompressorRMSWords_t limiter = dspConstCompressorRMS(-6, 10, 10, 0, 200, 0, SAMPLE_RATE);
+static_assert(limiter.words[0] == 8388608 && limiter.words[COMPRESSOR_RMS_WORDS - 3] == 8388608, "dspConstCompressorRMS");
+
+static const char *filterNames[] =
+{
+  "peaking", "parametric", "lowShelf", "highShelf", "lowpass", "highpass",
+  "bandpass", "bandstop", "butterworthLowpass", "butterworthHighpass",
+  "besselLowpass", "besselHighpass",
+};
+
+
+// Error statistics of one designer, in 5.23 LSBs
+struct Report
+{
+  const char *name;
+  uint32_t words;
+  uint32_t clipped;
+  int32_t maxError;
+  double sumError;
+  char worst[96];
+
+  Report(const char *blockName) : name(blockName), words(0), clipped(0), maxError(0), sumError(0) { worst[0] = 0; }
+
+  void add(const float *reference, const int32_t *fixed, uint8_t count, const char *setting)
+  {
+    for(uint8_t i = 0; i < count; i++)
+    {
+      // Words outside the 5.23 range are saturated by the fixed path and wrap
+      // around in the float path, so there is nothing to compare
+      if(fabs(reference[i]) >= 16.0f)
+      {
+        clipped++;
+        continue;
+      }
+
+      int32_t expected = reference[i] * ((int32_t)1 << 23);
+      int32_t error = labs(fixed[i] - expected);
+      words++;
+      sumError += error;
+      if(error > maxError)
+      {
+        maxError = error;
+        snprintf(worst, sizeof(worst), "%s word %u", setting, i);
+      }
+    }
+  }
+
+  void print() const
+  {
+    printf("%-22s %7u %7u %8d %9.3f   %s\n", name, words, clipped, maxError, words ? sumError / words : 0.0, worst);
+  }
+};
+
+
+int main()
+{
+  char setting[64];
+  float reference[COMPRESSOR_RMS_WORDS];
+  int32_t fixed[COMPRESSOR_RMS_WORDS];
+
+  printf("Fixed-point vs float coefficients at %.0f Hz, errors in 5.23 LSBs (1 LSB = %.3g)\n\n", SAMPLE_RATE, 1.0 / (1 << 23));
+  printf("%-22s %7s %7s %8s %9s   %s\n", "block", "words", "clipped", "max", "mean", "worst case");
+
+  // Second order EQ, all filter types over 20Hz - 20kHz
+  for(uint8_t type = parameters::filterType::peaking; type <= parameters::filterType::besselHighpass; type++)
+  {
+    Report report(filterNames[type]);
+    for(float freq = 20; freq <= 20000; freq *= 1.12f)
+    {
+      for(int8_t boost = -15; boost <= 15; boost += 3)
+      {
+        for(float width = 0.5f; width <= 4.0f; width *= 2)
+        {
+          secondOrderEQ_t eq;
+          eq.filterType = type;
+          eq.freq = freq;
+          eq.boost = boost;
+          eq.gain = boost / 3.0f;
+          eq.Q = width;
+          eq.S = width / 2;
+          eq.bandwidth = width / 2;
+          eq.phase = boost < 0 ? parameters::phase::inverted : parameters::phase::nonInverted;
+
+          dspSecondOrderEQ(eq, SAMPLE_RATE, reference);
+          dspSecondOrderEQ(eq, SAMPLE_RATE, fixed);
+          snprintf(setting, sizeof(setting), "%.0fHz %+ddB w=%.1f", freq, boost, width);
+          report.add(reference, fixed, 5, setting);
+        }
+      }
+    }
+    report.print();
+  }
+
+  // Tone control
+  Report tone("toneControl");
+  for(float bass = 40; bass <= 400; bass *= 1.25f)
+  {
+    for(float treble = 2000; treble <= 16000; treble *= 1.25f)
+    {
+      for(int8_t boost = -12; boost <= 12; boost += 3)
+      {
+        toneCtrl_t toneCtrl;
+        toneCtrl.freq_Bass = bass;
+        toneCtrl.freq_Treble = treble;
+        toneCtrl.boost_Bass_dB = boost;
+        toneCtrl.boost_Treble_dB = -boost / 2.0f;
+        toneCtrl.phase = boost < 0 ? parameters::phase::inverted : parameters::phase::nonInverted;
+
+        dspToneControl(toneCtrl, SAMPLE_RATE, reference);
+        dspToneControl(toneCtrl, SAMPLE_RATE, fixed);
+        snprintf(setting, sizeof(setting), "%.0f/%.0fHz %+ddB", bass, treble, boost);
+        tone.add(reference, fixed, 5, setting);
+      }
+    }
+  }
+  tone.print();
+
+  // Dynamic bass
+  Report bass("dynamicBass");
+  for(uint16_t freq = 20; freq <= 300; freq += 10)
+  {
+    for(uint8_t dB = 0; dB <= 20; dB += 2)
+    {
+      dspDynamicBass(dB, freq, SAMPLE_RATE, reference);
+      dspDynamicBass(dB, freq, SAMPLE_RATE, fixed);
+      snprintf(setting, sizeof(setting), "%uHz +%udB", freq, dB);
+      bass.add(reference, fixed, DYNAMIC_BASS_WORDS, setting);
+    }
+    for(int16_t threshold = -24; threshold <= 20; threshold += 4)
+    {
+      dspDynamicBassDetector(threshold, freq, SAMPLE_RATE, reference);
+      dspDynamicBassDetector(threshold, freq, SAMPLE_RATE, fixed);
+      snprintf(setting, sizeof(setting), "%+ddB %ums", threshold, freq);
+      bass.add(reference, fixed, 2, setting);
+    }
+  }
+  bass.print();
+
+  // Compressors
+  Report rms("compressorRMS");
+  Report peak("compressorPeak");
+  for(float threshold = -80; threshold <= 0; threshold += 8)
+  {
+    for(float ratio = 1; ratio <= 100; ratio *= 1.6f)
+    {
+      compressor_t compressor;
+      compressor.threshold = threshold;
+      compressor.ratio = ratio;
+      compressor.rms_tc = 1 + ratio * 4;
+      compressor.hold = ratio / 10;
+      compressor.decay = 10 + ratio * 15;
+      compressor.postgain = threshold / 5 + 6;
+
+      snprintf(setting, sizeof(setting), "%.0fdB 1:%.1f", threshold, ratio);
+      dspCompressorRMS(compressor, SAMPLE_RATE, reference);
+      dspCompressorRMS(compressor, SAMPLE_RATE, fixed);
+      rms.add(reference, fixed, COMPRESSOR_RMS_WORDS, setting);
+      dspCompressorPeak(compressor, SAMPLE_RATE, reference);
+      dspCompressorPeak(compressor, SAMPLE_RATE, fixed);
+      peak.add(reference, fixed, COMPRESSOR_PEAK_WORDS, setting);
+    }
+  }
+  rms.print();
+  peak.print();
+
+  // Compile-time designers, evaluated at runtime here to sweep them
+  printf("\nCompile-time designers vs float\n\n");
+  printf("%-22s %7s %7s %8s %9s   %s\n", "block", "words", "clipped", "max", "mean", "worst case");
+
+  Report constFirst("constFirstOrderEQ");
+  Report constSecond("constSecondOrderEQ");
+  Report constRMS("constCompressorRMS");
+  Report constPeak("constCompressorPeak");
+  for(float freq = 20; freq <= 20000; freq *= 1.12f)
+  {
+    for(int8_t boost = -15; boost <= 15; boost += 3)
+    {
+      uint8_t phase = boost < 0 ? parameters::phase::inverted : parameters::phase::nonInverted;
+      for(uint8_t type = parameters::filterType::lowpass; type <= parameters::filterType::highpass; type++)
+      {
+        firstOrderEQ_t eq;
+        eq.filterType = type;
+        eq.freq = freq;
+        eq.gain = boost;
+        eq.phase = phase;
+
+        dspFirstOrderEQ(eq, SAMPLE_RATE, reference);
+        dspFirstOrderWords_t words = dspConstFirstOrderEQ(type, freq, SAMPLE_RATE, boost, phase);
+        snprintf(setting, sizeof(setting), "%s %.0fHz %+ddB", filterNames[type], freq, boost);
+        constFirst.add(reference, words.words, 3, setting);
+      }
+
+      for(uint8_t type = parameters::filterType::peaking; type <= parameters::filterType::besselHighpass; type++)
+      {
+        for(float width = 0.5f; width <= 4.0f; width *= 2)
+        {
+          secondOrderEQ_t eq;
+          eq.filterType = type;
+          eq.freq = freq;
+          eq.boost = boost;
+          eq.gain = boost / 3.0f;
+          eq.Q = width;
+          eq.S = width / 2;
+          eq.bandwidth = width / 2;
+          eq.phase = phase;
+
+          bool shelf = type == parameters::filterType::lowShelf || type == parameters::filterType::highShelf;
+          bool band = type == parameters::filterType::bandpass || type == parameters::filterType::bandstop;
+          dspSecondOrderEQ(eq, SAMPLE_RATE, reference);
+          dspBiquadWords_t words = dspConstSecondOrderEQ(type, freq, SAMPLE_RATE, shelf ? eq.S : band ? eq.bandwidth : eq.Q, boost, eq.gain, phase);
+          snprintf(setting, sizeof(setting), "%s %.0fHz %+ddB w=%.1f", filterNames[type], freq, boost, width);
+          constSecond.add(reference, words.words, 5, setting);
+        }
+      }
+    }
+  }
+
+  for(float threshold = -80; threshold <= 0; threshold += 8)
+  {
+    for(float ratio = 1; ratio <= 100; ratio *= 1.6f)
+    {
+      compressor_t compressor;
+      compressor.threshold = threshold;
+      compressor.ratio = ratio;
+      compressor.rms_tc = 1 + ratio * 4;
+      compressor.hold = ratio / 10;
+      compressor.decay = 10 + ratio * 15;
+      compressor.postgain = threshold / 5 + 6;
+
+      snprintf(setting, sizeof(setting), "%.0fdB 1:%.1f", threshold, ratio);
+      dspCompressorRMS(compressor, SAMPLE_RATE, reference);
+      dspCompressorRMSWords_t rmsWords = dspConstCompressorRMS(threshold, ratio, compressor.rms_tc, compressor.hold, compressor.decay, compressor.postgain, SAMPLE_RATE);
+      constRMS.add(reference, rmsWords.words, COMPRESSOR_RMS_WORDS, setting);
+      dspCompressorPeak(compressor, SAMPLE_RATE, reference);
+      dspCompressorPeakWords_t peakWords = dspConstCompressorPeak(threshold, ratio, compressor.hold, compressor.decay, compressor.postgain, SAMPLE_RATE);
+      constPeak.add(reference, peakWords.words, COMPRESSOR_PEAK_WORDS, setting);
+    }
+  }
+  constFirst.print();
+  constSecond.print();
+  constRMS.print();
+  constPeak.print();
+
+  return 0;
+}
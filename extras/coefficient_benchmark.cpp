@@ -0,0 +1,296 @@
+/*
+ * Host side benchmark of the EQ coefficient designers. For every filter type it
+ * times the original second order design (sin/cos/sqrt called in every branch),
+ * the shared-trig designer, its fast approximation mode and the fixed-point
+ * designer, and reports the largest coefficient difference to the original
+ * in 5.23 LSBs.
+ *
+ * Build with CMake (target coefficient_benchmark) or directly:
+ * g++ -O2 -I../src coefficient_benchmark.cpp ../src/DSPFilterDesign.cpp ../src/DSPFixedPoint.cpp
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include "DSPFilterDesign.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+  #define BENCH_UNIT "cycles"
+  static inline uint64_t benchClock() { return __rdtsc(); }
+#else
+  #define BENCH_UNIT "ns"
+  static inline uint64_t benchClock()
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+#endif
+
+#ifndef PI
+  #define PI 3.1415926535897932384626433832795
+#endif
+
+#define SAMPLE_RATE 48000.0f
+#define SETTINGS    256
+#define REPEATS     40
+
+static const char *filterNames[] =
+{
+  "peaking", "parametric", "lowShelf", "highShelf", "lowpass", "highpass",
+  "bandpass", "bandstop", "butterworthLowpass", "butterworthHighpass",
+  "besselLowpass", "besselHighpass",
+};
+
+volatile float floatSink;
+volatile int32_t fixedSink;
+
+
+/**
+ * @brief The second order design as it was before the shared-trig designer,
+ *        every branch calls the math library for each term
+ */
+static void legacySecondOrderEQ(const secondOrderEQ_t &equalizer, float fs, float *coefficients)
+{
+  float A, w0, alpha, gainLinear;
+  float b0, b1, b2, a0, a1, a2;
+
+  A=pow(10,(equalizer.boost/40));
+  w0=2*PI*equalizer.freq/fs;
+  gainLinear = pow(10,(equalizer.gain/20));
+
+  switch(equalizer.filterType)
+  {
+    case parameters::filterType::parametric:
+    case parameters::filterType::peaking:
+    default:
+      alpha = sin(w0)/(2*equalizer.Q);
+      a0 =  1 + alpha/A;
+      a1 = -2 * cos(w0);
+      a2 =  1 - alpha/A;
+      b0 = (1 + alpha*A) * gainLinear;
+      b1 = -(2 * cos(w0)) * gainLinear;
+      b2 = (1 - alpha*A) * gainLinear;
+      break;
+    case parameters::filterType::lowShelf:
+      alpha=sin(w0)/2*sqrt((A+1/A)*(1/equalizer.S-1)+2);
+      a0 = (A+1)+(A-1)*cos(w0)+2*sqrt(A)*alpha;
+      a1 = -2*((A-1)+(A+1)*cos(w0));
+      a2 = (A+1)+(A-1)*cos(w0)-2*sqrt(A)*alpha;
+      b0 = A*((A+1)-(A-1)*cos(w0)+2*sqrt(A)*alpha)*gainLinear;
+      b1 = 2*A*((A-1)-(A+1)*cos(w0)) * gainLinear;
+      b2 = A*((A+1)-(A-1)*cos(w0)-2*sqrt(A)*alpha)*gainLinear;
+      break;
+    case parameters::filterType::highShelf:
+      alpha = sin(w0)/2 * sqrt((A + 1/A)*(1/equalizer.S - 1) + 2);
+      a0 = (A+1) - (A-1)*cos(w0) + 2*sqrt(A)*alpha;
+      a1 = 2*((A-1) - (A+1)*cos(w0));
+      a2 = (A+1) - (A-1)*cos(w0) - 2*sqrt(A)*alpha;
+      b0 = A*((A+1) + (A-1)*cos(w0) + 2*sqrt(A)*alpha) * gainLinear;
+      b1 = -2*A*((A-1) + (A+1)*cos(w0)) * gainLinear;
+      b2 = A*((A+1) + (A-1)*cos(w0) - 2*sqrt(A)*alpha) * gainLinear;
+      break;
+    case parameters::filterType::lowpass:
+      alpha = sin(w0)/(2*equalizer.Q);
+      a0 = 1 + alpha;
+      a1 = -2*cos(w0);
+      a2 = 1 - alpha;
+      b0 = (1 - cos(w0)) * (gainLinear/2);
+      b1 = (1 - cos(w0))  * gainLinear;
+      b2 = (1 - cos(w0)) * (gainLinear/2);
+      break;
+    case parameters::filterType::highpass:
+      alpha = sin(w0)/(2*equalizer.Q);
+      a0 = 1 + alpha;
+      a1 = -2*cos(w0);
+      a2 = 1 - alpha;
+      b0 = (1 + cos(w0)) * (gainLinear/2);
+      b1 = -(1 + cos(w0)) * gainLinear;
+      b2 = (1 + cos(w0)) * (gainLinear/2);
+      break;
+    case parameters::filterType::bandpass:
+      alpha = sin(w0) * sinh(log(2)/(2 * equalizer.bandwidth * w0/sin(w0)));
+      a0 = 1 + alpha;
+      a1 = -2*cos(w0);
+      a2 = 1 - alpha;
+      b0 = alpha * gainLinear;
+      b1 = 0;
+      b2 = -alpha * gainLinear;
+      break;
+    case parameters::filterType::bandstop:
+      alpha = sin(w0) * sinh(log(2)/(2 * equalizer.bandwidth * w0/sin(w0)));
+      a0 = 1 + alpha;
+      a1 = -2*cos(w0);
+      a2 = 1 - alpha;
+      b0 = 1 * gainLinear;
+      b1 = -2*cos(w0) * gainLinear;
+      b2 = 1 * gainLinear;
+      break;
+    case parameters::filterType::butterworthLowpass:
+      alpha = sin(w0) / 2.0 * 1/sqrt(2);
+      a0 = 1 + alpha;
+      a1 = -2*cos(w0);
+      a2 = 1 - alpha;
+      b0 = (1 - cos(w0)) * gainLinear / 2;
+      b1 = (1 - cos(w0)) * gainLinear;
+      b2 = (1 - cos(w0)) * gainLinear / 2;
+      break;
+    case parameters::filterType::butterworthHighpass:
+      alpha = sin(w0) / 2.0 * 1/sqrt(2);
+      a0 = 1 + alpha;
+      a1 = -2*cos(w0);
+      a2 = 1 - alpha;
+      b0 = (1 + cos(w0)) * gainLinear / 2;
+      b1 = -(1 + cos(w0)) * gainLinear;
+      b2 = (1 + cos(w0)) * gainLinear / 2;
+      break;
+    case parameters::filterType::besselLowpass:
+      alpha = sin(w0) / 2.0 * 1/sqrt(3) ;
+      a0 = 1 + alpha;
+      a1 = -2*cos(w0);
+      a2 = 1 - alpha;
+      b0 = (1 - cos(w0)) * gainLinear / 2;
+      b1 = (1 - cos(w0)) * gainLinear;
+      b2 = (1 - cos(w0)) * gainLinear / 2;
+      break;
+    case parameters::filterType::besselHighpass:
+      alpha = sin(w0) / 2.0 * 1/sqrt(3) ;
+      a0 = 1 + alpha;
+      a1 = -2*cos(w0);
+      a2 = 1 - alpha;
+      b0 = (1 + cos(w0)) * gainLinear / 2;
+      b1 = -(1 + cos(w0)) * gainLinear;
+      b2 = (1 + cos(w0)) * gainLinear / 2;
+      break;
+  }
+
+  coefficients[0] = b0/a0;
+  coefficients[1] = b1/a0;
+  coefficients[2] = b2/a0;
+  coefficients[3] = -1*a1/a0;
+  coefficients[4] = -1*a2/a0;
+}
+
+
+/**
+ * @brief Largest difference between two coefficient sets in 5.23 LSBs. Words
+ *        outside the 5.23 range are skipped
+ */
+static int32_t errorLSB(const float *reference, const float *value, uint8_t count)
+{
+  int32_t maxError = 0;
+  for(uint8_t i = 0; i < count; i++)
+  {
+    if(fabs(reference[i]) >= 16.0f)
+      continue;
+    int32_t error = labs((int32_t)(value[i] * ((int32_t)1 << 23)) - (int32_t)(reference[i] * ((int32_t)1 << 23)));
+    if(error > maxError)
+      maxError = error;
+  }
+  return maxError;
+}
+
+
+static int32_t errorLSB(const float *reference, const int32_t *value, uint8_t count)
+{
+  int32_t maxError = 0;
+  for(uint8_t i = 0; i < count; i++)
+  {
+    if(fabs(reference[i]) >= 16.0f)
+      continue;
+    int32_t error = labs(value[i] - (int32_t)(reference[i] * ((int32_t)1 << 23)));
+    if(error > maxError)
+      maxError = error;
+  }
+  return maxError;
+}
+
+
+// Times a designer over all settings and returns the average per design
+template <typename Design>
+static double timeDesign(Design design)
+{
+  uint64_t start = benchClock();
+  for(uint16_t r = 0; r < REPEATS; r++)
+    for(uint16_t i = 0; i < SETTINGS; i++)
+      design(i);
+  return (double)(benchClock() - start) / (REPEATS * SETTINGS);
+}
+
+
+int main()
+{
+  static secondOrderEQ_t settings[SETTINGS];
+  float reference[5], value[5];
+  int32_t fixed[5];
+
+  printf("Second order EQ designers at %.0f Hz, %d settings per type, time in %s per design\n", SAMPLE_RATE, SETTINGS, BENCH_UNIT);
+  printf("Errors are the largest coefficient difference to the original design in 5.23 LSBs\n\n");
+  printf("%-20s %9s %9s %9s %9s   %6s %6s %6s\n", "type", "original", "shared", "fast", "fixed", "shared", "fast", "fixed");
+
+  for(uint8_t type = parameters::filterType::peaking; type <= parameters::filterType::besselHighpass; type++)
+  {
+    // Log spaced 20Hz - 20kHz with varying boost and width
+    for(uint16_t i = 0; i < SETTINGS; i++)
+    {
+      secondOrderEQ_t &eq = settings[i];
+      eq.filterType = type;
+      eq.freq = 20 * pow(1000, i / (float)SETTINGS);
+      eq.boost = (int8_t)(i % 31) - 15;
+      eq.gain = eq.boost / 3;
+      eq.Q = 0.5f + (i % 7);
+      eq.S = 0.25f + (i % 7) * 0.25f;
+      eq.bandwidth = 0.25f + (i % 7) * 0.5f;
+    }
+
+    int32_t sharedError = 0, fastError = 0, fixedError = 0;
+    for(uint16_t i = 0; i < SETTINGS; i++)
+    {
+      legacySecondOrderEQ(settings[i], SAMPLE_RATE, reference);
+      dspSecondOrderEQ(settings[i], SAMPLE_RATE, value);
+      int32_t error = errorLSB(reference, value, 5);
+      sharedError = error > sharedError ? error : sharedError;
+      dspSecondOrderEQFast(settings[i], SAMPLE_RATE, value);
+      error = errorLSB(reference, value, 5);
+      fastError = error > fastError ? error : fastError;
+      dspSecondOrderEQ(settings[i], SAMPLE_RATE, fixed);
+      error = errorLSB(reference, fixed, 5);
+      fixedError = error > fixedError ? error : fixedError;
+    }
+
+    double original = timeDesign([&](uint16_t i) { legacySecondOrderEQ(settings[i], SAMPLE_RATE, value); floatSink = value[0]; });
+    double shared   = timeDesign([&](uint16_t i) { dspSecondOrderEQ(settings[i], SAMPLE_RATE, value); floatSink = value[0]; });
+    double fast     = timeDesign([&](uint16_t i) { dspSecondOrderEQFast(settings[i], SAMPLE_RATE, value); floatSink = value[0]; });
+    double fixedPt  = timeDesign([&](uint16_t i) { dspSecondOrderEQ(settings[i], SAMPLE_RATE, fixed); fixedSink = fixed[0]; });
+
+    printf("%-20s %9.0f %9.0f %9.0f %9.0f   %6d %6d %6d\n", filterNames[type], original, shared, fast, fixedPt, sharedError, fastError, fixedError);
+  }
+
+  // First order EQ, lowpass and highpass
+  static firstOrderEQ_t firstOrder[SETTINGS];
+  for(uint16_t i = 0; i < SETTINGS; i++)
+  {
+    firstOrder[i].filterType = (i & 1) ? parameters::filterType::highpass : parameters::filterType::lowpass;
+    firstOrder[i].freq = 20 * pow(1000, i / (float)SETTINGS);
+    firstOrder[i].gain = (int8_t)(i % 31) - 15;
+  }
+
+  int32_t fastError = 0, fixedError = 0;
+  for(uint16_t i = 0; i < SETTINGS; i++)
+  {
+    dspFirstOrderEQ(firstOrder[i], SAMPLE_RATE, reference);
+    dspFirstOrderEQFast(firstOrder[i], SAMPLE_RATE, value);
+    int32_t error = errorLSB(reference, value, 3);
+    fastError = error > fastError ? error : fastError;
+    dspFirstOrderEQ(firstOrder[i], SAMPLE_RATE, fixed);
+    error = errorLSB(reference, fixed, 3);
+    fixedError = error > fixedError ? error : fixedError;
+  }
+
+  double original = timeDesign([&](uint16_t i) { dspFirstOrderEQ(firstOrder[i], SAMPLE_RATE, value); floatSink = value[0]; });
+  double fast     = timeDesign([&](uint16_t i) { dspFirstOrderEQFast(firstOrder[i], SAMPLE_RATE, value); floatSink = value[0]; });
+  double fixedPt  = timeDesign([&](uint16_t i) { dspFirstOrderEQ(firstOrder[i], SAMPLE_RATE, fixed); fixedSink = fixed[0]; });
+  printf("%-20s %9.0f %9s %9.0f %9.0f   %6s %6d %6d\n", "first order", original, "-", fast, fixedPt, "-", fastError, fixedError);
+
+  return 0;
+}
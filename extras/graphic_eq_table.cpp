@@ -0,0 +1,153 @@
+/*
+ * Generates a PROGMEM table of graphic EQ coefficients for SigmaDSP::graphicEQ().
+ * Every band is a peaking filter at an ISO centre frequency, every gain step of
+ * every band is designed in advance, so moving a fader on the MCU is a table
+ * lookup instead of sin, cos and pow. The words are calculated on the host with
+ * the float dspSecondOrderEQ(), the designer EQsecondOrder() uses in the default
+ * build, so a table write matches EQsecondOrder() up to the rounding of the MCU's
+ * math library. With SIGMADSP_FAST_MATH or SIGMADSP_FIXED_POINT_COEFFICIENTS,
+ * EQsecondOrder() designs differently and the words differ by up to 3 LSBs.
+ * The table is only valid at the sample rate it was generated for, GRAPHIC_EQ_FS,
+ * which has to match the fs the SigmaDSP object was constructed with.
+ *
+ * Usage: graphic_eq_table [third|octave] [fs] [Q] [range dB] [step dB] > SigmaDSP_graphicEQ.h
+ * Defaults: third 48000 4.32 12 1, a 31 band 1/3 octave EQ from -12 to +12dB in 1dB steps
+ *
+ * Build with CMake (target graphic_eq_table) or directly:
+ * g++ -I../src graphic_eq_table.cpp ../src/DSPFilterDesign.cpp ../src/DSPFixedPoint.cpp
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "DSPFilterDesign.h"
+
+// ISO 266 preferred centre frequencies
+static const float thirdOctaveBands[] =
+{
+  20, 25, 31.5, 40, 50, 63, 80, 100, 125, 160, 200, 250, 315, 400, 500, 630,
+  800, 1000, 1250, 1600, 2000, 2500, 3150, 4000, 5000, 6300, 8000, 10000,
+  12500, 16000, 20000,
+};
+
+static const float octaveBands[] =
+{
+  31.5, 63, 125, 250, 500, 1000, 2000, 4000, 8000, 16000,
+};
+
+
+// Gain of a table entry in [dB]. Entries are counted from the centre, so the middle one is exactly 0dB
+static float stepGain(int index, int halfSteps, float step)
+{
+  return (index - halfSteps) * step;
+}
+
+
+int main(int argc, char *argv[])
+{
+  const float *bands = thirdOctaveBands;
+  uint8_t bandCount = sizeof(thirdOctaveBands) / sizeof(thirdOctaveBands[0]);
+  const char *spacing = argc > 1 ? argv[1] : "third";
+  float fs    = argc > 2 ? atof(argv[2]) : 48000;
+  float Q     = argc > 3 ? atof(argv[3]) : 4.32f;
+  float range = argc > 4 ? atof(argv[4]) : 12;
+  float step  = argc > 5 ? atof(argv[5]) : 1;
+
+  if(strcmp(spacing, "octave") == 0)
+  {
+    bands = octaveBands;
+    bandCount = sizeof(octaveBands) / sizeof(octaveBands[0]);
+  }
+  else if(strcmp(spacing, "third") != 0)
+  {
+    fprintf(stderr, "Usage: %s [third|octave] [fs] [Q] [range dB] [step dB]\n", argv[0]);
+    return 1;
+  }
+
+  // Bands at or above Nyquist can't be designed
+  while(bandCount > 0 && bands[bandCount - 1] >= fs / 2)
+    bandCount--;
+
+  if(fs <= 0 || Q <= 0 || step <= 0 || range < 0 || bandCount == 0)
+  {
+    fprintf(stderr, "Invalid settings\n");
+    return 1;
+  }
+
+  // The table has to hit 0dB exactly, or a band can't be set flat
+  int halfSteps = (int)(range / step + 0.5f);
+  if(fabsf(halfSteps * step - range) > 1e-4f * step)
+  {
+    fprintf(stderr, "The range (%g dB) has to be a multiple of the step (%g dB)\n", range, step);
+    return 1;
+  }
+
+  int steps = 2 * halfSteps + 1;
+  if(steps > 255)
+  {
+    fprintf(stderr, "Invalid settings, at most 255 gain steps are supported\n");
+    return 1;
+  }
+
+  // Step index of the entry that is exactly 0dB
+  int flatStep = 0;
+  while(stepGain(flatStep, halfSteps, step) != 0)
+    flatStep++;
+
+  printf("/*\n");
+  printf(" * Graphic EQ coefficient table generated by extras/graphic_eq_table.cpp\n");
+  printf(" * %s octave bands, fs = %.0f Hz, Q = %.2f, %+.1f to %+.1f dB in %.1f dB steps\n",
+         bands == octaveBands ? "1/1" : "1/3", fs, Q, -range, range, step);
+  printf(" * %u bands x %d steps x 5 words = %lu bytes of flash\n", bandCount, steps, (unsigned long)bandCount * steps * 5 * 4);
+  printf(" *\n");
+  printf(" * dsp.setGraphicEQTable(graphicEQTable, GRAPHIC_EQ_BANDS, GRAPHIC_EQ_STEPS, GRAPHIC_EQ_FS);\n");
+  printf(" * dsp.graphicEQ(MOD_[EQ]_ALG0_STAGE0_B0_ADDR, band, GRAPHIC_EQ_FLAT_STEP);\n");
+  printf(" */\n\n");
+
+  printf("#ifndef SIGMADSP_GRAPHICEQ_H\n");
+  printf("#define SIGMADSP_GRAPHICEQ_H\n\n");
+  printf("#include <Arduino.h>\n\n");
+
+  printf("#define GRAPHIC_EQ_FS        %.2ff  // Has to match the fs of the SigmaDSP object\n", fs);
+  printf("#define GRAPHIC_EQ_BANDS     %u\n", bandCount);
+  printf("#define GRAPHIC_EQ_STEPS     %d\n", steps);
+  printf("#define GRAPHIC_EQ_FLAT_STEP %d  // Step index of 0dB\n", flatStep);
+  printf("#define GRAPHIC_EQ_MIN_DB    %.1f\n", stepGain(0, halfSteps, step));
+  printf("#define GRAPHIC_EQ_STEP_DB   %.1f\n\n", step);
+
+  printf("// Centre frequency of each band in [Hz]\n");
+  printf("const float graphicEQFrequencies[GRAPHIC_EQ_BANDS] PROGMEM =\n{");
+  for(uint8_t band = 0; band < bandCount; band++)
+    printf("%s %g,", band % 8 == 0 ? "\n " : "", bands[band]);
+  printf("\n};\n\n");
+
+  printf("// b0, b1, b2, -a1, -a2 5.23 words of every band and gain step\n");
+  printf("const int32_t graphicEQTable[GRAPHIC_EQ_BANDS * GRAPHIC_EQ_STEPS * 5] PROGMEM =\n{\n");
+  for(uint8_t band = 0; band < bandCount; band++)
+  {
+    printf("  // %g Hz\n", bands[band]);
+    for(int i = 0; i < steps; i++)
+    {
+      secondOrderEQ_t eq;
+      eq.filterType = parameters::filterType::peaking;
+      eq.freq = bands[band];
+      eq.Q = Q;
+      eq.boost = stepGain(i, halfSteps, step);
+      eq.gain = 0;
+
+      float coefficients[5];
+      dspSecondOrderEQ(eq, fs, coefficients);
+
+      // Converted the same way as SigmaDSP::floatToFixed
+      printf(" ");
+      for(uint8_t k = 0; k < 5; k++)
+        printf(" %ld,", (long)(int32_t)(coefficients[k] * ((int32_t)1 << 23)));
+      printf(" // %+.1f dB\n", eq.boost);
+    }
+  }
+  printf("};\n\n");
+  printf("#endif\n");
+
+  return 0;
+}
@@ -0,0 +1,12 @@
+#ifndef DSPCRC32_H
+#define DSPCRC32_H
+
+#include "DSPPlatform.h"
+#include <stdint.h>
+
+// CRC-32 (IEEE 802.3, same as zlib). Start with crc = 0 and pass the
+// previous result back in to continue over several blocks
+uint32_t dspCrc32(uint32_t crc, const uint8_t *data, uint16_t length);
+uint32_t dspCrc32_P(uint32_t crc, const uint8_t *data, uint16_t length);
+
+#endif
@@ -0,0 +1,290 @@
+#include "DSPCoefficientCache.h"
+#include "DSPCRC32.h"
+
+// Block types, hashed first so equal settings of different blocks get different keys
+#define CACHE_FIRST_ORDER_EQ   0x01
+#define CACHE_SECOND_ORDER_EQ  0x02
+#define CACHE_TONE_CONTROL     0x03
+#define CACHE_DYNAMIC_BASS     0x04
+#define CACHE_DYNAMIC_BASS_DET 0x05
+
+/**
+ * @brief Constructs a new DSPCache object on top of the passed storage.
+ *        The storage is cleared, each entry needs a distinct age for the LRU order
+ *
+ * @param entries Entry storage
+ * @param size Number of entries in the storage
+ */
+DSPCache::DSPCache(dspCacheEntry_t *entries, uint8_t size)
+  : _entries(entries), _size(size), _hits(0), _misses(0)
+{
+  clear();
+}
+
+
+/**
+ * @brief Drops all cached entries. The hit and miss counters are kept
+ */
+void DSPCache::clear()
+{
+  for(uint8_t i = 0; i < _size; i++)
+  {
+    _entries[i].count = 0;
+    _entries[i].age = i;
+  }
+}
+
+
+/**
+ * @brief Looks up the words of a parameter set and marks the entry as most recently used
+ *
+ * @param key Key of the parameter set, see key()
+ * @param words Array to copy the cached words to
+ * @param count Number of words expected
+ * @return true if the words were found, false on a miss
+ */
+bool DSPCache::lookup(const dspCacheKey_t &key, int32_t *words, uint8_t count)
+{
+  for(uint8_t i = 0; i < _size; i++)
+  {
+    if(_entries[i].count == count && _entries[i].key.crc == key.crc && _entries[i].key.check == key.check)
+    {
+      for(uint8_t j = 0; j < count; j++)
+        words[j] = _entries[i].words[j];
+      touch(i);
+      _hits++;
+      return true;
+    }
+  }
+
+  _misses++;
+  return false;
+}
+
+
+/**
+ * @brief Stores the words of a parameter set, replacing the least recently used entry
+ *
+ * @param key Key of the parameter set, see key()
+ * @param words Words to cache
+ * @param count Number of words, up to CACHE_MAX_WORDS
+ */
+void DSPCache::store(const dspCacheKey_t &key, const int32_t *words, uint8_t count)
+{
+  if(_size == 0 || count == 0 || count > CACHE_MAX_WORDS)
+    return;
+
+  // The oldest entry goes. Used entries always hold the lowest ages, so free slots go first
+  uint8_t victim = 0;
+  for(uint8_t i = 1; i < _size; i++)
+  {
+    if(_entries[i].age > _entries[victim].age)
+      victim = i;
+  }
+
+  _entries[victim].key = key;
+  _entries[victim].count = count;
+  for(uint8_t i = 0; i < count; i++)
+    _entries[victim].words[i] = words[i];
+  touch(victim);
+}
+
+
+/**
+ * @brief Returns the number of lookups that found their words
+ *
+ * @return uint32_t number of cache hits
+ */
+uint32_t DSPCache::hits() const
+{
+  return _hits;
+}
+
+
+/**
+ * @brief Returns the number of lookups that had to be calculated
+ *
+ * @return uint32_t number of cache misses
+ */
+uint32_t DSPCache::misses() const
+{
+  return _misses;
+}
+
+
+/**
+ * @brief Resets the hit and miss counters
+ */
+void DSPCache::resetCounters()
+{
+  _hits = 0;
+  _misses = 0;
+}
+
+
+/**
+ * @brief Returns the number of occupied entries
+ *
+ * @return uint8_t number of cached parameter sets
+ */
+uint8_t DSPCache::used() const
+{
+  uint8_t used = 0;
+  for(uint8_t i = 0; i < _size; i++)
+  {
+    if(_entries[i].count != 0)
+      used++;
+  }
+  return used;
+}
+
+
+/**
+ * @brief Calculates the key of a first order EQ setting
+ *
+ * @param equalizer Equalizer parameter struct
+ * @param fs Sample rate in [Hz]
+ * @return dspCacheKey_t cache key
+ */
+dspCacheKey_t DSPCache::key(const firstOrderEQ_t &equalizer, float fs)
+{
+  dspCacheKey_t cacheKey = start(CACHE_FIRST_ORDER_EQ);
+  hash(cacheKey, &equalizer.freq, sizeof(equalizer.freq));
+  hash(cacheKey, &equalizer.gain, sizeof(equalizer.gain));
+  hash(cacheKey, &equalizer.filterType, 1);
+  hash(cacheKey, &equalizer.phase, 1);
+  hash(cacheKey, &equalizer.state, 1);
+  hash(cacheKey, &fs, sizeof(fs));
+  return cacheKey;
+}
+
+
+/**
+ * @brief Calculates the key of a second order EQ setting
+ *
+ * @param equalizer Equalizer parameter struct
+ * @param fs Sample rate in [Hz]
+ * @return dspCacheKey_t cache key
+ */
+dspCacheKey_t DSPCache::key(const secondOrderEQ_t &equalizer, float fs)
+{
+  dspCacheKey_t cacheKey = start(CACHE_SECOND_ORDER_EQ);
+  hash(cacheKey, &equalizer.Q, sizeof(equalizer.Q));
+  hash(cacheKey, &equalizer.S, sizeof(equalizer.S));
+  hash(cacheKey, &equalizer.bandwidth, sizeof(equalizer.bandwidth));
+  hash(cacheKey, &equalizer.boost, sizeof(equalizer.boost));
+  hash(cacheKey, &equalizer.freq, sizeof(equalizer.freq));
+  hash(cacheKey, &equalizer.gain, sizeof(equalizer.gain));
+  hash(cacheKey, &equalizer.filterType, 1);
+  hash(cacheKey, &equalizer.phase, 1);
+  hash(cacheKey, &equalizer.state, 1);
+  hash(cacheKey, &fs, sizeof(fs));
+  return cacheKey;
+}
+
+
+/**
+ * @brief Calculates the key of a tone control setting
+ *
+ * @param toneCtrl Tone control parameter struct
+ * @param fs Sample rate in [Hz]
+ * @return dspCacheKey_t cache key
+ */
+dspCacheKey_t DSPCache::key(const toneCtrl_t &toneCtrl, float fs)
+{
+  dspCacheKey_t cacheKey = start(CACHE_TONE_CONTROL);
+  hash(cacheKey, &toneCtrl.boost_Bass_dB, sizeof(toneCtrl.boost_Bass_dB));
+  hash(cacheKey, &toneCtrl.boost_Treble_dB, sizeof(toneCtrl.boost_Treble_dB));
+  hash(cacheKey, &toneCtrl.freq_Bass, sizeof(toneCtrl.freq_Bass));
+  hash(cacheKey, &toneCtrl.freq_Treble, sizeof(toneCtrl.freq_Treble));
+  hash(cacheKey, &toneCtrl.phase, 1);
+  hash(cacheKey, &toneCtrl.state, 1);
+  hash(cacheKey, &fs, sizeof(fs));
+  return cacheKey;
+}
+
+
+/**
+ * @brief Calculates the key of a dynamic bass boost filter setting
+ *
+ * @param dB Boost level in dB
+ * @param frequency Center frequency of the boost filter in [Hz]
+ * @param fs Sample rate in [Hz]
+ * @return dspCacheKey_t cache key
+ */
+dspCacheKey_t DSPCache::dynamicBassKey(float dB, uint16_t frequency, float fs)
+{
+  dspCacheKey_t cacheKey = start(CACHE_DYNAMIC_BASS);
+  hash(cacheKey, &dB, sizeof(dB));
+  hash(cacheKey, &frequency, sizeof(frequency));
+  hash(cacheKey, &fs, sizeof(fs));
+  return cacheKey;
+}
+
+
+/**
+ * @brief Calculates the key of a dynamic bass detector setting
+ *
+ * @param threshold Detector threshold in dB
+ * @param time_constant RMS time constant in [ms]
+ * @param fs Sample rate in [Hz]
+ * @return dspCacheKey_t cache key
+ */
+dspCacheKey_t DSPCache::detectorKey(int16_t threshold, uint16_t time_constant, float fs)
+{
+  dspCacheKey_t cacheKey = start(CACHE_DYNAMIC_BASS_DET);
+  hash(cacheKey, &threshold, sizeof(threshold));
+  hash(cacheKey, &time_constant, sizeof(time_constant));
+  hash(cacheKey, &fs, sizeof(fs));
+  return cacheKey;
+}
+
+
+/**
+ * @brief Makes an entry the most recently used one
+ *
+ * @param index Entry to move to the front
+ */
+void DSPCache::touch(uint8_t index)
+{
+  uint8_t age = _entries[index].age;
+  for(uint8_t i = 0; i < _size; i++)
+  {
+    if(_entries[i].age < age)
+      _entries[i].age++;
+  }
+  _entries[index].age = 0;
+}
+
+
+/**
+ * @brief Starts a key with the block type
+ *
+ * @param type Block type, CACHE_*
+ * @return dspCacheKey_t key over the block type
+ */
+dspCacheKey_t DSPCache::start(uint8_t type)
+{
+  dspCacheKey_t key;
+  key.crc = 0;
+  key.check = 2166136261UL; // FNV-1a offset basis
+  hash(key, &type, 1);
+  return key;
+}
+
+
+/**
+ * @brief Continues both key hashes over one field. Fields are hashed one by one,
+ *        struct padding would make equal settings hash differently
+ *
+ * @param key Key so far, updated
+ * @param value Field to hash
+ * @param size Size of the field in bytes
+ */
+void DSPCache::hash(dspCacheKey_t &key, const void *value, uint8_t size)
+{
+  const uint8_t *data = (const uint8_t *)value;
+  key.crc = dspCrc32(key.crc, data, size);
+  for(uint8_t i = 0; i < size; i++)
+    key.check = (key.check ^ data[i]) * 16777619UL; // FNV-1a prime
+}
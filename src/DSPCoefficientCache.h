@@ -0,0 +1,89 @@
+#ifndef DSPCOEFFICIENTCACHE_H
+#define DSPCOEFFICIENTCACHE_H
+
+#include "DSPPlatform.h"
+#include <stdint.h>
+#include "parameters.h"
+
+// Max number of 5.23 words one cache entry holds (the dynamic bass filter and boost)
+#define CACHE_MAX_WORDS 7
+
+/**
+ * @brief Key of a parameter set: two independent hashes of the block type,
+ *        its settings and the sample rate. Both have to match for a hit, so two
+ *        settings that happen to share a CRC-32 don't get each other's words
+ */
+typedef struct dspCacheKey_t
+{
+  uint32_t crc;   // CRC-32
+  uint32_t check; // FNV-1a
+} dspCacheKey;
+
+
+/**
+ * @brief One cached set of parameter words
+ */
+typedef struct dspCacheEntry_t
+{
+  dspCacheKey_t key;              // Hashes of the block type, its settings and the sample rate
+  uint8_t count;                  // Number of words, 0 = free slot
+  uint8_t age;                    // Number of more recently used entries
+  int32_t words[CACHE_MAX_WORDS]; // Finished 5.23 words
+} dspCacheEntry;
+
+
+/**
+ * @brief Least recently used cache of calculated parameter words.
+ *        Entries are keyed by a CRC-32 and an FNV-1a hash of the block type, its
+ *        settings and the sample rate, so a UI cycling through presets gets its
+ *        coefficients without running the filter math again. The DSP address isn't
+ *        part of the key, blocks with the same settings share an entry.
+ *        Use DSPCoefficientCache<entries> to get a cache with its own storage.
+ */
+class DSPCache
+{
+  public:
+    DSPCache(dspCacheEntry_t *entries, uint8_t size);
+
+    void clear();
+    bool lookup(const dspCacheKey_t &key, int32_t *words, uint8_t count);
+    void store(const dspCacheKey_t &key, const int32_t *words, uint8_t count);
+    uint32_t hits() const;
+    uint32_t misses() const;
+    void resetCounters();
+    uint8_t used() const;
+
+    static dspCacheKey_t key(const firstOrderEQ_t &equalizer, float fs);
+    static dspCacheKey_t key(const secondOrderEQ_t &equalizer, float fs);
+    static dspCacheKey_t key(const toneCtrl_t &toneCtrl, float fs);
+    static dspCacheKey_t dynamicBassKey(float dB, uint16_t frequency, float fs);
+    static dspCacheKey_t detectorKey(int16_t threshold, uint16_t time_constant, float fs);
+
+  private:
+    void touch(uint8_t index);
+    static dspCacheKey_t start(uint8_t type);
+    static void hash(dspCacheKey_t &key, const void *value, uint8_t size);
+
+    dspCacheEntry_t *_entries; // Entry storage
+    const uint8_t _size;       // Number of entries in the storage
+    uint32_t _hits;            // Number of lookups that found their words
+    uint32_t _misses;          // Number of lookups that didn't
+};
+
+
+/**
+ * @brief Coefficient cache that holds its own storage
+ *
+ * @tparam entries Max number of cached parameter sets (38 bytes of RAM each)
+ */
+template <uint8_t entries>
+class DSPCoefficientCache : public DSPCache
+{
+  public:
+    DSPCoefficientCache() : DSPCache(_storage, entries) {}
+
+  private:
+    dspCacheEntry_t _storage[entries];
+};
+
+#endif
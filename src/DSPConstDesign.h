@@ -0,0 +1,334 @@
+#ifndef DSPCONSTDESIGN_H
+#define DSPCONSTDESIGN_H
+
+#include <stdint.h>
+#include "parameters.h"
+#include "DSPFixedPoint.h"
+#include "DSPFilterDesign.h"
+
+/**
+ * Compile-time coefficient designers for filters that never change, like crossovers
+ * and protection high-passes. They're C++11 constexpr, so
+ *
+ *   constexpr dspBiquadWords_t crossover = dspConstSecondOrderEQ(parameters::filterType::butterworthLowpass, 2500, 48000);
+ *   dsp.EQsecondOrder(MOD_XOVER_ADDR, crossover);
+ *
+ * costs no filter math at runtime. The biquad, first order and state variable writes are
+ * inline, so the words end up as immediates in flash and need no RAM either.
+ * The compressor blocks are too large for that, passed by reference the 152 bytes
+ * would be copied to RAM first. Keep them in PROGMEM and pass a pointer instead:
+ *
+ *   constexpr dspCompressorRMSWords_t limiter PROGMEM = dspConstCompressorRMS(-6, 10, 10, 0, 200, 0, 48000);
+ *   dsp.compressorRMS(MOD_LIMITER_ADDR, &limiter);
+ *
+ * The formulas are the ones of the float designers in DSPFilterDesign, evaluated in
+ * double and rounded to the nearest 5.23 word. Note that double (and long double) is
+ * a 32-bit float on AVR, so there the words are only as accurate as the runtime float
+ * designers, up to a few tens of LSBs for steep shelves. Other cores have a 64-bit double.
+ */
+
+/**
+ * @brief A block of finished 5.23 parameter words
+ *
+ * @tparam count Number of words
+ */
+template <uint8_t count>
+struct dspParameterWords_t
+{
+  int32_t words[count];
+};
+
+typedef dspParameterWords_t<3> dspFirstOrderWords_t;                        // b0, b1, a1
+typedef dspParameterWords_t<5> dspBiquadWords_t;                            // b0, b1, b2, -a1, -a2
+typedef dspParameterWords_t<2> dspStateVariableWords_t;                     // Frequency, 1/Q
+typedef dspParameterWords_t<COMPRESSOR_RMS_WORDS> dspCompressorRMSWords_t;   // 34 curve points, attack, postgain, hold, decay
+typedef dspParameterWords_t<COMPRESSOR_PEAK_WORDS> dspCompressorPeakWords_t; // 33 curve points, postgain, hold, decay
+
+
+// Everything in here is a building block of the designers below. C++11 constexpr
+// functions are a single return statement, so loops are recursions and intermediate
+// results are passed on as parameters
+namespace dspConst
+{
+  constexpr double PI_D  = 3.14159265358979323846;
+  constexpr double LN2   = 0.69314718055994530942;
+  constexpr double LN10  = 2.30258509299404568402;
+  constexpr double LN2_7 = 0.99325177301028345018; // ln(2.7)
+
+  constexpr double absolute(double x) { return x < 0 ? -x : x; }
+
+  // Nearest integer, enough range for the angle reduction
+  constexpr double nearest(double x) { return x < 0 ? -(double)(int64_t)(0.5 - x) : (double)(int64_t)(x + 0.5); }
+
+  // Taylor series, |x| <= pi. Term n+1 is term n * -x^2/((2n+2)(2n+3))
+  constexpr double sinSeries(double x2, double term, uint8_t n)
+  {
+    return n > 14 ? term : term + sinSeries(x2, -term * x2 / ((2 * n + 2) * (2 * n + 3)), n + 1);
+  }
+
+  constexpr double sinReduced(double x) { return sinSeries(x * x, x, 0); }
+  constexpr double sine(double x) { return sinReduced(x - 2 * PI_D * nearest(x / (2 * PI_D))); }
+  constexpr double cosine(double x) { return sine(x + PI_D / 2); }
+
+  // e^x, halving the exponent until the series converges fast, then squaring back
+  constexpr double expSeries(double x, double term, uint8_t n)
+  {
+    return n > 16 ? term : term + expSeries(x, term * x / (n + 1), n + 1);
+  }
+
+  constexpr double squared(double x) { return x * x; }
+  constexpr double exponential(double x) { return absolute(x) > 0.5 ? squared(exponential(x / 2)) : expSeries(x, 1, 0); }
+
+  constexpr double power10(double x) { return exponential(x * LN10); }
+  constexpr double hyperbolicSine(double x) { return (exponential(x) - exponential(-x)) / 2; }
+
+  // Newton-Raphson, starting at x or 1 so the first step can only overshoot
+  constexpr double sqrtIteration(double x, double guess, uint8_t n)
+  {
+    return n == 0 || absolute(guess * guess - x) <= x * 1e-15 ? guess : sqrtIteration(x, (guess + x / guess) / 2, n - 1);
+  }
+
+  constexpr double squareRoot(double x) { return x <= 0 ? 0 : sqrtIteration(x, x > 1 ? x : 1, 100); }
+
+  // Same rounding and saturation as dspFixedTo523
+  constexpr int32_t to523(double x)
+  {
+    return x >= 16.0 ? FIXED_523_MAX : x <= -16.0 ? FIXED_523_MIN : (int32_t)(x * 8388608.0 + (x < 0 ? -0.5 : 0.5));
+  }
+
+  // Unnormalized biquad, b0 b1 b2 a0 a1 a2
+  struct biquad_t
+  {
+    double b0, b1, b2, a0, a1, a2;
+  };
+
+  constexpr biquad_t peaking(double alpha, double c, double A, double g)
+  {
+    return biquad_t{(1 + alpha * A) * g, -(2 * c) * g, (1 - alpha * A) * g, 1 + alpha / A, -2 * c, 1 - alpha / A};
+  }
+
+  constexpr biquad_t lowShelf(double alpha, double c, double A, double sqrtA, double g)
+  {
+    return biquad_t{A * ((A + 1) - (A - 1) * c + 2 * sqrtA * alpha) * g,
+                    2 * A * ((A - 1) - (A + 1) * c) * g,
+                    A * ((A + 1) - (A - 1) * c - 2 * sqrtA * alpha) * g,
+                    (A + 1) + (A - 1) * c + 2 * sqrtA * alpha,
+                    -2 * ((A - 1) + (A + 1) * c),
+                    (A + 1) + (A - 1) * c - 2 * sqrtA * alpha};
+  }
+
+  constexpr biquad_t highShelf(double alpha, double c, double A, double sqrtA, double g)
+  {
+    return biquad_t{A * ((A + 1) + (A - 1) * c + 2 * sqrtA * alpha) * g,
+                    -2 * A * ((A - 1) + (A + 1) * c) * g,
+                    A * ((A + 1) + (A - 1) * c - 2 * sqrtA * alpha) * g,
+                    (A + 1) - (A - 1) * c + 2 * sqrtA * alpha,
+                    2 * ((A - 1) - (A + 1) * c),
+                    (A + 1) - (A - 1) * c - 2 * sqrtA * alpha};
+  }
+
+  constexpr biquad_t lowpass(double alpha, double c, double g)
+  {
+    return biquad_t{(1 - c) * g / 2, (1 - c) * g, (1 - c) * g / 2, 1 + alpha, -2 * c, 1 - alpha};
+  }
+
+  constexpr biquad_t highpass(double alpha, double c, double g)
+  {
+    return biquad_t{(1 + c) * g / 2, -(1 + c) * g, (1 + c) * g / 2, 1 + alpha, -2 * c, 1 - alpha};
+  }
+
+  constexpr biquad_t bandpass(double alpha, double c, double g)
+  {
+    return biquad_t{alpha * g, 0, -alpha * g, 1 + alpha, -2 * c, 1 - alpha};
+  }
+
+  constexpr biquad_t bandstop(double alpha, double c, double g)
+  {
+    return biquad_t{g, -2 * c * g, g, 1 + alpha, -2 * c, 1 - alpha};
+  }
+
+  // Shelf alpha, sin(w0)/2 * sqrt((A + 1/A)*(1/S - 1) + 2)
+  constexpr double shelfAlpha(double s, double A, double S) { return s / 2 * squareRoot((A + 1 / A) * (1 / S - 1) + 2); }
+
+  // Band alpha, same expression as the float designer
+  constexpr double bandAlpha(double w0, double s, double bandwidth) { return s * hyperbolicSine(LN2 / (2 * bandwidth * w0 / s)); }
+
+  // Picks the filter type, width is Q, S or bandwidth depending on the type
+  constexpr biquad_t biquad(uint8_t filterType, double w0, double s, double c, double A, double g, double width)
+  {
+    return filterType == parameters::filterType::lowShelf            ? lowShelf(shelfAlpha(s, A, width), c, A, squareRoot(A), g)
+         : filterType == parameters::filterType::highShelf           ? highShelf(shelfAlpha(s, A, width), c, A, squareRoot(A), g)
+         : filterType == parameters::filterType::lowpass             ? lowpass(s / (2 * width), c, g)
+         : filterType == parameters::filterType::highpass            ? highpass(s / (2 * width), c, g)
+         : filterType == parameters::filterType::bandpass            ? bandpass(bandAlpha(w0, s, width), c, g)
+         : filterType == parameters::filterType::bandstop            ? bandstop(bandAlpha(w0, s, width), c, g)
+         : filterType == parameters::filterType::butterworthLowpass  ? lowpass(s / (2 * squareRoot(2)), c, g)
+         : filterType == parameters::filterType::butterworthHighpass ? highpass(s / (2 * squareRoot(2)), c, g)
+         : filterType == parameters::filterType::besselLowpass       ? lowpass(s / (2 * squareRoot(3)), c, g)
+         : filterType == parameters::filterType::besselHighpass      ? highpass(s / (2 * squareRoot(3)), c, g)
+         : peaking(s / (2 * width), c, A, g);
+  }
+
+  // Normalizes to a0 and flips the feed forward terms for an inverted phase
+  constexpr dspBiquadWords_t normalize(const biquad_t &f, double sign)
+  {
+    return dspBiquadWords_t{{to523(sign * f.b0 / f.a0), to523(sign * f.b1 / f.a0), to523(sign * f.b2 / f.a0), to523(-f.a1 / f.a0), to523(-f.a2 / f.a0)}};
+  }
+
+  constexpr dspBiquadWords_t normalize(const biquad_t &f, uint8_t phase, uint8_t state)
+  {
+    return f.a0 == 0 || state != parameters::state::on
+         ? dspBiquadWords_t{{to523(1), 0, 0, 0, 0}}
+         : normalize(f, phase == parameters::phase::nonInverted ? 1.0 : -1.0);
+  }
+
+  // First order, a1 = 2.7^-w0
+  constexpr dspFirstOrderWords_t firstOrder(bool highpass, double a1, double g, double sign)
+  {
+    return highpass ? dspFirstOrderWords_t{{to523(sign * g * a1), to523(sign * -a1 * g), to523(a1)}}
+                    : dspFirstOrderWords_t{{to523(sign * g * (1 - a1)), 0, to523(a1)}};
+  }
+
+  // Compressor curve from -90 to +6dB. The points above the threshold follow the ratio,
+  // offset so the curve is continuous at the first point above the threshold
+  constexpr double curveX(uint8_t i, uint8_t points) { return -90 + 96.0 / points * i; }
+
+  constexpr uint8_t curveKnee(double threshold, uint8_t points, uint8_t i)
+  {
+    return i >= points || curveX(i, points) >= threshold ? i : curveKnee(threshold, points, i + 1);
+  }
+
+  constexpr double curveDelta(double x, double coeff) { return x * coeff - x; }
+
+  constexpr int32_t curvePoint(uint8_t i, uint8_t points, double threshold, double ratio)
+  {
+    return i < curveKnee(threshold, points, 0) ? to523(1)
+         : to523(power10((curveX(i, points) / ratio - curveDelta(curveX(curveKnee(threshold, points, 0), points), 1 / ratio) - curveX(i, points)) / 20));
+  }
+
+  // Compile-time index list 0..N-1, to expand the curve points into an initializer list
+  template <uint8_t... I> struct indices {};
+  template <uint8_t N, uint8_t... I> struct indexRange : indexRange<N - 1, N - 1, I...> {};
+  template <uint8_t... I> struct indexRange<0, I...> { typedef indices<I...> type; };
+
+  // Truncated and wrapped like SigmaDSP::floatToFixed, for the parameters the
+  // runtime designers convert that way
+  constexpr int32_t truncated523(double x) { return (int32_t)(uint32_t)(int64_t)(x * 8388608.0); }
+
+  // Hold in samples and decay in dB per sample of 96dB full scale
+  constexpr int32_t hold(double hold, double fs) { return truncated523(hold * fs / 1000); }
+  constexpr int32_t decay(double decay, double fs) { return truncated523((20 / (decay * 2.3)) * 1e3 / (96 * fs)); }
+
+  // RMS time constant, |1 - 10^(dbps/(10*fs))|
+  constexpr int32_t attack(double dbps, double fs) { return to523(absolute(1.0 - power10(dbps / (10 * fs)))); }
+
+  template <uint8_t... I>
+  constexpr dspCompressorRMSWords_t compressorRMS(indices<I...>, double threshold, double ratio, double rms_tc, double hold_ms, double decay_ms, double postgain, double fs)
+  {
+    return dspCompressorRMSWords_t{{curvePoint(I, 34, threshold, ratio)...,
+                                    attack((20 / (rms_tc * 2.3)) * 1e3, fs), to523(power10(postgain / 20)), hold(hold_ms, fs), decay(decay_ms, fs)}};
+  }
+
+  template <uint8_t... I>
+  constexpr dspCompressorPeakWords_t compressorPeak(indices<I...>, double threshold, double ratio, double hold_ms, double decay_ms, double postgain, double fs)
+  {
+    return dspCompressorPeakWords_t{{curvePoint(I, 33, threshold, ratio)...,
+                                     to523(power10(postgain / 40)), hold(hold_ms, fs), decay(decay_ms, fs)}};
+  }
+}
+
+
+/**
+ * @brief Calculates the coefficients of a first order EQ block at compile time
+ *
+ * @param filterType parameters::filterType::lowpass or highpass
+ * @param freq Corner frequency in [Hz]
+ * @param fs Sample rate in [Hz]
+ * @param gain Gain in dB
+ * @param phase parameters::phase::nonInverted or inverted
+ * @param state parameters::state::on or off
+ * @return constexpr dspFirstOrderWords_t b0, b1, a1 5.23 words
+ */
+constexpr dspFirstOrderWords_t dspConstFirstOrderEQ(uint8_t filterType, double freq, double fs, double gain = 0,
+                                                    uint8_t phase = parameters::phase::nonInverted, uint8_t state = parameters::state::on)
+{
+  return state != parameters::state::on
+       ? dspFirstOrderWords_t{{dspConst::to523(1), 0, 0}}
+       : dspConst::firstOrder(filterType == parameters::filterType::highpass, dspConst::exponential(-2 * dspConst::PI_D * freq / fs * dspConst::LN2_7),
+                              dspConst::power10(gain / 20), phase == parameters::phase::nonInverted ? 1.0 : -1.0);
+}
+
+
+/**
+ * @brief Calculates the coefficients of a second order EQ block at compile time
+ *
+ * @param filterType parameters::filterType::[type]
+ * @param freq Center or corner frequency in [Hz]
+ * @param fs Sample rate in [Hz]
+ * @param width Q for peaking, parametric, lowpass and highpass, slope S for the shelves,
+ *              bandwidth in octaves for bandpass and bandstop. Not used by the Butterworth and Bessel types
+ * @param boost Boost in dB, peaking, parametric and shelves only
+ * @param gain Gain in dB
+ * @param phase parameters::phase::nonInverted or inverted
+ * @param state parameters::state::on or off
+ * @return constexpr dspBiquadWords_t b0, b1, b2, -a1, -a2 5.23 words
+ */
+constexpr dspBiquadWords_t dspConstSecondOrderEQ(uint8_t filterType, double freq, double fs, double width = 0.707, double boost = 0, double gain = 0,
+                                                 uint8_t phase = parameters::phase::nonInverted, uint8_t state = parameters::state::on)
+{
+  return dspConst::normalize(dspConst::biquad(filterType, 2 * dspConst::PI_D * freq / fs,
+                                              dspConst::sine(2 * dspConst::PI_D * freq / fs), dspConst::cosine(2 * dspConst::PI_D * freq / fs),
+                                              dspConst::power10(boost / 40), dspConst::power10(gain / 20), width),
+                             phase, state);
+}
+
+
+/**
+ * @brief Calculates the parameters of a state variable filter block at compile time
+ *
+ * @param freq Filter frequency (1 to 19148 Hz)
+ * @param q Filter Q value (1.28 to 10.00)
+ * @param fs Sample rate in [Hz]
+ * @return constexpr dspStateVariableWords_t frequency and 1/Q 5.23 words
+ */
+constexpr dspStateVariableWords_t dspConstStateVariable(double freq, double q, double fs)
+{
+  return dspStateVariableWords_t{{dspConst::to523(2 * dspConst::sine(dspConst::PI_D * freq / fs)), dspConst::to523(1 / q)}};
+}
+
+
+/**
+ * @brief Calculates the parameters of an RMS compressor block at compile time
+ *
+ * @param threshold Threshold, -90 to +6dB
+ * @param ratio Compression ratio, 1 to 100
+ * @param rms_tc RMS time constant, 1 to 500ms
+ * @param hold Hold time, 0 to 500ms
+ * @param decay Decay time, 1 to 2000ms
+ * @param postgain Post gain, -30 to +24dB
+ * @param fs Sample rate in [Hz]
+ * @return constexpr dspCompressorRMSWords_t 38 5.23 words
+ */
+constexpr dspCompressorRMSWords_t dspConstCompressorRMS(double threshold, double ratio, double rms_tc, double hold, double decay, double postgain, double fs)
+{
+  return dspConst::compressorRMS(dspConst::indexRange<34>::type(), threshold, ratio, rms_tc, hold, decay, postgain, fs);
+}
+
+
+/**
+ * @brief Calculates the parameters of a peak compressor block at compile time
+ *
+ * @param threshold Threshold, -90 to +6dB
+ * @param ratio Compression ratio, 1 to 100
+ * @param hold Hold time, 0 to 500ms
+ * @param decay Decay time, 1 to 2000ms
+ * @param postgain Post gain, -30 to +24dB
+ * @param fs Sample rate in [Hz]
+ * @return constexpr dspCompressorPeakWords_t 36 5.23 words
+ */
+constexpr dspCompressorPeakWords_t dspConstCompressorPeak(double threshold, double ratio, double hold, double decay, double postgain, double fs)
+{
+  return dspConst::compressorPeak(dspConst::indexRange<33>::type(), threshold, ratio, hold, decay, postgain, fs);
+}
+
+#endif
@@ -8,42 +8,49 @@
  * @param kbitSize Size of EEPROM in kilobit
  * @param ledPin Pin to toggle when flashing EEPROM (optional parameter)
  */
+#ifdef ARDUINO
 DSPEEPROM::DSPEEPROM(TwoWire &WireObject,uint8_t i2cAddress, uint16_t kbitSize, int8_t ledPin)
-  : _WireObject(WireObject), _eepromAddress(i2cAddress), _kbitSize(kbitSize), _ledPin(ledPin)
+  : _wireTransport(WireObject), _transport(_wireTransport), _eepromAddress(i2cAddress), _kbitSize(kbitSize), _ledPin(ledPin)
 {  
-  // The DSP program itself will never exceed 9248 bytes in total
-  // The last byte in EEPROM will be used to keep the firmware version
-  // An EEPROM with size larger than 9.3kB is recommended
-  switch (_kbitSize)
-  {
-    case 64:
-    default:
-      _firmwareVersionAddress = 0x1FFF; // 8191 dec
-      break;
-    case 128:
-      _firmwareVersionAddress = 0x3FFF; // 16383 dec
-      break;
-    case 256:
-      _firmwareVersionAddress = 0x7FFF; // 32767 dec
-      break;
-    case 512:
-      _firmwareVersionAddress = 0xFFFF; // 65535 dec
-      break;
-  }
+  setMemoryLayout();
+}
+#endif
+
+
+/**
+ * @brief Constructs a new DSPEEPROM::DSPEEPROM object that communicates through a custom transport
+ * 
+ * @param transport Transport object
+ * @param i2cAddress 7-bit EEPROM i2c address
+ * @param kbitSize Size of EEPROM in kilobit
+ * @param ledPin Pin to toggle when flashing EEPROM, only driven on Arduino (optional parameter)
+ */
+DSPEEPROM::DSPEEPROM(DSPTransport &transport, uint8_t i2cAddress, uint16_t kbitSize, int8_t ledPin)
+#ifdef ARDUINO
+  : _wireTransport(Wire), _transport(transport), _eepromAddress(i2cAddress), _kbitSize(kbitSize), _ledPin(ledPin)
+#else
+  : _transport(transport), _eepromAddress(i2cAddress), _kbitSize(kbitSize), _ledPin(ledPin)
+#endif
+{  
+  setMemoryLayout();
 }
 
 
 /**
- * @brief Starts the i2c interface
+ * @brief Starts the transport and sets up the LED pin if present
  */
 void DSPEEPROM::begin()
 {
+  _transport.begin();
+
   // If LED is present
+#ifdef ARDUINO
   if(_ledPin >= 0)
   {
     pinMode(_ledPin, OUTPUT);
     digitalWrite(_ledPin, LOW);
   }
+#endif
 }
 
 
@@ -58,8 +65,7 @@ void DSPEEPROM::begin()
  */
 uint8_t DSPEEPROM::ping()
 {
-  _WireObject.beginTransmission(_eepromAddress);
-  return _WireObject.endTransmission();
+  return _transport.ping(_eepromAddress);
 }
 
 
@@ -71,91 +77,457 @@ uint8_t DSPEEPROM::ping()
  */
 uint8_t DSPEEPROM::getFirmwareVersion()
 {  
-  _WireObject.beginTransmission(_eepromAddress);
-  _WireObject.write((uint16_t)_firmwareVersionAddress >> 8); // MSB
-  _WireObject.write(_firmwareVersionAddress & 0xFF);         // LSB
-  _WireObject.endTransmission();
-  
-  _WireObject.requestFrom((uint8_t)_eepromAddress, (uint8_t)1);
-  
-  if(_WireObject.available())
-    return _WireObject.read();
+  uint8_t firmwareVersion;
+
+  if(_transport.writeRead(_eepromAddress, _firmwareVersionAddress, &firmwareVersion, 1) == 0)
+    return firmwareVersion;
   else
     return 0;   
 }
 
 
+/**
+ * @brief Returns the length of the firmware stored in the EEPROM, read from the footer
+ * 
+ * @return uint16_t firmware length in bytes. 0xFFFF if the EEPROM is empty or not found
+ */
+uint16_t DSPEEPROM::getFirmwareSize()
+{
+  uint8_t footer[EEPROM_FOOTER_SIZE];
+  if(readBlock(_footerAddress, footer, sizeof(footer)) != 0)
+    return 0xFFFF;
+
+  return (uint16_t)footer[0] << 8 | footer[1];
+}
+
+
+/**
+ * @brief Returns the CRC-32 of the firmware stored in the EEPROM, read from the footer.
+ *        Compare it with EE_CRC32 from the generated parameter file
+ * 
+ * @return uint32_t firmware CRC-32. 0xFFFFFFFF if the EEPROM is empty or not found
+ */
+uint32_t DSPEEPROM::getFirmwareCRC()
+{
+  uint8_t footer[EEPROM_FOOTER_SIZE];
+  if(readBlock(_footerAddress, footer, sizeof(footer)) != 0)
+    return 0xFFFFFFFF;
+
+  return (uint32_t)footer[2] << 24 | (uint32_t)footer[3] << 16 | (uint32_t)footer[4] << 8 | footer[5];
+}
+
+
+/**
+ * @brief Reads the stored firmware back and checks it against the CRC-32 in the footer
+ * 
+ * @return true if the EEPROM holds an intact firmware, false otherwise
+ */
+bool DSPEEPROM::verifyFirmware()
+{
+  uint8_t footer[EEPROM_FOOTER_SIZE];
+  if(readBlock(_footerAddress, footer, sizeof(footer)) != 0)
+    return false;
+
+  uint16_t size = (uint16_t)footer[0] << 8 | footer[1];
+  uint32_t crc = (uint32_t)footer[2] << 24 | (uint32_t)footer[3] << 16 | (uint32_t)footer[4] << 8 | footer[5];
+  if(size == 0 || size > _footerAddress)
+    return false;
+
+  return crcBlock(0, size) == crc;
+}
+
+
 /**
  * @brief Writes the passed firmware array to the EEPROM and verifies
           that the content was written.
+          The firmware is identified by its length and CRC-32, stored in a footer
+          right before the version byte. It's only written if the EEPROM doesn't
+          already hold an intact copy of it with the same version
  * 
  * @param firmware Array to hold the firmware to flash
  * @param size Firmware array length (use sizeof)
  * @param firmwareVersion Version of the DSP firmware to store(between 1 and 254)
+ * @param differential Read the EEPROM back first and only rewrite the parts that differ (optional parameter)
  * @return True if writing succeeded and content was verified to be correct, false otherwise 
  */
-uint8_t DSPEEPROM::writeFirmware(const uint8_t *firmware, uint16_t size, int8_t firmwareVersion)
+uint8_t DSPEEPROM::writeFirmware(const uint8_t *firmware, uint16_t size, int8_t firmwareVersion, bool differential)
 {
-  // Check if EEPROM already contains the current firmware version
-  uint8_t EEPROM_firmwareVersion = getFirmwareVersion();
+  return writeFirmware(firmware, size, dspCrc32_P(0, firmware, size), firmwareVersion, differential);
+}
+
+
+/**
+ * @brief Writes the passed firmware array to the EEPROM and verifies that the content
+          was written. Same as above, but takes the CRC-32 computed by the parameter
+          generator, so the firmware isn't read through on every boot
+ * 
+ * @param firmware Array to hold the firmware to flash, DSP_eeprom_firmware
+ * @param size Firmware array length, EE_SIZE
+ * @param crc CRC-32 of the firmware, EE_CRC32
+ * @param firmwareVersion Version of the DSP firmware to store(between 1 and 254)
+ * @param differential Read the EEPROM back first and only rewrite the parts that differ (optional parameter)
+ * @return True if writing succeeded and content was verified to be correct, false otherwise 
+ */
+uint8_t DSPEEPROM::writeFirmware(const uint8_t *firmware, uint16_t size, uint32_t crc, int8_t firmwareVersion, bool differential)
+{
+  // Check if EEPROM already contains the current firmware
+  if(firmwareCurrent(size, crc, firmwareVersion) && verifyFirmware())
+    return 1;
+
+  flashImage(firmware, nullptr, size, crc, firmwareVersion, differential);
+
+  // Does the EEPROM now hold an intact copy of the firmware?
+  if(firmwareCurrent(size, crc, firmwareVersion) && verifyFirmware())
+    return 1; // Yes it does
+  else
+    return 0; // No it doesn't
+}
+
+
+/**
+ * @brief Writes firmware read from a stream (Serial, a file etc.) to the EEPROM and verifies
+          that the content was written. The firmware goes to the EEPROM in page sized chunks,
+          so no copy of it is needed in flash or RAM. The EEPROM is always written,
+          compare getFirmwareCRC() with the CRC of the new firmware first to avoid needless flashing
+ * 
+ * @param firmware Stream to read the firmware from
+ * @param size Firmware length in bytes
+ * @param firmwareVersion Version of the DSP firmware to store(between 1 and 254)
+ * @param differential Read the EEPROM back first and only rewrite the parts that differ (optional parameter)
+ * @return True if writing succeeded and content was verified to be correct, false otherwise 
+ */
+uint8_t DSPEEPROM::writeFirmware(Stream &firmware, uint16_t size, int8_t firmwareVersion, bool differential)
+{
+  uint32_t crc = 0;
+
+  if(flashImage(nullptr, &firmware, size, crc, firmwareVersion, differential) == false)
+    return 0; // Stream timed out, the footer is left erased
+
+  if(firmwareCurrent(size, crc, firmwareVersion) && verifyFirmware())
+    return 1;
+  else
+    return 0;
+}
+
 
-  // Write new firmware is version doesn't match or if no version is provided
-  if(firmwareVersion != EEPROM_firmwareVersion || firmwareVersion < 0)
+/**
+ * @brief Writes a block of data to the EEPROM using page writes, and waits for
+ *        each write cycle to finish by ACK polling
+ * 
+ * @param address EEPROM memory address
+ * @param data Data array to write
+ * @param length Number of bytes to write
+ * @return uint8_t transport status code of the first failed write (0 = success)
+ */
+uint8_t DSPEEPROM::writeBlock(uint16_t address, const uint8_t *data, uint16_t length)
+{
+  uint16_t chunk = writeChunk();
+
+  while(length > 0)
   {
-    // Write new firmware
-    for(uint16_t i = 0; i < size; i++)
-    {
-      _WireObject.beginTransmission(_eepromAddress);
-      _WireObject.write(i >> 8);                      // High memory address
-      _WireObject.write(i & 0xFF);                    // Low memory address
-      _WireObject.write(pgm_read_byte(&firmware[i])); // Content
-      _WireObject.endTransmission();                  // End
-      // EEPROM is a slooow kind of memory..
-      delay(5);
-
-      // Toggle LED every 32th byte if LED is present
-      if(_ledPin >= 0 && ledCounter & 0x20)
-        digitalWrite(_ledPin, !digitalRead(_ledPin));
-
-      // Increase counter
-      ledCounter++;
-    }
+    // Stay within the current page, a write crossing it would wrap around
+    uint16_t chunkLength = _pageSize - (address % _pageSize);
+    if(chunkLength > chunk)
+      chunkLength = chunk;
+    if(chunkLength > length)
+      chunkLength = length;
+
+    uint8_t status = _transport.write(_eepromAddress, address, data, chunkLength);
+    if(status != 0)
+      return status;
+
+    status = waitForWrite();
+    if(status != 0)
+      return status;
+
+    address += chunkLength;
+    data += chunkLength;
+    length -= chunkLength;
+  }
+
+  return 0;
+}
+
+
+/**
+ * @brief Reads a block of data from the EEPROM using sequential reads
+ * 
+ * @param address EEPROM memory address
+ * @param buffer Array to store the received data in
+ * @param length Number of bytes to read
+ * @return uint8_t transport status code of the first failed read (0 = success)
+ */
+uint8_t DSPEEPROM::readBlock(uint16_t address, uint8_t *buffer, uint16_t length)
+{
+  uint16_t chunk = _transport.maxChunk();
+
+  while(length > 0)
+  {
+    uint16_t chunkLength = (length > chunk) ? chunk : length;
+
+    uint8_t status = _transport.writeRead(_eepromAddress, address, buffer, chunkLength);
+    if(status != 0)
+      return status;
+
+    address += chunkLength;
+    buffer += chunkLength;
+    length -= chunkLength;
+  }
+
+  return 0;
+}
+
 
-    // Make sure all tracks of old FW is gone, by overwriting a few more bytes
-    for(uint16_t i = size; i < 0x2000; i++)
+/*******************************************************************************************
+**                                     PRIVATE METHODS                                    **
+*******************************************************************************************/
+
+
+/**
+ * @brief Waits for the EEPROM to finish its internal write cycle. The EEPROM doesn't
+ *        acknowledge its address until it's done, so it's pinged until it does
+ * 
+ * @return uint8_t 0 when the write cycle is done, ping status if it timed out
+ */
+uint8_t DSPEEPROM::waitForWrite()
+{
+  uint32_t start = millis();
+  uint8_t status;
+
+  do
+  {
+    status = _transport.ping(_eepromAddress);
+    if(status == 0)
+      break;
+  } while(millis() - start < SIGMADSP_EEPROM_WRITE_TIMEOUT);
+
+  return status;
+}
+
+
+/**
+ * @brief Writes the firmware, the 0xFF padding up to 0x2000 and the footer to the EEPROM
+ * 
+ * @param firmware PROGMEM firmware array, nullptr when reading from a stream
+ * @param stream Stream to read the firmware from, nullptr when reading from an array
+ * @param size Firmware length
+ * @param crc CRC-32 of the firmware. Computed while writing when reading from a stream
+ * @param firmwareVersion Firmware version
+ * @param differential Only rewrite the parts that differ
+ * @return true if the whole image was written, false if the stream timed out
+ */
+bool DSPEEPROM::flashImage(const uint8_t *firmware, Stream *stream, uint16_t size, uint32_t &crc, int8_t firmwareVersion, bool differential)
+{
+  uint8_t buffer[SIGMADSP_STAGING_BUFFER_SIZE];
+  uint8_t current[SIGMADSP_STAGING_BUFFER_SIZE];
+  bool streamed = true;
+
+  // Invalidate the stored footer and version first, so an interrupted flash is never taken for a valid one
+  stageFooter(buffer, 0xFFFF, 0xFFFFFFFF, 0xFF);
+  writeBlock(_footerAddress, buffer, EEPROM_FOOTER_SIZE + 1);
+
+  // Write new firmware, followed by 0xFF padding up to 0x2000 to make sure all tracks
+  // of old FW are gone. Writes never cross a page boundary
+  uint16_t address = 0;
+  while(address < 0x2000 || address < size)
+  {
+    uint16_t length = stageFirmware(firmware, size, address, buffer, stream);
+    if(length == 0)
     {
-      _WireObject.beginTransmission(_eepromAddress);
-      _WireObject.write(i >> 8);     // High memory address
-      _WireObject.write(i & 0xFF);   // Low memory address
-      _WireObject.write(0xFF);       // Content
-      _WireObject.endTransmission(); // End
-      delay(5);
-
-      // Toggle LED every 16th byte if LED is present when filling the rest
-      if(_ledPin >= 0 && ledCounter & 0x10)
-        digitalWrite(_ledPin, !digitalRead(_ledPin));
-
-      // Increase counter
-      ledCounter++;
+      streamed = false;
+      break;
     }
+    if(stream != nullptr && address < size)
+      crc = dspCrc32(crc, buffer, length);
 
-    // Write firmware version to the last byte in EEPROM
-    _WireObject.beginTransmission(_eepromAddress);
-    _WireObject.write((uint16_t)_firmwareVersionAddress >> 8); // High memory address
-    _WireObject.write(_firmwareVersionAddress & 0xFF);         // Low memory address
-    _WireObject.write(firmwareVersion);                        // Content
-    _WireObject.endTransmission();                             // End
-    delay(5);
-
-   // Turn off LED after flashing is finished if LED is present
-   if(_ledPin >= 0)
-     digitalWrite(_ledPin, LOW);
+    // Skip parts that already hold the right content
+    bool unchanged = false;
+    if(differential == true && readBlock(address, current, length) == 0)
+      unchanged = (memcmp(buffer, current, length) == 0);
+
+    if(unchanged == false && writeBlock(address, buffer, length) != 0)
+      break;
+    address += length;
+
+    // Toggle LED every page if LED is present
+#ifdef ARDUINO
+    if(_ledPin >= 0 && address % _pageSize == 0)
+      digitalWrite(_ledPin, !digitalRead(_ledPin));
+#endif
   }
 
-  // Does the last byte in memory contain the correct FW version?
-  EEPROM_firmwareVersion = getFirmwareVersion();
-  if(EEPROM_firmwareVersion == firmwareVersion)
-    return 1; // Yes it does
+  // Write the footer and the firmware version to the end of the EEPROM
+  if(streamed == true)
+  {
+    stageFooter(buffer, size, crc, firmwareVersion);
+    writeBlock(_footerAddress, buffer, EEPROM_FOOTER_SIZE + 1);
+  }
+
+  // Turn off LED after flashing is finished if LED is present
+#ifdef ARDUINO
+  if(_ledPin >= 0)
+    digitalWrite(_ledPin, LOW);
+#endif
+
+  return streamed;
+}
+
+
+/**
+ * @brief Copies the next chunk of the EEPROM image into RAM. The image is the firmware
+ *        followed by 0xFF padding up to 0x2000, with the footer and version byte left erased
+ * 
+ * @param firmware PROGMEM firmware array
+ * @param size Firmware array length
+ * @param address EEPROM address of the chunk
+ * @param buffer Array to copy the chunk to (SIGMADSP_STAGING_BUFFER_SIZE bytes)
+ * @param stream Stream to read the firmware from instead of the array, chunks must then be staged in order (optional parameter)
+ * @return uint16_t chunk length. Chunks never cross a page boundary or the end of the firmware.
+ *         0 if the stream timed out
+ */
+uint16_t DSPEEPROM::stageFirmware(const uint8_t *firmware, uint16_t size, uint16_t address, uint8_t *buffer, Stream *stream)
+{
+  uint16_t length = _pageSize - (address % _pageSize);
+  uint16_t chunk = writeChunk();
+  if(chunk > SIGMADSP_STAGING_BUFFER_SIZE)
+    chunk = SIGMADSP_STAGING_BUFFER_SIZE;
+  if(length > chunk)
+    length = chunk;
+  if(address < size && address + length > size)
+    length = size - address;
+
+  if(address < size && stream != nullptr)
+  {
+    if(stream->readBytes(buffer, length) != length)
+      return 0;
+  }
   else
-    return 0; // No it doesn't
+  {
+    for(uint16_t i = 0; i < length; i++)
+      buffer[i] = (address + i < size) ? pgm_read_byte(&firmware[address + i]) : 0xFF;
+  }
+
+  // Leave the footer and the firmware version byte for last
+  for(uint16_t i = 0; i < length; i++)
+  {
+    if(address + i >= _footerAddress && address + i <= _firmwareVersionAddress)
+      buffer[i] = 0xFF;
+  }
+
+  return length;
+}
+
+
+/**
+ * @brief Fills in the footer and the version byte that follows it
+ * 
+ * @param buffer Array to fill (EEPROM_FOOTER_SIZE + 1 bytes)
+ * @param size Firmware length
+ * @param crc Firmware CRC-32
+ * @param firmwareVersion Firmware version
+ */
+void DSPEEPROM::stageFooter(uint8_t *buffer, uint16_t size, uint32_t crc, uint8_t firmwareVersion)
+{
+  buffer[0] = size >> 8;
+  buffer[1] = size & 0xFF;
+  buffer[2] = crc >> 24;
+  buffer[3] = (crc >> 16) & 0xFF;
+  buffer[4] = (crc >> 8) & 0xFF;
+  buffer[5] = crc & 0xFF;
+  buffer[6] = firmwareVersion;
+}
+
+
+/**
+ * @brief Checks if the footer and version byte match the passed firmware
+ * 
+ * @param size Firmware length
+ * @param crc Firmware CRC-32
+ * @param firmwareVersion Firmware version, -1 to ignore the version
+ * @return true if they match
+ */
+bool DSPEEPROM::firmwareCurrent(uint16_t size, uint32_t crc, int8_t firmwareVersion)
+{
+  uint8_t footer[EEPROM_FOOTER_SIZE + 1];
+  uint8_t expected[EEPROM_FOOTER_SIZE + 1];
+  if(readBlock(_footerAddress, footer, sizeof(footer)) != 0)
+    return false;
+
+  stageFooter(expected, size, crc, firmwareVersion);
+  if(firmwareVersion < 0)
+    expected[EEPROM_FOOTER_SIZE] = footer[EEPROM_FOOTER_SIZE];
+
+  return memcmp(footer, expected, sizeof(footer)) == 0;
+}
+
+
+/**
+ * @brief Computes the CRC-32 of a part of the EEPROM using sequential reads
+ * 
+ * @param address EEPROM start address
+ * @param length Number of bytes
+ * @return uint32_t CRC-32 of the content. Read errors give a CRC that won't match
+ */
+uint32_t DSPEEPROM::crcBlock(uint16_t address, uint16_t length)
+{
+  uint8_t buffer[SIGMADSP_STAGING_BUFFER_SIZE];
+  uint32_t crc = 0;
+
+  while(length > 0)
+  {
+    uint16_t chunkLength = (length > sizeof(buffer)) ? sizeof(buffer) : length;
+    if(readBlock(address, buffer, chunkLength) != 0)
+      return ~crc;
+
+    crc = dspCrc32(crc, buffer, chunkLength);
+    address += chunkLength;
+    length -= chunkLength;
+  }
+
+  return crc;
+}
+
+
+/**
+ * @brief Returns the max number of bytes a single EEPROM write can hold
+ * 
+ * @return uint16_t bytes per write, never more than a page
+ */
+uint16_t DSPEEPROM::writeChunk()
+{
+  uint16_t chunk = _transport.maxChunk();
+  return (chunk > _pageSize) ? _pageSize : chunk;
+}
+
+
+/**
+ * @brief Picks the address of the footer, the firmware version byte and the page size based on the EEPROM size
+ */
+void DSPEEPROM::setMemoryLayout()
+{
+  // The DSP program itself will never exceed 9248 bytes in total
+  // The last byte in EEPROM will be used to keep the firmware version
+  // An EEPROM with size larger than 9.3kB is recommended
+  switch (_kbitSize)
+  {
+    case 64:
+    default:
+      _firmwareVersionAddress = 0x1FFF; // 8191 dec
+      _pageSize = 32;
+      break;
+    case 128:
+      _firmwareVersionAddress = 0x3FFF; // 16383 dec
+      _pageSize = 64;
+      break;
+    case 256:
+      _firmwareVersionAddress = 0x7FFF; // 32767 dec
+      _pageSize = 64;
+      break;
+    case 512:
+      _firmwareVersionAddress = 0xFFFF; // 65535 dec
+      _pageSize = 128;
+      break;
+  }
+
+  _footerAddress = _firmwareVersionAddress - EEPROM_FOOTER_SIZE;
 }
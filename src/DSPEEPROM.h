@@ -1,28 +1,66 @@
 #ifndef DSPEEPROM_H
 #define DSPEEPROM_H
 
-#include <Arduino.h>
-#include <Wire.h>
+#include "DSPPlatform.h"
+#ifdef ARDUINO
+  #include <Wire.h>
+#endif
+#include "DSPTransport.h"
+#include "DSPWireTransport.h"
+#include "DSPCRC32.h"
 #include "SigmaDSP.h"
 
+// Firmware length (2 bytes) and CRC-32 (4 bytes) stored right before the version byte
+#define EEPROM_FOOTER_SIZE 6
+
+// Max time in [ms] to wait for an EEPROM write cycle to finish
+#ifndef SIGMADSP_EEPROM_WRITE_TIMEOUT
+  #define SIGMADSP_EEPROM_WRITE_TIMEOUT 20
+#endif
+
 class DSPEEPROM
 {
+  friend class DSPEEPROMFlasher;
+
   public:
-    DSPEEPROM(TwoWire &WireObject, uint8_t i2cAddress, uint16_t kbitSize, int8_t ledPin = -1);
+    #ifdef ARDUINO
+      DSPEEPROM(TwoWire &WireObject, uint8_t i2cAddress, uint16_t kbitSize, int8_t ledPin = -1);
+    #endif
+    DSPEEPROM(DSPTransport &transport, uint8_t i2cAddress, uint16_t kbitSize, int8_t ledPin = -1);
     void begin();
     uint8_t ping();
     uint8_t getFirmwareVersion();
-    uint8_t writeFirmware(const uint8_t *firmware, uint16_t size, int8_t firmwareVersion = -1);
+    uint16_t getFirmwareSize();
+    uint32_t getFirmwareCRC();
+    bool verifyFirmware();
+    uint8_t writeFirmware(const uint8_t *firmware, uint16_t size, int8_t firmwareVersion = -1, bool differential = false);
+    uint8_t writeFirmware(const uint8_t *firmware, uint16_t size, uint32_t crc, int8_t firmwareVersion, bool differential = false);
+    uint8_t writeFirmware(Stream &firmware, uint16_t size, int8_t firmwareVersion = -1, bool differential = false);
+    uint8_t writeBlock(uint16_t address, const uint8_t *data, uint16_t length);
+    uint8_t readBlock(uint16_t address, uint8_t *buffer, uint16_t length);
 
   private:
-    TwoWire &_WireObject;             // Reference to passed Wire object
+    void setMemoryLayout();
+    uint8_t waitForWrite();
+    uint16_t writeChunk();
+    bool flashImage(const uint8_t *firmware, Stream *stream, uint16_t size, uint32_t &crc, int8_t firmwareVersion, bool differential);
+    uint16_t stageFirmware(const uint8_t *firmware, uint16_t size, uint16_t address, uint8_t *buffer, Stream *stream = nullptr);
+    void stageFooter(uint8_t *buffer, uint16_t size, uint32_t crc, uint8_t firmwareVersion);
+    bool firmwareCurrent(uint16_t size, uint32_t crc, int8_t firmwareVersion);
+    uint32_t crcBlock(uint16_t address, uint16_t length);
+
+    #ifdef ARDUINO
+      DSPWireTransport _wireTransport;  // Default transport, wraps the passed Wire object
+    #endif
+    DSPTransport &_transport;         // Transport all EEPROM communication goes through
 
     const uint8_t _eepromAddress;     // i2c address for our EEPROM
     const uint16_t _kbitSize;         // Size of our EEPROM in kilobits
     const int8_t _ledPin;             // Pin to toggle while writing to EEPROM
 
     uint16_t _firmwareVersionAddress; // Holds the current DSP firmware version
-    uint8_t ledCounter = 0x00;        // Keeps track of the LED toggle speed
+    uint16_t _footerAddress;          // Holds the firmware length and CRC-32
+    uint8_t _pageSize;                // EEPROM page write size in bytes
 };
 
 #endif
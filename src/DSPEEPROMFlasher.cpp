@@ -0,0 +1,212 @@
+#include "DSPEEPROMFlasher.h"
+
+/*******************************************************************************************
+**                                      PUBLIC METHODS                                    **
+*******************************************************************************************/
+
+/**
+ * @brief Constructs a new DSPEEPROMFlasher object
+ *
+ * @param eeprom EEPROM to flash
+ */
+DSPEEPROMFlasher::DSPEEPROMFlasher(DSPEEPROM &eeprom)
+  : _eeprom(eeprom), _firmware(nullptr), _size(0), _crc(0), _firmwareVersion(-1),
+    _state(FlasherIdle), _next(FlasherIdle), _verified(FlasherIdle), _address(0), _length(0), _retries(0), _status(0), _writeStart(0)
+{
+
+}
+
+
+/**
+ * @brief Starts flashing the passed firmware. Call step() until isDone() returns true
+ *
+ * @param firmware Array to hold the firmware to flash
+ * @param size Firmware array length (use sizeof)
+ * @param firmwareVersion Version of the DSP firmware to store (between 1 and 254)
+ * @return true if the firmware has to be flashed, false if the EEPROM already holds this version
+ */
+bool DSPEEPROMFlasher::start(const uint8_t *firmware, uint16_t size, int8_t firmwareVersion)
+{
+  return start(firmware, size, dspCrc32_P(0, firmware, size), firmwareVersion);
+}
+
+
+/**
+ * @brief Starts flashing the passed firmware, identified by the CRC-32 computed by the
+ *        parameter generator. Call step() until isDone() returns true
+ *
+ * @param firmware Array to hold the firmware to flash, DSP_eeprom_firmware
+ * @param size Firmware array length, EE_SIZE
+ * @param crc CRC-32 of the firmware, EE_CRC32
+ * @param firmwareVersion Version of the DSP firmware to store (between 1 and 254)
+ * @return true if the firmware has to be flashed, false if the EEPROM already holds this version
+ */
+bool DSPEEPROMFlasher::start(const uint8_t *firmware, uint16_t size, uint32_t crc, int8_t firmwareVersion)
+{
+  _firmware = firmware;
+  _size = size;
+  _crc = crc;
+  _firmwareVersion = firmwareVersion;
+  _address = 0;
+  _retries = 0;
+  _status = 0;
+
+  // Only the footer is checked here, use DSPEEPROM::verifyFirmware() for a full check
+  if(_eeprom.firmwareCurrent(size, _crc, firmwareVersion))
+  {
+    _state = FlasherDone;
+    return false;
+  }
+
+  // Invalidate the stored footer and version first, so an interrupted flash is never taken for a valid one
+  _eeprom.stageFooter(_buffer, 0xFFFF, 0xFFFFFFFF, 0xFF);
+  startWrite(_eeprom._footerAddress, _buffer, EEPROM_FOOTER_SIZE + 1, FlasherCompare);
+
+  return true;
+}
+
+
+/**
+ * @brief Does the next bounded piece of work
+ *
+ * @return uint8_t progress in percent
+ */
+uint8_t DSPEEPROMFlasher::step()
+{
+  switch(_state)
+  {
+    case FlasherCompare:
+      if(_address >= 0x2000 && _address >= _size)
+      {
+        _state = FlasherFinish;
+        break;
+      }
+      _length = _eeprom.stageFirmware(_firmware, _size, _address, _buffer);
+      {
+        uint8_t current[SIGMADSP_STAGING_BUFFER_SIZE];
+        if(_eeprom.readBlock(_address, current, _length) == 0 && memcmp(_buffer, current, _length) == 0)
+        {
+          _address += _length; // Already holds the right content
+          _retries = 0;
+          break;
+        }
+      }
+      _verified = FlasherCompare;
+      startWrite(_address, _buffer, _length, FlasherVerify);
+      break;
+
+    case FlasherWait:
+    {
+      // ACK polling, the EEPROM doesn't respond until the write cycle is done
+      uint8_t status = _eeprom.ping();
+      if(status == 0)
+        _state = _next;
+      else if(millis() - _writeStart >= SIGMADSP_EEPROM_WRITE_TIMEOUT)
+        fail(status);
+      break;
+    }
+
+    case FlasherVerify:
+    {
+      uint8_t current[SIGMADSP_STAGING_BUFFER_SIZE];
+      uint8_t status = _eeprom.readBlock(_address, current, _length);
+      if(status != 0)
+        fail(status);
+      else if(memcmp(_buffer, current, _length) == 0)
+      {
+        _address += _length;
+        _retries = 0;
+        _state = _verified;
+      }
+      else if(++_retries > SIGMADSP_EEPROM_WRITE_RETRIES)
+        fail(4);
+      else if(_verified == FlasherCompare)
+        _state = FlasherCompare; // Write the chunk again
+      else
+        _state = FlasherFinish;  // Write the footer again
+      break;
+    }
+
+    case FlasherFinish:
+      // Write the footer and the firmware version to the end of the EEPROM
+      _eeprom.stageFooter(_buffer, _size, _crc, _firmwareVersion);
+      _address = _eeprom._footerAddress;
+      _length = EEPROM_FOOTER_SIZE + 1;
+      _verified = FlasherDone;
+      startWrite(_address, _buffer, _length, FlasherVerify);
+      break;
+
+    default:
+      break;
+  }
+
+  if(_state == FlasherDone)
+    return 100;
+  uint16_t end = (_size > 0x2000) ? _size : 0x2000;
+  uint16_t written = (_address > end) ? end : _address;
+  return (uint32_t)written * 99 / end;
+}
+
+
+/**
+ * @brief Checks if flashing has finished, successfully or not
+ *
+ * @return true if flashing has finished
+ */
+bool DSPEEPROMFlasher::isDone() const
+{
+  return _state == FlasherDone || _state == FlasherError;
+}
+
+
+/**
+ * @brief Returns the result of the flashing
+ *
+ * @return uint8_t 0 if flashing succeeded or is still going on,
+ *         the transport status code of the operation that failed otherwise
+ */
+uint8_t DSPEEPROMFlasher::status() const
+{
+  return _status;
+}
+
+
+/*******************************************************************************************
+**                                      PRIVATE METHODS                                   **
+*******************************************************************************************/
+
+/**
+ * @brief Writes a chunk and waits for the write cycle in the next steps
+ *
+ * @param address EEPROM address to write to
+ * @param data Data to write. Must not cross a page boundary
+ * @param length Number of bytes to write
+ * @param next State to go to when the write cycle is done
+ * @return uint8_t transport status code (0 = success)
+ */
+uint8_t DSPEEPROMFlasher::startWrite(uint16_t address, const uint8_t *data, uint16_t length, dspFlasherState next)
+{
+  uint8_t status = _eeprom._transport.write(_eeprom._eepromAddress, address, data, length);
+  if(status != 0)
+  {
+    fail(status);
+    return status;
+  }
+
+  _writeStart = millis();
+  _next = next;
+  _state = FlasherWait;
+  return 0;
+}
+
+
+/**
+ * @brief Stops flashing because of an error
+ *
+ * @param status Transport status code of the operation that failed
+ */
+void DSPEEPROMFlasher::fail(uint8_t status)
+{
+  _status = status;
+  _state = FlasherError;
+}
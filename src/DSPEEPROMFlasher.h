@@ -0,0 +1,68 @@
+#ifndef DSPEEPROMFLASHER_H
+#define DSPEEPROMFLASHER_H
+
+#include "DSPPlatform.h"
+#include "DSPEEPROM.h"
+
+class DSPEEPROM;
+
+// Number of times a chunk that fails verification is rewritten before giving up
+#ifndef SIGMADSP_EEPROM_WRITE_RETRIES
+  #define SIGMADSP_EEPROM_WRITE_RETRIES 3
+#endif
+
+/**
+ * @brief Flasher states
+ */
+typedef enum
+{
+  FlasherIdle,
+  FlasherCompare,
+  FlasherWait,
+  FlasherVerify,
+  FlasherFinish,
+  FlasherDone,
+  FlasherError
+} dspFlasherState;
+
+
+/**
+ * @brief Flashes DSP firmware to the EEPROM in small steps, so the rest of the program
+ *        keeps running. Every step() does at most one chunk compare and write, one verify or one ACK poll.
+ *        Parts of the EEPROM that already hold the right content are skipped, so an
+ *        interrupted flash resumes where it left off when it's started again
+ */
+class DSPEEPROMFlasher
+{
+  public:
+    DSPEEPROMFlasher(DSPEEPROM &eeprom);
+
+    bool start(const uint8_t *firmware, uint16_t size, int8_t firmwareVersion = -1);
+    bool start(const uint8_t *firmware, uint16_t size, uint32_t crc, int8_t firmwareVersion);
+    uint8_t step();
+    bool isDone() const;
+    uint8_t status() const;
+
+  private:
+    uint8_t startWrite(uint16_t address, const uint8_t *data, uint16_t length, dspFlasherState next);
+    void fail(uint8_t status);
+
+    DSPEEPROM &_eeprom;              // EEPROM to flash
+
+    const uint8_t *_firmware;        // PROGMEM firmware array
+    uint16_t _size;                  // Firmware array length
+    uint32_t _crc;                   // Firmware CRC-32
+    int8_t _firmwareVersion;         // Version to store when done
+
+    dspFlasherState _state;          // Current state
+    dspFlasherState _next;           // State to go to when the current write cycle is done
+    dspFlasherState _verified;       // State to go to when the current write is verified
+    uint16_t _address;               // EEPROM address of the current chunk
+    uint16_t _length;                // Length of the current chunk
+    uint8_t _retries;                // Rewrites of the current chunk
+    uint8_t _status;                 // Transport status code of the last failure
+    uint32_t _writeStart;            // millis() timestamp of the last write
+    uint8_t _buffer[SIGMADSP_STAGING_BUFFER_SIZE]; // Current chunk
+};
+
+#endif
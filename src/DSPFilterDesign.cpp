@@ -0,0 +1,1173 @@
+#include "DSPFilterDesign.h"
+#include <math.h>
+
+#ifndef PI
+  #define PI 3.1415926535897932384626433832795
+#endif
+
+// Q8.24 constants of the fixed-point designers
+#define FIXED_TWO_PI         ((dspFixed_t)105414357) // 2*pi
+#define FIXED_LN2            ((dspFixed_t)11629080)  // ln(2)
+#define FIXED_BUTTERWORTH    ((dspFixed_t)5931642)   // 1/(2*sqrt(2))
+#define FIXED_BESSEL         ((dspFixed_t)4843165)   // 1/(2*sqrt(3))
+#define FIXED_DYNAMIC_BASS_Q ((dspFixed_t)11865075)  // 1/(2*0.707)
+#define FIXED_BASS_THRESHOLD ((dspFixed_t)486539)    // 0.029
+#define FIXED_LOG2_2_7       ((dspFixed_t)24041069)  // log2(2.7)
+
+// Float constants of the fast approximations
+#define FAST_LOG2_10   3.32192809f // log2(10)
+#define FAST_LOG2_E    1.44269504f // log2(e)
+#define FAST_LOG2_2_7  1.43295941f // log2(2.7)
+#define FAST_HALF_PI   1.57079633f // pi/2
+#define FAST_LN2       0.69314718f // ln(2)
+
+// Trig and gain terms every biquad design shares, evaluated once per design
+typedef struct
+{
+  float w0;         // 2*pi*freq/fs
+  float sinW0;      // sin(w0)
+  float cosW0;      // cos(w0)
+  float A;          // 10^(boost/40)
+  float sqrtA;      // sqrt(A)
+  float gainLinear; // 10^(gain/20)
+} biquadBasis_t;
+
+
+/*******************************************************************************************
+**                                   PRIVATE FUNCTIONS                                    **
+*******************************************************************************************/
+
+/**
+ * @brief Calculates the points of a linearly spaced vector
+ *
+ * @param x1 Start point
+ * @param x2 End point
+ * @param n Number of points to calculate
+ * @param vect Array to store calculated data in
+ */
+static void linspace(float x1, float x2, float n, float *vect)
+{
+  float k = (fabs(x1) + fabs(x2))/(n);
+
+  for(uint8_t i = 0; i < n; i++)
+    vect[i] = x1+(k*i);
+}
+
+
+/**
+ * @brief Converts a frequency to an angle in turns for dspFixedSinCos,
+ *        limited to the Nyquist frequency
+ *
+ * @param frequency Frequency in [Hz]
+ * @param fs Sample rate in [Hz]
+ * @return uint32_t Q0.32 phase, frequency/fs * 2^32
+ */
+static uint32_t frequencyToPhase(float frequency, float fs)
+{
+  float turns = frequency / fs;
+  if(turns <= 0)
+    return 0;
+  if(turns >= 0.5f)
+    return 0x80000000UL;
+  return (uint32_t)(turns * 4294967296.0f);
+}
+
+
+/**
+ * @brief Converts a phase in turns to radians
+ *
+ * @param phase Q0.32 phase
+ * @return dspFixed_t Q8.24 angle in radians
+ */
+static dspFixed_t phaseToRadians(uint32_t phase)
+{
+  return (dspFixed_t)dspFixedMulShift(phase, FIXED_TWO_PI, 32);
+}
+
+
+/**
+ * @brief Converts a float to a 5.23 word the same way SigmaDSP::floatToFixed does.
+ *        Used for the few fixed-path parameters that are plain scaling of the inputs
+ *
+ * @param value Value to convert
+ * @return int32_t 5.23 word
+ */
+static int32_t floatTo523(float value)
+{
+  return (value * ((int32_t)1 << 23));
+}
+
+
+/**
+ * @brief Normalizes biquad coefficients to a0 and stores them as 5.23 words in
+ *        the order SigmaDSP expects, b0, b1, b2, -a1, -a2
+ *
+ * @param b Numerator b0, b1, b2 in Q8.24
+ * @param a Denominator a0, a1, a2 in Q8.24
+ * @param invertPhase Flip the sign of the b terms (180 deg)
+ * @param invertFeedback Flip the sign of the a1 and a2 terms as well (tone control)
+ * @param coefficients Array of 5 to store the words in
+ */
+static void normalizeBiquad(const dspFixed_t *b, const dspFixed_t *a, bool invertPhase, bool invertFeedback, int32_t *coefficients)
+{
+  for(uint8_t i = 0; i < 3; i++)
+  {
+    dspFixed_t c = dspFixedDiv(b[i], a[0]);
+    coefficients[i] = dspFixedTo523(invertPhase ? -c : c);
+  }
+  for(uint8_t i = 1; i < 3; i++)
+  {
+    dspFixed_t c = dspFixedDiv(a[i], a[0]);
+    coefficients[i + 2] = dspFixedTo523(invertFeedback ? c : -c);
+  }
+}
+
+
+/**
+ * @brief Fills the coefficients of a biquad that is switched off (b0 = 1)
+ */
+static void bypassBiquad(int32_t *coefficients)
+{
+  coefficients[0] = (int32_t)1 << 23;
+  coefficients[1] = 0;
+  coefficients[2] = 0;
+  coefficients[3] = 0;
+  coefficients[4] = 0;
+}
+
+
+/**
+ * @brief Fast sine and cosine. The angle is reduced to +/-pi/4 around the nearest
+ *        quadrant, where Taylor polynomials of degree 9 and 8 are accurate to 3e-8
+ *
+ * @param x Angle in radians, 0 to a few pi
+ * @param sine sin(x)
+ * @param cosine cos(x)
+ */
+static void fastSinCos(float x, float &sine, float &cosine)
+{
+  int16_t quadrant = (int16_t)(x * (1/FAST_HALF_PI) + 0.5f);
+  float r  = x - quadrant * FAST_HALF_PI;
+  float r2 = r * r;
+
+  float s = r * (1 - r2 * (1/6.0f) * (1 - r2 * (1/20.0f) * (1 - r2 * (1/42.0f) * (1 - r2 * (1/72.0f)))));
+  float c = 1 - r2 * 0.5f * (1 - r2 * (1/12.0f) * (1 - r2 * (1/30.0f) * (1 - r2 * (1/56.0f))));
+
+  switch(quadrant & 3)
+  {
+    case 0:  sine =  s; cosine =  c; break;
+    case 1:  sine =  c; cosine = -s; break;
+    case 2:  sine = -s; cosine = -c; break;
+    default: sine = -c; cosine =  s; break;
+  }
+}
+
+
+/**
+ * @brief Fast 2^x. The exponent is rounded to the nearest integer, which is applied
+ *        with ldexp, and 2^f for |f| <= 0.5 is a degree 6 Taylor polynomial
+ *        accurate to 2e-7
+ *
+ * @param x Exponent
+ * @return float 2^x
+ */
+static float fastExp2(float x)
+{
+  int16_t n = (int16_t)(x < 0 ? x - 0.5f : x + 0.5f);
+  float f = (x - n) * FAST_LN2;
+
+  float p = 1 + f * (1 + f * 0.5f * (1 + f * (1/3.0f) * (1 + f * 0.25f * (1 + f * 0.2f * (1 + f * (1/6.0f))))));
+  return ldexp(p, n);
+}
+
+
+/**
+ * @brief Fast 10^x
+ *
+ * @param x Exponent
+ * @return float 10^x
+ */
+static float fastPow10(float x)
+{
+  return fastExp2(x * FAST_LOG2_10);
+}
+
+
+/**
+ * @brief Fast sinh(x). Small arguments use the Taylor series to avoid cancellation
+ *
+ * @param x Argument
+ * @return float sinh(x)
+ */
+static float fastSinh(float x)
+{
+  if(fabs(x) < 0.5f)
+  {
+    float x2 = x * x;
+    return x * (1 + x2 * (1/6.0f) * (1 + x2 * (1/20.0f) * (1 + x2 * (1/42.0f))));
+  }
+  float e = fastExp2(x * FAST_LOG2_E);
+  return (e - 1 / e) / 2;
+}
+
+
+/**
+ * @brief First order EQ coefficient kernel
+ *
+ * @param equalizer Equalizer parameter struct
+ * @param a1 Pole, 2.7^-w0
+ * @param gainLinear 10^(gain/20)
+ * @param coefficients Array of 3 to store b0, b1, a1 in
+ */
+static void firstOrderKernel(const firstOrderEQ_t &equalizer, float a1, float gainLinear, float *coefficients)
+{
+  float b0, b1;
+
+  switch(equalizer.filterType)
+  {
+// Lowpass
+    case parameters::filterType::lowpass:
+    default:
+      b0 = gainLinear * (1.0 - a1);
+      b1 = 0;
+      break;
+
+// Highpass
+    case parameters::filterType::highpass:
+      b0 = gainLinear * a1;
+      b1 = -a1 * gainLinear;
+      break;
+  }
+
+  if(equalizer.state == parameters::state::on)
+  {
+    if(equalizer.phase == parameters::phase::nonInverted) // 0 deg
+    {
+      coefficients[0] = b0;
+      coefficients[1] = b1;
+      coefficients[2] = a1;
+    }
+    else //if(equalizer.phase == parameters::phase::inverted) // 180 deg
+    {
+      coefficients[0] = -1*b0;
+      coefficients[1] = -1*b1;
+      coefficients[2] = a1; // This coefficient does not change sign
+    }
+  }
+  else //if(equalizer.state == parameters::state::off)
+  {
+    coefficients[0] = 1.00;
+    coefficients[1] = 0.00;
+    coefficients[2] = 0.00;
+  }
+}
+
+
+/**
+ * @brief Second order EQ coefficient kernel. Turns the shared basis terms into the
+ *        coefficients of the selected filter type
+ *
+ * @param equalizer Equalizer parameter struct
+ * @param basis Precalculated trig and gain terms
+ * @param fast Use the fast approximations for sinh
+ * @param coefficients Array of 5 to store b0, b1, b2, -a1, -a2 in
+ */
+static void biquadKernel(const secondOrderEQ_t &equalizer, const biquadBasis_t &basis, bool fast, float *coefficients)
+{
+  const float A = basis.A;
+  const float w0 = basis.w0;
+  const float sinW0 = basis.sinW0;
+  const float cosW0 = basis.cosW0;
+  const float sqrtA = basis.sqrtA;
+  const float gainLinear = basis.gainLinear;
+  float alpha;
+  float b0, b1, b2, a0, a1, a2;
+
+  switch(equalizer.filterType)
+  {
+// Parametric
+    case parameters::filterType::parametric:
+// Peaking
+    case parameters::filterType::peaking:
+    default:
+      alpha = sinW0/(2*equalizer.Q);
+      a0 =  1 + alpha/A;
+      a1 = -2 * cosW0;
+      a2 =  1 - alpha/A;
+      b0 = (1 + alpha*A) * gainLinear;
+      b1 = -(2 * cosW0) * gainLinear;
+      b2 = (1 - alpha*A) * gainLinear;
+      break;
+
+// Low shelf
+    case parameters::filterType::lowShelf:
+      alpha=sinW0/2*sqrt((A+1/A)*(1/equalizer.S-1)+2);
+      a0 = (A+1)+(A-1)*cosW0+2*sqrtA*alpha;
+      a1 = -2*((A-1)+(A+1)*cosW0);
+      a2 = (A+1)+(A-1)*cosW0-2*sqrtA*alpha;
+      b0 = A*((A+1)-(A-1)*cosW0+2*sqrtA*alpha)*gainLinear;
+      b1 = 2*A*((A-1)-(A+1)*cosW0) * gainLinear;
+      b2 = A*((A+1)-(A-1)*cosW0-2*sqrtA*alpha)*gainLinear;
+      break;
+
+// High shelf
+    case parameters::filterType::highShelf:
+      alpha = sinW0/2 * sqrt((A + 1/A)*(1/equalizer.S - 1) + 2);
+      a0 = (A+1) - (A-1)*cosW0 + 2*sqrtA*alpha;
+      a1 = 2*((A-1) - (A+1)*cosW0);
+      a2 = (A+1) - (A-1)*cosW0 - 2*sqrtA*alpha;
+      b0 = A*((A+1) + (A-1)*cosW0 + 2*sqrtA*alpha) * gainLinear;
+      b1 = -2*A*((A-1) + (A+1)*cosW0) * gainLinear;
+      b2 = A*((A+1) + (A-1)*cosW0 - 2*sqrtA*alpha) * gainLinear;
+      break;
+
+// Lowpass
+    case parameters::filterType::lowpass:
+      alpha = sinW0/(2*equalizer.Q);
+      a0 = 1 + alpha;
+      a1 = -2*cosW0;
+      a2 = 1 - alpha;
+      b0 = (1 - cosW0) * (gainLinear/2);
+      b1 = (1 - cosW0)  * gainLinear;
+      b2 = (1 - cosW0) * (gainLinear/2);
+      break;
+
+// Highpass
+    case parameters::filterType::highpass:
+      alpha = sinW0/(2*equalizer.Q);
+      a0 = 1 + alpha;
+      a1 = -2*cosW0;
+      a2 = 1 - alpha;
+      b0 = (1 + cosW0) * (gainLinear/2);
+      b1 = -(1 + cosW0) * gainLinear;
+      b2 = (1 + cosW0) * (gainLinear/2);
+      break;
+
+// Bandpass
+    case parameters::filterType::bandpass:
+      if(fast)
+        alpha = sinW0 * fastSinh(FAST_LN2/(2 * equalizer.bandwidth * w0/sinW0));
+      else
+        alpha = sinW0 * sinh(log(2)/(2 * equalizer.bandwidth * w0/sinW0));
+      a0 = 1 + alpha;
+      a1 = -2*cosW0;
+      a2 = 1 - alpha;
+      b0 = alpha * gainLinear;
+      b1 = 0;
+      b2 = -alpha * gainLinear;
+      break;
+
+// Bandstop
+    case parameters::filterType::bandstop:
+      if(fast)
+        alpha = sinW0 * fastSinh(FAST_LN2/(2 * equalizer.bandwidth * w0/sinW0));
+      else
+        alpha = sinW0 * sinh(log(2)/(2 * equalizer.bandwidth * w0/sinW0));
+      a0 = 1 + alpha;
+      a1 = -2*cosW0;
+      a2 = 1 - alpha;
+      b0 = 1 * gainLinear;
+      b1 = -2*cosW0 * gainLinear;
+      b2 = 1 * gainLinear;
+      break;
+
+// Butterworth lowpass
+    case parameters::filterType::butterworthLowpass:
+      alpha = sinW0 / 2.0 * 1/sqrt(2);
+      a0 = 1 + alpha;
+      a1 = -2*cosW0;
+      a2 = 1 - alpha;
+      b0 = (1 - cosW0) * gainLinear / 2;
+      b1 = (1 - cosW0) * gainLinear;
+      b2 = (1 - cosW0) * gainLinear / 2;
+      break;
+
+// Butterworth highpass
+    case parameters::filterType::butterworthHighpass:
+      alpha = sinW0 / 2.0 * 1/sqrt(2);
+      a0 = 1 + alpha;
+      a1 = -2*cosW0;
+      a2 = 1 - alpha;
+      b0 = (1 + cosW0) * gainLinear / 2;
+      b1 = -(1 + cosW0) * gainLinear;
+      b2 = (1 + cosW0) * gainLinear / 2;
+      break;
+
+// Bessel lowpass
+    case parameters::filterType::besselLowpass:
+      alpha = sinW0 / 2.0 * 1/sqrt(3) ;
+      a0 = 1 + alpha;
+      a1 = -2*cosW0;
+      a2 = 1 - alpha;
+      b0 = (1 - cosW0) * gainLinear / 2;
+      b1 = (1 - cosW0) * gainLinear;
+      b2 = (1 - cosW0) * gainLinear / 2;
+      break;
+
+// Bessel highpass
+    case parameters::filterType::besselHighpass:
+      alpha = sinW0 / 2.0 * 1/sqrt(3) ;
+      a0 = 1 + alpha;
+      a1 = -2*cosW0;
+      a2 = 1 - alpha;
+      b0 = (1 + cosW0) * gainLinear / 2;
+      b1 = -(1 + cosW0) * gainLinear;
+      b2 = (1 + cosW0) * gainLinear / 2;
+      break;
+  }
+
+  // For Sigma DSP implementation we need to normalize all the coefficients respect to a0
+  // and inverting by sign a1 and a2
+  if(a0 != 0.00 && equalizer.state == parameters::state::on)
+  {
+    if(equalizer.phase == parameters::phase::nonInverted) // 0 deg
+    {
+      coefficients[0] = b0/a0;
+      coefficients[1] = b1/a0;
+      coefficients[2] = b2/a0;
+      coefficients[3] = -1*a1/a0;
+      coefficients[4] = -1*a2/a0;
+    }
+    else //if(equalizer.phase == parameters::phase::inverted) // 180 deg
+    {
+      coefficients[0] = -1*b0/a0;
+      coefficients[1] = -1*b1/a0;
+      coefficients[2] = -1*b2/a0;
+      coefficients[3] = -1*a1/a0; // This coefficient does not change sign!
+      coefficients[4] = -1*a2/a0; // This coefficient does not change sign!
+    }
+  }
+  else //if(equalizer.state == parameters::state::off)
+  {
+    coefficients[0] = 1.00;
+    coefficients[1] = 0;
+    coefficients[2] = 0;
+    coefficients[3] = 0;
+    coefficients[4] = 0;
+  }
+}
+
+
+/**
+ * @brief Calculates the level dependent part of a compressor curve in fixed point
+ *
+ * @param compressor Compressor parameter struct
+ * @param points Number of points on the curve, spaced from -90 to +6dB
+ * @param parameters Array to store the 5.23 curve words in
+ */
+static void compressorCurve(const compressor_t &compressor, uint8_t points, int32_t *parameters)
+{
+  dspFixed_t step = (dspFixed_t)((96L << FIXED_FRACTION_BITS) / points);
+  dspFixed_t threshold = dspFixedFromFloat(compressor.threshold);
+  dspFixed_t coeff = dspFixedReciprocal(dspFixedFromFloat(compressor.ratio));
+  dspFixed_t delta = 0;
+  bool above = false;
+
+  for(uint8_t i = 0; i < points; i++)
+  {
+    dspFixed_t x = -(90L << FIXED_FRACTION_BITS) + step * i;
+    dspFixed_t y = x;
+    if(x >= threshold)
+    {
+      if(!above)
+        delta = dspFixedMul(x, coeff) - x;
+      above = true;
+      y = dspFixedMul(x, coeff) - delta;
+    }
+    // Coefficients are the ratio between the linearized values of y and x
+    parameters[i] = dspFixedTo523(dspFixedDecibelsToLinear(y - x));
+  }
+}
+
+
+/**
+ * @brief Calculates the level independent part of a compressor, hold and decay.
+ *        Plain scaling, so float is used the same way as the float path
+ *
+ * @param compressor Compressor parameter struct
+ * @param fs Sample rate in [Hz]
+ * @param parameters Array of 2 to store hold and decay in
+ */
+static void compressorTiming(const compressor_t &compressor, float fs, float *parameters)
+{
+  // Hold
+  parameters[0] = compressor.hold*fs/1000;
+
+  // Decay (dB/s)
+  float dbps = (20/(compressor.decay*2.3))*1e3;
+  parameters[1] = dbps/(96*fs);
+}
+
+
+/*******************************************************************************************
+**                                    PUBLIC FUNCTIONS                                    **
+*******************************************************************************************/
+
+/**
+ * @brief Converts a level in dB to a linear gain, 10^(dB/20)
+ *
+ * @param dB Level in dB
+ * @param gain Linear gain
+ */
+void dspDecibelsToLinear(float dB, float &gain)
+{
+  gain = pow(10, dB / 20);
+}
+
+
+/**
+ * @brief Converts a level in dB to a linear gain, 10^(dB/20)
+ *
+ * @param dB Level in dB, up to +24dB
+ * @param gain Linear gain as a 5.23 word
+ */
+void dspDecibelsToLinear(float dB, int32_t &gain)
+{
+  gain = dspFixedTo523(dspFixedDecibelsToLinear(dspFixedFromFloat(dB)));
+}
+
+
+/**
+ * @brief Calculates the coefficients of a first order EQ block
+ *
+ * @param equalizer Equalizer parameter struct
+ * @param fs Sample rate in [Hz]
+ * @param coefficients Array of 3 to store b0, b1, a1 in
+ */
+void dspFirstOrderEQ(const firstOrderEQ_t &equalizer, float fs, float *coefficients)
+{
+  float w0 = 2*PI*equalizer.freq/fs; //2*PI*freq/FS
+  firstOrderKernel(equalizer, pow(2.7,-w0), pow(10,(equalizer.gain/20)), coefficients);
+}
+
+
+/**
+ * @brief Calculates the coefficients of a first order EQ block with fast approximations of pow
+ *
+ * @param equalizer Equalizer parameter struct
+ * @param fs Sample rate in [Hz]
+ * @param coefficients Array of 3 to store b0, b1, a1 in
+ */
+void dspFirstOrderEQFast(const firstOrderEQ_t &equalizer, float fs, float *coefficients)
+{
+  float w0 = 2 * (float)PI * equalizer.freq / fs;
+  firstOrderKernel(equalizer, fastExp2(-w0 * FAST_LOG2_2_7), fastPow10(equalizer.gain / 20), coefficients);
+}
+
+
+/**
+ * @brief Calculates the coefficients of a first order EQ block in fixed point
+ *
+ * @param equalizer Equalizer parameter struct
+ * @param fs Sample rate in [Hz]
+ * @param coefficients Array of 3 to store the b0, b1, a1 5.23 words in
+ */
+void dspFirstOrderEQ(const firstOrderEQ_t &equalizer, float fs, int32_t *coefficients)
+{
+  dspFixed_t w0 = phaseToRadians(frequencyToPhase(equalizer.freq, fs));
+  dspFixed_t a1 = dspFixedExp2(-dspFixedMul(w0, FIXED_LOG2_2_7)); // 2.7^-w0
+  dspFixed_t gainLinear = dspFixedDecibelsToLinear(dspFixedFromFloat(equalizer.gain));
+  dspFixed_t b0, b1;
+
+  switch(equalizer.filterType)
+  {
+// Lowpass
+    case parameters::filterType::lowpass:
+    default:
+      b0 = dspFixedMul(gainLinear, FIXED_ONE - a1);
+      b1 = 0;
+      break;
+
+// Highpass
+    case parameters::filterType::highpass:
+      b0 = dspFixedMul(gainLinear, a1);
+      b1 = -b0;
+      break;
+  }
+
+  if(equalizer.state == parameters::state::on)
+  {
+    bool inverted = equalizer.phase == parameters::phase::inverted;
+    coefficients[0] = dspFixedTo523(inverted ? -b0 : b0);
+    coefficients[1] = dspFixedTo523(inverted ? -b1 : b1);
+    coefficients[2] = dspFixedTo523(a1); // This coefficient does not change sign
+  }
+  else
+  {
+    coefficients[0] = (int32_t)1 << 23;
+    coefficients[1] = 0;
+    coefficients[2] = 0;
+  }
+}
+
+
+/**
+ * @brief Fixed point designs don't use any float math to begin with
+ */
+void dspFirstOrderEQFast(const firstOrderEQ_t &equalizer, float fs, int32_t *coefficients)
+{
+  dspFirstOrderEQ(equalizer, fs, coefficients);
+}
+
+
+/**
+ * @brief Calculates the coefficients of a second order EQ block
+ *
+ * @param equalizer Equalizer parameter struct
+ * @param fs Sample rate in [Hz]
+ * @param coefficients Array of 5 to store b0, b1, b2, -a1, -a2 in
+ */
+void dspSecondOrderEQ(const secondOrderEQ_t &equalizer, float fs, float *coefficients)
+{
+  biquadBasis_t basis;
+
+  basis.A=pow(10,(equalizer.boost/40));           // 10^(boost/40)
+  basis.w0=2*PI*equalizer.freq/fs;                // 2*PI*freq/FS
+  basis.gainLinear = pow(10,(equalizer.gain/20)); // 10^(gain/20)
+  basis.sinW0 = sin(basis.w0);
+  basis.cosW0 = cos(basis.w0);
+  basis.sqrtA = sqrt(basis.A);
+
+  biquadKernel(equalizer, basis, false, coefficients);
+}
+
+
+/**
+ * @brief Calculates the coefficients of a second order EQ block with fast approximations
+ *        of sin, cos and pow. Stays within a few 5.23 LSBs of dspSecondOrderEQ,
+ *        see extras/coefficient_benchmark.cpp
+ *
+ * @param equalizer Equalizer parameter struct
+ * @param fs Sample rate in [Hz]
+ * @param coefficients Array of 5 to store b0, b1, b2, -a1, -a2 in
+ */
+void dspSecondOrderEQFast(const secondOrderEQ_t &equalizer, float fs, float *coefficients)
+{
+  biquadBasis_t basis;
+
+  basis.A = fastPow10(equalizer.boost / 40);
+  basis.sqrtA = fastPow10(equalizer.boost / 80);
+  basis.w0 = 2 * (float)PI * equalizer.freq / fs;
+  basis.gainLinear = fastPow10(equalizer.gain / 20);
+  fastSinCos(basis.w0, basis.sinW0, basis.cosW0);
+
+  biquadKernel(equalizer, basis, true, coefficients);
+}
+
+
+/**
+ * @brief Calculates the coefficients of a second order EQ block in fixed point.
+ *        Same formulas as the float version
+ *
+ * @param equalizer Equalizer parameter struct
+ * @param fs Sample rate in [Hz]
+ * @param coefficients Array of 5 to store the b0, b1, b2, -a1, -a2 5.23 words in
+ */
+void dspSecondOrderEQ(const secondOrderEQ_t &equalizer, float fs, int32_t *coefficients)
+{
+  dspFixed_t A, sinW0, cosW0, alpha, gainLinear, t;
+  dspFixed_t b[3], a[3];
+
+  dspFixed_t boost = dspFixedFromFloat(equalizer.boost);
+  A = dspFixedDecibelsToLinear(boost / 2);                               // 10^(boost/40)
+  gainLinear = dspFixedDecibelsToLinear(dspFixedFromFloat(equalizer.gain)); // 10^(gain/20)
+
+  uint32_t phase = frequencyToPhase(equalizer.freq, fs);
+  dspFixedSinCos(phase, sinW0, cosW0);
+
+  dspFixed_t halfGain = gainLinear / 2;
+  dspFixed_t twoCos = 2 * cosW0;
+
+  switch(equalizer.filterType)
+  {
+// Parametric
+    case parameters::filterType::parametric:
+// Peaking
+    case parameters::filterType::peaking:
+    default:
+      alpha = dspFixedDiv(sinW0, 2 * dspFixedFromFloat(equalizer.Q));
+      t = dspFixedDiv(alpha, A);
+      a[0] = FIXED_ONE + t;
+      a[1] = -twoCos;
+      a[2] = FIXED_ONE - t;
+      t = dspFixedMul(alpha, A);
+      b[0] = dspFixedMul(FIXED_ONE + t, gainLinear);
+      b[1] = dspFixedMul(-twoCos, gainLinear);
+      b[2] = dspFixedMul(FIXED_ONE - t, gainLinear);
+      break;
+
+// Low shelf and high shelf share everything but a few signs
+    case parameters::filterType::lowShelf:
+    case parameters::filterType::highShelf:
+    {
+      dspFixed_t slope = dspFixedReciprocal(dspFixedFromFloat(equalizer.S)) - FIXED_ONE;
+      alpha = dspFixedMul(sinW0 / 2, dspFixedSqrt(dspFixedMul(A + dspFixedReciprocal(A), slope) + 2 * FIXED_ONE));
+      t = 2 * dspFixedMul(dspFixedSqrt(A), alpha);      // 2*sqrt(A)*alpha
+      dspFixed_t Ap = A + FIXED_ONE;                    // A+1
+      dspFixed_t Am = A - FIXED_ONE;                    // A-1
+      dspFixed_t AmCos = dspFixedMul(Am, cosW0);        // (A-1)*cos(w0)
+      dspFixed_t ApCos = dspFixedMul(Ap, cosW0);        // (A+1)*cos(w0)
+      dspFixed_t Ag = dspFixedMul(A, gainLinear);
+
+      if(equalizer.filterType == parameters::filterType::lowShelf)
+      {
+        a[0] = Ap + AmCos + t;
+        a[1] = -2 * (Am + ApCos);
+        a[2] = Ap + AmCos - t;
+        b[0] = dspFixedMul(Ap - AmCos + t, Ag);
+        b[1] = dspFixedMul(2 * (Am - ApCos), Ag);
+        b[2] = dspFixedMul(Ap - AmCos - t, Ag);
+      }
+      else
+      {
+        a[0] = Ap - AmCos + t;
+        a[1] = 2 * (Am - ApCos);
+        a[2] = Ap - AmCos - t;
+        b[0] = dspFixedMul(Ap + AmCos + t, Ag);
+        b[1] = dspFixedMul(-2 * (Am + ApCos), Ag);
+        b[2] = dspFixedMul(Ap + AmCos - t, Ag);
+      }
+      break;
+    }
+
+// Lowpass
+    case parameters::filterType::lowpass:
+// Butterworth lowpass
+    case parameters::filterType::butterworthLowpass:
+// Bessel lowpass
+    case parameters::filterType::besselLowpass:
+      if(equalizer.filterType == parameters::filterType::butterworthLowpass)
+        alpha = dspFixedMul(sinW0, FIXED_BUTTERWORTH);
+      else if(equalizer.filterType == parameters::filterType::besselLowpass)
+        alpha = dspFixedMul(sinW0, FIXED_BESSEL);
+      else
+        alpha = dspFixedDiv(sinW0, 2 * dspFixedFromFloat(equalizer.Q));
+      a[0] = FIXED_ONE + alpha;
+      a[1] = -twoCos;
+      a[2] = FIXED_ONE - alpha;
+      b[0] = dspFixedMul(FIXED_ONE - cosW0, halfGain);
+      b[1] = dspFixedMul(FIXED_ONE - cosW0, gainLinear);
+      b[2] = b[0];
+      break;
+
+// Highpass
+    case parameters::filterType::highpass:
+// Butterworth highpass
+    case parameters::filterType::butterworthHighpass:
+// Bessel highpass
+    case parameters::filterType::besselHighpass:
+      if(equalizer.filterType == parameters::filterType::butterworthHighpass)
+        alpha = dspFixedMul(sinW0, FIXED_BUTTERWORTH);
+      else if(equalizer.filterType == parameters::filterType::besselHighpass)
+        alpha = dspFixedMul(sinW0, FIXED_BESSEL);
+      else
+        alpha = dspFixedDiv(sinW0, 2 * dspFixedFromFloat(equalizer.Q));
+      a[0] = FIXED_ONE + alpha;
+      a[1] = -twoCos;
+      a[2] = FIXED_ONE - alpha;
+      b[0] = dspFixedMul(FIXED_ONE + cosW0, halfGain);
+      b[1] = dspFixedMul(-(FIXED_ONE + cosW0), gainLinear);
+      b[2] = b[0];
+      break;
+
+// Bandpass
+    case parameters::filterType::bandpass:
+// Bandstop
+    case parameters::filterType::bandstop:
+    {
+      // alpha = sin(w0) * sinh(ln(2)/2 * bw * sin(w0)/w0)
+      dspFixed_t w0 = phaseToRadians(phase);
+      dspFixed_t bandwidth = 2 * dspFixedFromFloat(equalizer.bandwidth);
+      t = dspFixedExp(dspFixedMul(FIXED_LN2, dspFixedDiv(dspFixedDiv(sinW0, w0), bandwidth)));
+      alpha = dspFixedMul(sinW0, (t - dspFixedReciprocal(t)) / 2);
+      a[0] = FIXED_ONE + alpha;
+      a[1] = -twoCos;
+      a[2] = FIXED_ONE - alpha;
+      if(equalizer.filterType == parameters::filterType::bandpass)
+      {
+        b[0] = dspFixedMul(alpha, gainLinear);
+        b[1] = 0;
+        b[2] = -b[0];
+      }
+      else
+      {
+        b[0] = gainLinear;
+        b[1] = dspFixedMul(-twoCos, gainLinear);
+        b[2] = gainLinear;
+      }
+      break;
+    }
+  }
+
+  if(a[0] != 0 && equalizer.state == parameters::state::on)
+    normalizeBiquad(b, a, equalizer.phase == parameters::phase::inverted, false, coefficients);
+  else
+    bypassBiquad(coefficients);
+}
+
+
+/**
+ * @brief Fixed point designs don't use any float math to begin with
+ */
+void dspSecondOrderEQFast(const secondOrderEQ_t &equalizer, float fs, int32_t *coefficients)
+{
+  dspSecondOrderEQ(equalizer, fs, coefficients);
+}
+
+
+/**
+ * @brief Calculates the coefficients of a baxandall low-high dual tone control block
+ *
+ * @param toneCtrl Tone control parameter struct
+ * @param fs Sample rate in [Hz]
+ * @param coefficients Array of 5 to store b0, b1, b2, -a1, -a2 in
+ */
+void dspToneControl(const toneCtrl_t &toneCtrl, float fs, float *coefficients)
+{
+  float tb,bb,wT,wB,Knum_T,Kden_T,Knum_B,Kden_B,alpha0,beta1,alpha1,beta2,alpha2,beta3,alpha3,beta4;
+  float b0,b1,b2,a0,a1,a2;
+
+  tb = pow(10, toneCtrl.boost_Treble_dB / 20.0);
+  bb = pow(10, toneCtrl.boost_Bass_dB / 20.0);
+
+  wT = tan(PI * toneCtrl.freq_Treble / fs);
+  wB = tan(PI * toneCtrl.freq_Bass / fs);
+
+  Knum_T = 2 / (1 + (1.0 / tb));
+  Kden_T = 2 / (1 + tb);
+  Knum_B = 2.0 / (1.0 + (1.0 / bb));
+  Kden_B = 2.0 / (1.0 + bb);
+
+  alpha0 = wT + Kden_T;
+  beta1 = wT + Knum_T;
+  alpha1 = wT - Kden_T;
+  beta2 = wT - Knum_T;
+
+  alpha2 = (wB*Kden_B) + 1;
+  beta3 = (wB*Knum_B) - 1;
+  alpha3 = (wB*Kden_B) - 1;
+  beta4 = (wB*Knum_B) + 1;
+
+  a0 = alpha0 * alpha2;
+  a1 = (alpha0 * alpha3) + (alpha1 * alpha2);
+  a2 = alpha1 * alpha3;
+  b0 = beta1 * beta3;
+  b1 = (beta1 * beta4) + (beta2 * beta3);
+  b2 = beta2 * beta4;
+
+  // For Sigma DSP implementation we need to normalize all the coefficients respect to a0
+  // and inverting a1 and a2 by sign
+  if(a0 != 0.00 && toneCtrl.state == parameters::state::on)
+  {
+    if(toneCtrl.phase == parameters::phase::nonInverted) // 0 deg
+    {
+      coefficients[0] = b0/a0;
+      coefficients[1] = b1/a0;
+      coefficients[2] = b2/a0;
+      coefficients[3] = -1*a1/a0;
+      coefficients[4] = -1*a2/a0;
+    }
+    else //if(toneCtrl.phase == parameters::phase::inverted) // 180 deg
+    {
+      coefficients[0] = -1*b0/a0;
+      coefficients[1] = -1*b1/a0;
+      coefficients[2] = -1*b2/a0;
+      coefficients[3] = a1/a0;
+      coefficients[4] = a2/a0;
+    }
+  }
+  else //if(toneCtrl.state == parameters::state::off)
+  {
+    coefficients[0] = 1.00;
+    coefficients[1] = 0;
+    coefficients[2] = 0;
+    coefficients[3] = 0;
+    coefficients[4] = 0;
+  }
+}
+
+
+/**
+ * @brief Calculates the coefficients of a baxandall tone control block in fixed point.
+ *        Same formulas as the float version
+ *
+ * @param toneCtrl Tone control parameter struct
+ * @param fs Sample rate in [Hz]
+ * @param coefficients Array of 5 to store the b0, b1, b2, -a1, -a2 5.23 words in
+ */
+void dspToneControl(const toneCtrl_t &toneCtrl, float fs, int32_t *coefficients)
+{
+  dspFixed_t s, c;
+  dspFixed_t b[3], a[3];
+
+  dspFixed_t tb = dspFixedDecibelsToLinear(dspFixedFromFloat(toneCtrl.boost_Treble_dB));
+  dspFixed_t bb = dspFixedDecibelsToLinear(dspFixedFromFloat(toneCtrl.boost_Bass_dB));
+
+  // tan(pi*f/fs), half the angle of the biquad designers
+  dspFixedSinCos(frequencyToPhase(toneCtrl.freq_Treble, 2 * fs), s, c);
+  dspFixed_t wT = dspFixedDiv(s, c);
+  dspFixedSinCos(frequencyToPhase(toneCtrl.freq_Bass, 2 * fs), s, c);
+  dspFixed_t wB = dspFixedDiv(s, c);
+
+  // 2/(1 + 1/x) is 2x/(x + 1)
+  dspFixed_t invT = dspFixedReciprocal(FIXED_ONE + tb);
+  dspFixed_t invB = dspFixedReciprocal(FIXED_ONE + bb);
+  dspFixed_t Knum_T = 2 * dspFixedMul(tb, invT);
+  dspFixed_t Kden_T = 2 * invT;
+  dspFixed_t Knum_B = 2 * dspFixedMul(bb, invB);
+  dspFixed_t Kden_B = 2 * invB;
+
+  dspFixed_t alpha0 = wT + Kden_T;
+  dspFixed_t beta1  = wT + Knum_T;
+  dspFixed_t alpha1 = wT - Kden_T;
+  dspFixed_t beta2  = wT - Knum_T;
+
+  dspFixed_t alpha2 = dspFixedMul(wB, Kden_B) + FIXED_ONE;
+  dspFixed_t beta3  = dspFixedMul(wB, Knum_B) - FIXED_ONE;
+  dspFixed_t alpha3 = dspFixedMul(wB, Kden_B) - FIXED_ONE;
+  dspFixed_t beta4  = dspFixedMul(wB, Knum_B) + FIXED_ONE;
+
+  a[0] = dspFixedMul(alpha0, alpha2);
+  a[1] = dspFixedMul(alpha0, alpha3) + dspFixedMul(alpha1, alpha2);
+  a[2] = dspFixedMul(alpha1, alpha3);
+  b[0] = dspFixedMul(beta1, beta3);
+  b[1] = dspFixedMul(beta1, beta4) + dspFixedMul(beta2, beta3);
+  b[2] = dspFixedMul(beta2, beta4);
+
+  // The inverted tone control flips the sign of the feedback terms too
+  bool inverted = toneCtrl.phase == parameters::phase::inverted;
+  if(a[0] != 0 && toneCtrl.state == parameters::state::on)
+    normalizeBiquad(b, a, inverted, inverted, coefficients);
+  else
+    bypassBiquad(coefficients);
+}
+
+
+/**
+ * @brief Calculates the frequency and boost parameters of a dynamic bass block.
+ *        Formula found here: https://ez.analog.com/dsp/sigmadsp/f/q-a/65338/dynamic-bass-boost-basics
+ *
+ * @param dB Boost level, 0 to +20dB
+ * @param frequency Center frequency of the boosting filter, 20 to 300Hz
+ * @param fs Sample rate in [Hz]
+ * @param parameters Array of 7 to store the frequency, the five iir coefficients and the boost in
+ */
+void dspDynamicBass(float dB, uint16_t frequency, float fs, float *parameters)
+{
+  float omega       = 2 * pi * ((frequency * 3) / fs);
+  float alpha       = sin(omega)/(2 * 0.707);
+  float a0          = 1 + alpha;
+  float gain_lin    = 1.00;
+
+  parameters[0] = 2 * pi * (frequency / fs);                  // freq_varq
+  parameters[1] = (1 - cos(omega)) * gain_lin / (2 * a0);    // iir_coeff_0
+  parameters[2] = (1 - cos(omega)) * gain_lin / a0;          // iir_coeff_1
+  parameters[3] = (1 - cos(omega)) * gain_lin / (2 * a0);    // iir_coeff_2
+  parameters[4] = (2 / a0) * cos(omega);                     // iir_coeff_3
+  parameters[5] = (alpha - 1) / a0;                          // iir_coeff_4
+  // Boost are independent from the frequency and iir coefficients
+  parameters[6] = pow(10, -dB / 20);
+}
+
+
+/**
+ * @brief Calculates the frequency and boost parameters of a dynamic bass block in fixed point
+ *
+ * @param dB Boost level, 0 to +20dB
+ * @param frequency Center frequency of the boosting filter, 20 to 300Hz
+ * @param fs Sample rate in [Hz]
+ * @param parameters Array of 7 to store the 5.23 words in
+ */
+void dspDynamicBass(float dB, uint16_t frequency, float fs, int32_t *parameters)
+{
+  dspFixed_t s, c;
+  dspFixedSinCos(frequencyToPhase(frequency * 3, fs), s, c);
+
+  dspFixed_t alpha = dspFixedMul(s, FIXED_DYNAMIC_BASS_Q);
+  dspFixed_t inv = dspFixedReciprocal(FIXED_ONE + alpha);
+  dspFixed_t lowpass = dspFixedMul(FIXED_ONE - c, inv);
+
+  parameters[0] = dspFixedTo523(phaseToRadians(frequencyToPhase(frequency, fs)));
+  parameters[1] = dspFixedTo523(lowpass / 2);
+  parameters[2] = dspFixedTo523(lowpass);
+  parameters[3] = parameters[1];
+  parameters[4] = dspFixedTo523(2 * dspFixedMul(c, inv));
+  parameters[5] = dspFixedTo523(dspFixedMul(alpha - FIXED_ONE, inv));
+  parameters[6] = dspFixedTo523(dspFixedDecibelsToLinear(dspFixedFromFloat(-dB)));
+}
+
+
+/**
+ * @brief Calculates the detector parameters of a dynamic bass block
+ *
+ * @param threshold Detector threshold, -24 to +20dB
+ * @param time_constant RMS time constant of the detector, 0 to 500 milliseconds
+ * @param fs Sample rate in [Hz]
+ * @param parameters Array of 2 to store the time constant and threshold in
+ */
+void dspDynamicBassDetector(int16_t threshold, uint16_t time_constant, float fs, float *parameters)
+{
+  parameters[0] = 1000 / (time_constant * fs);
+  parameters[1] = exp(0.029 * threshold);
+}
+
+
+/**
+ * @brief Calculates the detector parameters of a dynamic bass block in fixed point
+ *
+ * @param threshold Detector threshold, -24 to +20dB
+ * @param time_constant RMS time constant of the detector, 0 to 500 milliseconds
+ * @param fs Sample rate in [Hz]
+ * @param parameters Array of 2 to store the 5.23 words in
+ */
+void dspDynamicBassDetector(int16_t threshold, uint16_t time_constant, float fs, int32_t *parameters)
+{
+  // exp(0.029 * 150) is already past the 5.23 range
+  if(threshold > 150)
+    threshold = 150;
+  else if(threshold < -150)
+    threshold = -150;
+
+  parameters[0] = floatTo523(1000 / (time_constant * fs));
+  parameters[1] = dspFixedTo523(dspFixedExp(threshold * FIXED_BASS_THRESHOLD));
+}
+
+
+/**
+ * @brief Calculates the parameters of an RMS compressor block
+ *
+ * @param compressor Compressor parameter struct
+ * @param fs Sample rate in [Hz]
+ * @param parameters Array of 38 to store the 34 curve points, attack, postgain, hold and decay in
+ */
+void dspCompressorRMS(const compressor_t &compressor, float fs, float *parameters)
+{
+  uint8_t i;
+  uint8_t count;
+
+  float x[34];
+  float y[34];
+  float delta = 0.00;
+  float coeff = 0.00;
+  float dbps = 0.00;
+
+  linspace(-90, 6, 34, x);
+
+  count = 0;
+
+  coeff = 1/compressor.ratio;
+  for(i = 0; i < 34; i++) // This algorithm creates the curve with 1 1 1 1 1 1 1 0.9 0.8 0.72 0.64 and so on coefficients
+  {
+    if(x[i] >= compressor.threshold)
+    {
+      count++;
+      if(count == 1)
+        delta = x[i]*coeff-x[i]*1;
+      y[i] = (x[i] * coeff)-delta;
+    }
+    else
+      y[i] = x[i] * 1;
+  }
+
+  for(i = 0; i < 34; i++)  // Coefficients of the curve calculation
+    parameters[i] = (pow(10, y[i]/20)) / (pow(10, x[i]/20));  // Coefficients are the ratio between the linearized values of vect. y and x
+
+  // Conversion dBps -> ms
+  // dBps = 121;
+  // TCms = (20/(dBps*2.3))*1000
+
+  // RMS TC (dB/s)
+  dbps = (20/(compressor.rms_tc*2.3))*1e3;
+  parameters[34] = fabs(1.0 - pow(10,(dbps/(10*fs))));
+
+  parameters[35] = pow(10, compressor.postgain/20);
+  compressorTiming(compressor, fs, &parameters[36]);
+}
+
+
+/**
+ * @brief Calculates the parameters of an RMS compressor block in fixed point
+ *
+ * @param compressor Compressor parameter struct
+ * @param fs Sample rate in [Hz]
+ * @param parameters Array of 38 to store the 5.23 words in
+ */
+void dspCompressorRMS(const compressor_t &compressor, float fs, int32_t *parameters)
+{
+  float timing[2];
+
+  compressorCurve(compressor, 34, parameters);
+
+  // RMS TC (dB/s). 10^(dbps/(10*fs)) is 2*dbps/fs in dB
+  float dbps = (20/(compressor.rms_tc*2.3))*1e3;
+  dspFixed_t attack = FIXED_ONE - dspFixedDecibelsToLinear(dspFixedFromFloat(2 * dbps / fs));
+  parameters[34] = dspFixedTo523(attack < 0 ? -attack : attack);
+
+  parameters[35] = dspFixedTo523(dspFixedDecibelsToLinear(dspFixedFromFloat(compressor.postgain)));
+  compressorTiming(compressor, fs, timing);
+  parameters[36] = floatTo523(timing[0]);
+  parameters[37] = floatTo523(timing[1]);
+}
+
+
+/**
+ * @brief Calculates the parameters of a peak compressor block
+ *
+ * @param compressor Compressor parameter struct
+ * @param fs Sample rate in [Hz]
+ * @param parameters Array of 36 to store the 33 curve points, postgain, hold and decay in
+ */
+void dspCompressorPeak(const compressor_t &compressor, float fs, float *parameters)
+{
+  uint8_t i;
+  uint8_t count;
+
+  float x[33];
+  float y[33];
+  float delta = 0.00;
+  float coeff = 0.00;
+
+  linspace(-90, 6, 33, x);
+
+  count = 0;
+
+  coeff = 1/compressor.ratio;
+  for(i = 0; i < 33; i++) // This algorithm creates the curve with 1 1 1 1 1 1 1 0.9 0.8 0.72 0.64 and so on coefficients
+  {
+    if(x[i] >= compressor.threshold)
+    {
+      count++;
+      if(count == 1)
+        delta = x[i]*coeff-x[i]*1;
+      y[i] = (x[i] * coeff)-delta;
+    }
+    else
+      y[i] = x[i] * 1;
+  }
+
+  for(i = 0; i < 33; i++)  // Coefficients of the curve calculation
+    parameters[i] = (pow(10, y[i]/20)) / (pow(10, x[i]/20));  // Coefficients are the ratio between the linearized values of vect. y and x
+
+  parameters[33] = pow(10, compressor.postgain/40);
+  compressorTiming(compressor, fs, &parameters[34]);
+}
+
+
+/**
+ * @brief Calculates the parameters of a peak compressor block in fixed point
+ *
+ * @param compressor Compressor parameter struct
+ * @param fs Sample rate in [Hz]
+ * @param parameters Array of 36 to store the 5.23 words in
+ */
+void dspCompressorPeak(const compressor_t &compressor, float fs, int32_t *parameters)
+{
+  float timing[2];
+
+  compressorCurve(compressor, 33, parameters);
+
+  parameters[33] = dspFixedTo523(dspFixedDecibelsToLinear(dspFixedFromFloat(compressor.postgain) / 2));
+  compressorTiming(compressor, fs, timing);
+  parameters[34] = floatTo523(timing[0]);
+  parameters[35] = floatTo523(timing[1]);
+}
@@ -0,0 +1,67 @@
+#ifndef DSPFILTERDESIGN_H
+#define DSPFILTERDESIGN_H
+
+#include <stdint.h>
+#include "parameters.h"
+#include "DSPFixedPoint.h"
+
+// Define to let SigmaDSP calculate filter, tone control, dynamic bass and compressor
+// parameters with the integer engine in DSPFixedPoint instead of float math.
+// Recommended on MCUs without an FPU (AVR, Cortex-M0), where the float path spends
+// most of its time in soft-float sin/cos/pow. The results match the float path to
+// a few LSBs, see extras/coefficient_accuracy.cpp
+//#define SIGMADSP_FIXED_POINT_COEFFICIENTS
+
+// Define to let SigmaDSP design float EQ coefficients with fast approximations of
+// sin, cos and pow instead of the math library. The coefficients stay within a few
+// 5.23 LSBs, see extras/coefficient_benchmark.cpp
+//#define SIGMADSP_FAST_MATH
+
+// Coefficient type SigmaDSP calculates with. float values are converted by
+// safeload_write, int32_t values are already 5.23 words
+#ifdef SIGMADSP_FIXED_POINT_COEFFICIENTS
+  typedef int32_t dspCoefficient_t;
+#else
+  typedef float dspCoefficient_t;
+#endif
+
+// Number of parameter words each designer produces
+#define DYNAMIC_BASS_WORDS   7
+#define COMPRESSOR_RMS_WORDS 38
+#define COMPRESSOR_PEAK_WORDS 36
+
+/**
+ * Coefficient designers for the SigmaDSP algorithm blocks. Every designer comes in
+ * a float version and a fixed-point version that writes finished 5.23 words, the
+ * output type selects which one runs. The EQ designers also have a *Fast version
+ * that evaluates sin, cos and pow with short polynomials. Doesn't depend on Arduino,
+ * so all paths can be built and compared on a host.
+ */
+
+void dspDecibelsToLinear(float dB, float &gain);
+void dspDecibelsToLinear(float dB, int32_t &gain);
+
+void dspFirstOrderEQ(const firstOrderEQ_t &equalizer, float fs, float *coefficients);
+void dspFirstOrderEQ(const firstOrderEQ_t &equalizer, float fs, int32_t *coefficients);
+void dspFirstOrderEQFast(const firstOrderEQ_t &equalizer, float fs, float *coefficients);
+void dspFirstOrderEQFast(const firstOrderEQ_t &equalizer, float fs, int32_t *coefficients);
+
+void dspSecondOrderEQ(const secondOrderEQ_t &equalizer, float fs, float *coefficients);
+void dspSecondOrderEQ(const secondOrderEQ_t &equalizer, float fs, int32_t *coefficients);
+void dspSecondOrderEQFast(const secondOrderEQ_t &equalizer, float fs, float *coefficients);
+void dspSecondOrderEQFast(const secondOrderEQ_t &equalizer, float fs, int32_t *coefficients);
+
+void dspToneControl(const toneCtrl_t &toneCtrl, float fs, float *coefficients);
+void dspToneControl(const toneCtrl_t &toneCtrl, float fs, int32_t *coefficients);
+
+void dspDynamicBass(float dB, uint16_t frequency, float fs, float *parameters);
+void dspDynamicBass(float dB, uint16_t frequency, float fs, int32_t *parameters);
+void dspDynamicBassDetector(int16_t threshold, uint16_t time_constant, float fs, float *parameters);
+void dspDynamicBassDetector(int16_t threshold, uint16_t time_constant, float fs, int32_t *parameters);
+
+void dspCompressorRMS(const compressor_t &compressor, float fs, float *parameters);
+void dspCompressorRMS(const compressor_t &compressor, float fs, int32_t *parameters);
+void dspCompressorPeak(const compressor_t &compressor, float fs, float *parameters);
+void dspCompressorPeak(const compressor_t &compressor, float fs, int32_t *parameters);
+
+#endif
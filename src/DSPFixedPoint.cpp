@@ -0,0 +1,375 @@
+#include "DSPFixedPoint.h"
+
+// The polynomials run in Q2.30 to keep a few guard bits over Q8.24. Values that
+// are always positive but may reach 2 (reciprocals, 1/sqrt) are unsigned Q2.30
+#define Q30_ONE      ((int32_t)1 << 30)
+#define Q30_HALF_PI  ((int32_t)1686629713) // pi/2
+#define Q30_LN2      ((int32_t)744261118)  // ln(2)
+#define Q30_LOG2_E   ((int32_t)1549082005) // log2(e)
+#define Q30_LOG2_10_OVER_20 ((int32_t)178344657) // log2(10) / 20
+
+
+/**
+ * @brief Multiplies two unsigned 32-bit numbers and shifts the 64-bit product right
+ *        with rounding. The product is built from four 16x16->32 bit partial products
+ *        and kept in two 32-bit halves, so there is no 64-bit multiply (a slow library
+ *        call on AVR)
+ *
+ * @param a First factor
+ * @param b Second factor
+ * @param shift Right shift of the product, 1 to 63
+ * @return uint32_t Rounded result, saturated at 0xFFFFFFFF
+ */
+static inline uint32_t mulShiftU(uint32_t a, uint32_t b, uint8_t shift)
+{
+  uint16_t a0 = a, a1 = a >> 16;
+  uint16_t b0 = b, b1 = b >> 16;
+
+  uint32_t lo = (uint32_t)a0 * b0;
+  uint32_t hi = (uint32_t)a1 * b1;
+  uint32_t mid = (uint32_t)a1 * b0;
+  hi += mid >> 16;
+  mid <<= 16;
+  lo += mid;
+  hi += (lo < mid);
+  mid = (uint32_t)a0 * b1;
+  hi += mid >> 16;
+  mid <<= 16;
+  lo += mid;
+  hi += (lo < mid);
+
+  // Round to nearest
+  if(shift > 32)
+    return (hi >> (shift - 32)) + ((hi >> (shift - 33)) & 1);
+  uint32_t half = (uint32_t)1 << (shift - 1);
+  lo += half;
+  hi += (lo < half);
+
+  if(shift == 32)
+    return hi;
+  if(hi >> shift)
+    return 0xFFFFFFFFUL;
+  return (lo >> shift) | (hi << (32 - shift));
+}
+
+
+/**
+ * @brief Multiplies two unsigned 32-bit numbers and shifts the 64-bit product right
+ *        with rounding, without 64-bit arithmetic
+ *
+ * @param a First factor
+ * @param b Second factor
+ * @param shift Right shift of the product, 1 to 63
+ * @return uint32_t Rounded result, saturated at 0xFFFFFFFF
+ */
+uint32_t dspFixedMulShift(uint32_t a, uint32_t b, uint8_t shift)
+{
+  return mulShiftU(a, b, shift);
+}
+
+
+/**
+ * @brief Applies a sign to an unsigned magnitude and clamps it to the Q8.24 range
+ */
+static inline dspFixed_t saturate(uint32_t magnitude, bool negative)
+{
+  if(negative)
+    return magnitude >= 0x80000000UL ? FIXED_MIN : -(dspFixed_t)magnitude;
+  return magnitude > 0x7FFFFFFFUL ? FIXED_MAX : (dspFixed_t)magnitude;
+}
+
+
+/**
+ * @brief Returns the magnitude of a signed number, also for INT32_MIN
+ */
+static inline uint32_t magnitude(int32_t value)
+{
+  return value < 0 ? 0 - (uint32_t)value : (uint32_t)value;
+}
+
+
+/**
+ * @brief Multiplies two signed numbers and shifts the product right with rounding
+ *
+ * @return int32_t Rounded result, saturated
+ */
+static inline dspFixed_t mulShift(int32_t a, int32_t b, uint8_t shift)
+{
+  return saturate(mulShiftU(magnitude(a), magnitude(b), shift), (a < 0) != (b < 0));
+}
+
+
+/**
+ * @brief Multiplies two Q2.30 numbers and rounds the result
+ */
+static inline int32_t mulQ30(int32_t a, int32_t b)
+{
+  return mulShift(a, b, 30);
+}
+
+
+/**
+ * @brief Multiplies two unsigned Q2.30 numbers and rounds the result
+ */
+static inline uint32_t mulQ30U(uint32_t a, uint32_t b)
+{
+  return mulShiftU(a, b, 30);
+}
+
+
+/**
+ * @brief Converts a float to Q8.24. Only meant for the inputs of a calculation
+ *
+ * @param value Value to convert, -128 to +128
+ * @return dspFixed_t Q8.24 value, saturated if out of range
+ */
+dspFixed_t dspFixedFromFloat(float value)
+{
+  if(value >= 128.0f)
+    return FIXED_MAX;
+  if(value <= -128.0f)
+    return FIXED_MIN;
+  return (dspFixed_t)(value * (float)FIXED_ONE);
+}
+
+
+/**
+ * @brief Converts a Q8.24 value to float, for printing and testing
+ *
+ * @param value Q8.24 value
+ * @return float converted value
+ */
+float dspFixedToFloat(dspFixed_t value)
+{
+  return (float)value / (float)FIXED_ONE;
+}
+
+
+/**
+ * @brief Rounds a Q8.24 value to a 5.23 DSP parameter word
+ *
+ * @param value Q8.24 value
+ * @return int32_t 5.23 value, saturated to +/-16
+ */
+int32_t dspFixedTo523(dspFixed_t value)
+{
+  int32_t word = (value >> 1) + (value & 1);
+  if(word > FIXED_523_MAX)
+    return FIXED_523_MAX;
+  if(word < FIXED_523_MIN)
+    return FIXED_523_MIN;
+  return word;
+}
+
+
+/**
+ * @brief Multiplies two Q8.24 numbers
+ *
+ * @param a First factor
+ * @param b Second factor
+ * @return dspFixed_t Rounded and saturated product
+ */
+dspFixed_t dspFixedMul(dspFixed_t a, dspFixed_t b)
+{
+  return mulShift(a, b, FIXED_FRACTION_BITS);
+}
+
+
+/**
+ * @brief Calculates 1/value with Newton-Raphson iterations on the normalized mantissa
+ *
+ * @param value Q8.24 value
+ * @return dspFixed_t Q8.24 reciprocal, saturated if |value| < 1/128
+ */
+dspFixed_t dspFixedReciprocal(dspFixed_t value)
+{
+  return dspFixedDiv(FIXED_ONE, value);
+}
+
+
+/**
+ * @brief Divides two Q8.24 numbers. The divisor is normalized and its reciprocal
+ *        refined with Newton-Raphson iterations, so there is no division at all
+ *        and the quotient is exact even if 1/b alone is out of range
+ *
+ * @param a Dividend
+ * @param b Divisor
+ * @return dspFixed_t Q8.24 quotient, saturated
+ */
+dspFixed_t dspFixedDiv(dspFixed_t a, dspFixed_t b)
+{
+  if(b == 0)
+    return a < 0 ? FIXED_MIN : FIXED_MAX;
+
+  bool negative = (a < 0) != (b < 0);
+  uint32_t m = magnitude(b);
+
+  // Normalize the mantissa to [0.5, 1)
+  int8_t shift = 0;
+  while(!(m & 0x80000000UL))
+  {
+    m <<= 1;
+    shift++;
+  }
+  uint32_t mantissa = m >> 2; // Q2.30
+
+  // 48/17 - 32/17 * m is within 1/17 of 1/m, three iterations are plenty
+  uint32_t y = 3031741621UL - mulQ30U(2021161080UL, mantissa);
+  for(uint8_t i = 0; i < 3; i++)
+    y = mulQ30U(y, 0x80000000UL - mulQ30U(mantissa, y));
+
+  // b = m * 2^(8 - shift), so a/b = a * y * 2^(shift - 8)
+  return saturate(mulShiftU(magnitude(a), y, 38 - shift), negative);
+}
+
+
+/**
+ * @brief Calculates the square root with Newton-Raphson iterations of 1/sqrt(x)
+ *
+ * @param value Q8.24 value
+ * @return dspFixed_t Q8.24 square root, 0 for negative values
+ */
+dspFixed_t dspFixedSqrt(dspFixed_t value)
+{
+  if(value <= 0)
+    return 0;
+
+  // Normalize the mantissa to [0.25, 1) with an even shift
+  uint32_t m = value;
+  uint8_t shift = 0;
+  while(m < 0x40000000UL)
+  {
+    m <<= 2;
+    shift += 2;
+  }
+  uint32_t mantissa = m >> 2; // Q2.30
+
+  // Straight line through 1/sqrt(x) on [0.25, 1], then four iterations
+  uint32_t y = 2362232013UL - mulQ30U(1395864371UL, mantissa); // 2.2 - 1.3x
+  for(uint8_t i = 0; i < 4; i++)
+    y = mulShiftU(y, 3221225472UL - mulQ30U(mantissa, mulQ30U(y, y)), 31);
+
+  // value = m * 2^(8 - shift), so sqrt(value) = sqrt(m) * 2^(4 - shift/2)
+  uint32_t root = mulQ30U(mantissa, y);
+  uint8_t down = 2 + shift / 2;
+  return (dspFixed_t)((root + ((uint32_t)1 << (down - 1))) >> down);
+}
+
+
+/**
+ * @brief Calculates sine and cosine of an angle given as a fraction of a full turn.
+ *        The angle is folded to the first octant where short Taylor polynomials are
+ *        accurate to better than 1e-9
+ *
+ * @param phase Angle in turns (Q0.32), 2*pi*f/fs is phase = f/fs * 2^32
+ * @param sine Q8.24 sine of the angle
+ * @param cosine Q8.24 cosine of the angle
+ */
+void dspFixedSinCos(uint32_t phase, dspFixed_t &sine, dspFixed_t &cosine)
+{
+  uint8_t quadrant = phase >> 30;
+  int32_t p = phase & 0x3FFFFFFFUL; // Q0.30 fraction of a quarter turn
+
+  // Past pi/4 the complement is used and sine and cosine swap
+  bool swap = p > (Q30_ONE >> 1);
+  if(swap)
+    p = Q30_ONE - p;
+
+  int32_t x  = mulQ30(p, Q30_HALF_PI); // Radians, 0 to pi/4
+  int32_t x2 = mulQ30(x, x);
+
+  // sin(x) = x(1 - x^2/(2*3)(1 - x^2/(4*5)(1 - x^2/(6*7)(1 - x^2/(8*9)))))
+  int32_t s = Q30_ONE - mulQ30(x2, 14913081);
+  s = Q30_ONE - mulQ30(mulQ30(x2, 25565282), s);
+  s = Q30_ONE - mulQ30(mulQ30(x2, 53687091), s);
+  s = Q30_ONE - mulQ30(mulQ30(x2, 178956971), s);
+  s = mulQ30(x, s);
+
+  // cos(x) = 1 - x^2/(1*2)(1 - x^2/(3*4)(1 - x^2/(5*6)(1 - x^2/(7*8)(1 - x^2/(9*10)))))
+  int32_t c = Q30_ONE - mulQ30(x2, 11930465);
+  c = Q30_ONE - mulQ30(mulQ30(x2, 19173961), c);
+  c = Q30_ONE - mulQ30(mulQ30(x2, 35791394), c);
+  c = Q30_ONE - mulQ30(mulQ30(x2, 89478485), c);
+  c = Q30_ONE - mulQ30(mulQ30(x2, 536870912), c);
+
+  if(swap)
+  {
+    int32_t t = s;
+    s = c;
+    c = t;
+  }
+
+  // Rotate into the right quadrant
+  int32_t rs, rc;
+  switch(quadrant)
+  {
+    case 0:  rs =  s; rc =  c; break;
+    case 1:  rs =  c; rc = -s; break;
+    case 2:  rs = -s; rc = -c; break;
+    default: rs = -c; rc =  s; break;
+  }
+
+  sine   = (dspFixed_t)((rs + 32) >> 6);
+  cosine = (dspFixed_t)((rc + 32) >> 6);
+}
+
+
+/**
+ * @brief Calculates 2^value. The fraction is evaluated as e^(f*ln2) with a
+ *        Taylor polynomial, the integer part is a shift
+ *
+ * @param value Q8.24 exponent
+ * @return dspFixed_t Q8.24 result, saturated at 128
+ */
+dspFixed_t dspFixedExp2(dspFixed_t value)
+{
+  int8_t n = value >> FIXED_FRACTION_BITS;
+  if(n >= 7)
+    return FIXED_MAX;
+  if(n < -25)
+    return 0;
+
+  uint32_t f = (uint32_t)(value & 0x00FFFFFF) << 6; // Q2.30, 0 to 1
+  uint32_t x = mulQ30U(f, Q30_LN2);
+
+  // e^x = 1 + x(1 + x/2(1 + x/3(... (1 + x/9))))
+  uint32_t e = Q30_ONE + mulQ30U(x, 119304647);
+  e = Q30_ONE + mulQ30U(mulQ30U(x, 134217728), e);
+  e = Q30_ONE + mulQ30U(mulQ30U(x, 153391689), e);
+  e = Q30_ONE + mulQ30U(mulQ30U(x, 178956971), e);
+  e = Q30_ONE + mulQ30U(mulQ30U(x, 214748365), e);
+  e = Q30_ONE + mulQ30U(mulQ30U(x, 268435456), e);
+  e = Q30_ONE + mulQ30U(mulQ30U(x, 357913941), e);
+  e = Q30_ONE + mulQ30U(mulQ30U(x, 536870912), e);
+  e = Q30_ONE + mulQ30U(x, e);
+
+  // e is 1 to 2 in Q2.30, scale by 2^n into Q8.24
+  uint8_t down = 6 - n;
+  if(down == 0)
+    return saturate(e, false);
+  return (dspFixed_t)((e + ((uint32_t)1 << (down - 1))) >> down);
+}
+
+
+/**
+ * @brief Calculates e^value
+ *
+ * @param value Q8.24 exponent
+ * @return dspFixed_t Q8.24 result, saturated at 128
+ */
+dspFixed_t dspFixedExp(dspFixed_t value)
+{
+  return dspFixedExp2(mulQ30(value, Q30_LOG2_E));
+}
+
+
+/**
+ * @brief Converts a level in dB to a linear gain, 10^(dB/20)
+ *
+ * @param dB Q8.24 level in dB, up to +42dB
+ * @return dspFixed_t Q8.24 linear gain
+ */
+dspFixed_t dspFixedDecibelsToLinear(dspFixed_t dB)
+{
+  return dspFixedExp2(mulQ30(dB, Q30_LOG2_10_OVER_20));
+}
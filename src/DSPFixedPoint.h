@@ -0,0 +1,41 @@
+#ifndef DSPFIXEDPOINT_H
+#define DSPFIXEDPOINT_H
+
+#include <stdint.h>
+
+// Q8.24 fixed-point number. 8 integer bits (sign included) and 24 fraction bits,
+// a range of +/-128 with about the resolution of a float between 1 and 2
+typedef int32_t dspFixed_t;
+
+#define FIXED_FRACTION_BITS 24
+#define FIXED_ONE ((dspFixed_t)1 << FIXED_FRACTION_BITS)
+#define FIXED_MAX ((dspFixed_t)0x7FFFFFFF)
+#define FIXED_MIN (-FIXED_MAX - 1)
+
+// Largest and smallest 5.23 values the DSP parameter RAM can hold (28-bit words)
+#define FIXED_523_MAX ((int32_t)0x07FFFFFF)
+#define FIXED_523_MIN ((int32_t)-0x08000000)
+
+/**
+ * Integer fixed-point math for MCUs without an FPU. No floating point is used,
+ * trig, exp and square root are polynomial or Newton-Raphson based.
+ * Only 32-bit arithmetic is used, products are built from 16x16->32 bit multiplies
+ * (no 64-bit library calls on AVR), divisions are replaced by reciprocals.
+ * This file doesn't depend on Arduino, so it can be built and tested on a host too.
+ */
+
+dspFixed_t dspFixedFromFloat(float value);
+float dspFixedToFloat(dspFixed_t value);
+int32_t dspFixedTo523(dspFixed_t value);
+
+uint32_t dspFixedMulShift(uint32_t a, uint32_t b, uint8_t shift);
+dspFixed_t dspFixedMul(dspFixed_t a, dspFixed_t b);
+dspFixed_t dspFixedReciprocal(dspFixed_t value);
+dspFixed_t dspFixedDiv(dspFixed_t a, dspFixed_t b);
+dspFixed_t dspFixedSqrt(dspFixed_t value);
+void dspFixedSinCos(uint32_t phase, dspFixed_t &sine, dspFixed_t &cosine);
+dspFixed_t dspFixedExp2(dspFixed_t value);
+dspFixed_t dspFixedExp(dspFixed_t value);
+dspFixed_t dspFixedDecibelsToLinear(dspFixed_t dB);
+
+#endif
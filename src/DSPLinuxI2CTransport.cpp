@@ -0,0 +1,179 @@
+#include "DSPLinuxI2CTransport.h"
+
+#if defined(__linux__) && !defined(ARDUINO)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+/**
+ * @brief Forwards to the system ioctl, which is variadic and can't be stored directly
+ */
+static int systemIoctl(int fd, unsigned long request, void *argument)
+{
+  return ioctl(fd, request, argument);
+}
+
+
+/**
+ * @brief Constructs a new DSPLinuxI2CTransport object. The device is opened in begin()
+ *
+ * @param device i2c-dev device path, e.g. /dev/i2c-1
+ */
+DSPLinuxI2CTransport::DSPLinuxI2CTransport(const char *device)
+  : _device(device), _fd(-1), _ioctl(systemIoctl)
+{
+
+}
+
+
+/**
+ * @brief Constructs a new DSPLinuxI2CTransport object on top of an already open file descriptor
+ *
+ * @param fd Open i2c-dev (or mock) file descriptor. Not closed by this object
+ * @param ioctlHandler ioctl replacement (optional parameter, defaults to the system ioctl)
+ */
+DSPLinuxI2CTransport::DSPLinuxI2CTransport(int fd, ioctlFunction ioctlHandler)
+  : _device(nullptr), _fd(fd), _ioctl(ioctlHandler != nullptr ? ioctlHandler : systemIoctl)
+{
+
+}
+
+
+/**
+ * @brief Closes the i2c-dev device if it was opened by this object
+ */
+DSPLinuxI2CTransport::~DSPLinuxI2CTransport()
+{
+  if(_device != nullptr && _fd >= 0)
+    close(_fd);
+}
+
+
+/**
+ * @brief Opens the i2c-dev device
+ */
+void DSPLinuxI2CTransport::begin()
+{
+  if(_device != nullptr && _fd < 0)
+    _fd = open(_device, O_RDWR);
+}
+
+
+/**
+ * @brief Sends an i2c ping message (zero length write)
+ *
+ * @param deviceAddress 7-bit i2c address
+ * @return uint8_t 0 if ack received, 2 if nack received, 4 on other errors
+ */
+uint8_t DSPLinuxI2CTransport::ping(uint8_t deviceAddress)
+{
+  struct i2c_msg message;
+  message.addr = deviceAddress;
+  message.flags = 0;
+  message.len = 0;
+  message.buf = _buffer;
+
+  return transfer(&message, 1);
+}
+
+
+/**
+ * @brief Writes the sub address and data as a single i2c message in one ioctl
+ *
+ * @param deviceAddress 7-bit i2c address
+ * @param subAddress 16-bit register or memory address
+ * @param data Data array to write
+ * @param length Number of bytes to write (max maxChunk())
+ * @return uint8_t 0 if ack received, 2 if nack received, 4 on other errors
+ */
+uint8_t DSPLinuxI2CTransport::write(uint8_t deviceAddress, uint16_t subAddress, const uint8_t *data, uint16_t length)
+{
+  if(length > SIGMADSP_LINUX_I2C_CHUNK_SIZE)
+    return 4;
+
+  _buffer[0] = subAddress >> 8;   // High address
+  _buffer[1] = subAddress & 0xFF; // Low address
+  memcpy(&_buffer[2], data, length);
+
+  struct i2c_msg message;
+  message.addr = deviceAddress;
+  message.flags = 0;
+  message.len = length + 2;
+  message.buf = _buffer;
+
+  return transfer(&message, 1);
+}
+
+
+/**
+ * @brief Writes the sub address and reads data back with a repeated start, all in one ioctl
+ *
+ * @param deviceAddress 7-bit i2c address
+ * @param subAddress 16-bit register or memory address
+ * @param data Array to store the received data in
+ * @param length Number of bytes to read (max maxChunk())
+ * @return uint8_t 0 if ack received, 2 if nack received, 4 on other errors
+ */
+uint8_t DSPLinuxI2CTransport::writeRead(uint8_t deviceAddress, uint16_t subAddress, uint8_t *data, uint16_t length)
+{
+  uint8_t address[2] = { (uint8_t)(subAddress >> 8), (uint8_t)(subAddress & 0xFF) };
+
+  struct i2c_msg messages[2];
+  messages[0].addr = deviceAddress;
+  messages[0].flags = 0;
+  messages[0].len = sizeof(address);
+  messages[0].buf = address;
+  messages[1].addr = deviceAddress;
+  messages[1].flags = I2C_M_RD;
+  messages[1].len = length;
+  messages[1].buf = data;
+
+  return transfer(messages, 2);
+}
+
+
+/**
+ * @brief Max data bytes per message
+ *
+ * @return uint16_t max data bytes per transaction
+ */
+uint16_t DSPLinuxI2CTransport::maxChunk() const
+{
+  return SIGMADSP_LINUX_I2C_CHUNK_SIZE;
+}
+
+
+/*******************************************************************************************
+**                                     PRIVATE METHODS                                    **
+*******************************************************************************************/
+
+
+/**
+ * @brief Issues the passed i2c messages as one I2C_RDWR ioctl
+ *
+ * @param messages Array of struct i2c_msg
+ * @param count Number of messages
+ * @return uint8_t 0 on success, 2 if the device didn't ack, 4 on other errors
+ */
+uint8_t DSPLinuxI2CTransport::transfer(void *messages, uint8_t count)
+{
+  struct i2c_rdwr_ioctl_data request;
+  request.msgs = (struct i2c_msg *)messages;
+  request.nmsgs = count;
+
+  if(_ioctl(_fd, I2C_RDWR, &request) >= 0)
+    return 0;
+
+  // The i2c core reports a missing ack as ENXIO or EREMOTEIO depending on the bus driver
+  if(errno == ENXIO || errno == EREMOTEIO)
+    return 2;
+
+  return 4;
+}
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef DSPLINUXI2CTRANSPORT_H
+#define DSPLINUXI2CTRANSPORT_H
+
+#if defined(__linux__) && !defined(ARDUINO)
+
+#include <stdint.h>
+#include "DSPTransport.h"
+
+// Max number of data bytes in one i2c-dev message, not counting the sub address
+#ifndef SIGMADSP_LINUX_I2C_CHUNK_SIZE
+  #define SIGMADSP_LINUX_I2C_CHUNK_SIZE 4094
+#endif
+
+/**
+ * @brief Linux i2c-dev transport for host side control of the DSP and EEPROM.
+ *        Every write goes out as one I2C_RDWR ioctl, and every read as one
+ *        I2C_RDWR ioctl with a combined write + repeated start + read message pair.
+ *        The ioctl call can be replaced, which lets the transport run against a
+ *        mock file descriptor.
+ */
+class DSPLinuxI2CTransport : public DSPTransport
+{
+  public:
+    typedef int (*ioctlFunction)(int fd, unsigned long request, void *argument);
+
+    DSPLinuxI2CTransport(const char *device);
+    DSPLinuxI2CTransport(int fd, ioctlFunction ioctlHandler = nullptr);
+    ~DSPLinuxI2CTransport();
+
+    void begin();
+    uint8_t ping(uint8_t deviceAddress);
+    uint8_t write(uint8_t deviceAddress, uint16_t subAddress, const uint8_t *data, uint16_t length);
+    uint8_t writeRead(uint8_t deviceAddress, uint16_t subAddress, uint8_t *data, uint16_t length);
+    uint16_t maxChunk() const;
+
+  private:
+    uint8_t transfer(void *messages, uint8_t count);
+
+    const char *_device;     // i2c-dev device path, e.g. /dev/i2c-1. nullptr if an fd was passed
+    int _fd;                 // Open i2c-dev file descriptor, -1 if closed
+    ioctlFunction _ioctl;    // ioctl implementation, ::ioctl unless a mock is passed
+    uint8_t _buffer[2 + SIGMADSP_LINUX_I2C_CHUNK_SIZE]; // Sub address + data of the current write
+};
+
+#endif
+
+#endif
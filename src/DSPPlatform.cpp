@@ -0,0 +1,82 @@
+#include "DSPPlatform.h"
+
+#ifndef ARDUINO
+
+#include <errno.h>
+#include <time.h>
+
+/**
+ * @brief Reads the monotonic clock
+ *
+ * @return uint64_t time since an arbitrary start in [us]
+ */
+static uint64_t monotonicMicros()
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+
+/**
+ * @brief Milliseconds of the monotonic clock, wraps like the Arduino version
+ */
+uint32_t millis()
+{
+  return (uint32_t)(monotonicMicros() / 1000);
+}
+
+
+/**
+ * @brief Microseconds of the monotonic clock, wraps like the Arduino version
+ */
+uint32_t micros()
+{
+  return (uint32_t)monotonicMicros();
+}
+
+
+/**
+ * @brief Sleeps for a number of milliseconds
+ */
+void delay(uint32_t ms)
+{
+  delayMicroseconds(ms * 1000UL);
+}
+
+
+/**
+ * @brief Sleeps for a number of microseconds
+ */
+void delayMicroseconds(uint32_t us)
+{
+  struct timespec duration;
+  duration.tv_sec = us / 1000000;
+  duration.tv_nsec = (long)(us % 1000000) * 1000;
+  while(nanosleep(&duration, &duration) != 0 && errno == EINTR)
+    ; // Interrupted by a signal, sleep the rest
+}
+
+
+/**
+ * @brief Reads bytes until the buffer is full or the stream runs dry.
+ *        Unlike Arduino there's no timeout, a host stream has its data at hand
+ *
+ * @param buffer Buffer to fill
+ * @param length Number of bytes to read
+ * @return size_t number of bytes read
+ */
+size_t Stream::readBytes(uint8_t *buffer, size_t length)
+{
+  size_t count = 0;
+  while(count < length)
+  {
+    int data = read();
+    if(data < 0)
+      break;
+    buffer[count++] = (uint8_t)data;
+  }
+  return count;
+}
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef DSPPLATFORM_H
+#define DSPPLATFORM_H
+
+/**
+ * The few Arduino core functions the library uses. On Arduino this is Arduino.h.
+ * Host builds (Linux control programs, unit tests) get stand-ins instead:
+ * PROGMEM data is ordinary memory, the timing functions use the monotonic clock
+ * and Stream is reduced to what the firmware loaders read from it.
+ * Pins (reset, LED, SPI latch) are only driven on Arduino.
+ */
+#ifdef ARDUINO
+
+#include <Arduino.h>
+
+#else
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+#define PROGMEM
+#define pgm_read_byte(address)  (*(const uint8_t *)(address))
+#define pgm_read_word(address)  (*(const uint16_t *)(address))
+#define pgm_read_dword(address) (*(const uint32_t *)(address))
+
+#ifndef PI
+  #define PI 3.1415926535897932384626433832795
+#endif
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+/**
+ * @brief Byte source with the interface of the Arduino Stream class,
+ *        for loading firmware from a file or a DSPRLEStream on the host
+ */
+class Stream
+{
+  public:
+    virtual ~Stream() {}
+
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual size_t write(uint8_t data) = 0;
+
+    size_t readBytes(uint8_t *buffer, size_t length);
+};
+
+#endif
+
+#endif
@@ -0,0 +1,121 @@
+#include "DSPQueueWorker.h"
+
+#if defined(__linux__) && !defined(ARDUINO)
+
+#include <chrono>
+
+/**
+ * @brief Constructs a new DSPQueueWorker object. The thread is started by start()
+ *
+ * @param dsp SigmaDSP object with an attached update queue
+ * @param interval Max time between two polls of an idle queue in [us] (optional parameter, default 1 ms)
+ */
+DSPQueueWorker::DSPQueueWorker(SigmaDSP &dsp, uint32_t interval)
+  : _dsp(dsp), _interval(interval), _running(false), _notified(false)
+{
+
+}
+
+
+/**
+ * @brief Stops the worker thread if it's running
+ */
+DSPQueueWorker::~DSPQueueWorker()
+{
+  stop();
+}
+
+
+/**
+ * @brief Starts the worker thread
+ */
+void DSPQueueWorker::start()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  if(_running)
+    return;
+
+  _running = true;
+  _thread = std::thread(&DSPQueueWorker::run, this);
+}
+
+
+/**
+ * @brief Stops the worker thread and sends what's still pending, so no update is lost
+ */
+void DSPQueueWorker::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _running = false;
+  }
+  _wake.notify_one();
+
+  if(_thread.joinable())
+    _thread.join();
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _dsp.flushQueue();
+}
+
+
+/**
+ * @brief Returns if the worker thread is running
+ *
+ * @return true if started and not stopped
+ */
+bool DSPQueueWorker::running() const
+{
+  return _thread.joinable();
+}
+
+
+/**
+ * @brief Wakes the worker thread up right away instead of at the next poll interval.
+ *        Call it after queueing updates, without holding the mutex
+ */
+void DSPQueueWorker::notify()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _notified = true;
+  }
+  _wake.notify_one();
+}
+
+
+/**
+ * @brief Returns the mutex that serializes the calls on the DSP object
+ *
+ * @return std::mutex& mutex to hold while calling the DSP object
+ */
+std::mutex &DSPQueueWorker::mutex()
+{
+  return _mutex;
+}
+
+
+/**
+ * @brief Worker thread. Sends one group per lock, so callers only ever wait
+ *        for a single safeload transfer
+ */
+void DSPQueueWorker::run()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  while(_running)
+  {
+    if(_dsp.poll() > 0)
+    {
+      // The previous transfer may still be in progress, let callers in meanwhile
+      lock.unlock();
+      std::this_thread::yield();
+      lock.lock();
+      continue;
+    }
+
+    _wake.wait_for(lock, std::chrono::microseconds(_interval), [this] { return _notified || !_running; });
+    _notified = false;
+  }
+}
+
+#endif
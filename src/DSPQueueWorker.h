@@ -0,0 +1,47 @@
+#ifndef DSPQUEUEWORKER_H
+#define DSPQUEUEWORKER_H
+
+#if defined(__linux__) && !defined(ARDUINO)
+
+#include <stdint.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "SigmaDSP.h"
+
+/**
+ * @brief Background thread that drains the update queue of a SigmaDSP object,
+ *        for Linux control programs. It calls poll() until the queue is empty,
+ *        then sleeps until notify() or the poll interval wakes it up.
+ *        SigmaDSP isn't thread safe: every call on the DSP object from another
+ *        thread must hold the worker's mutex, e.g.
+ *        std::lock_guard<std::mutex> lock(worker.mutex()); dsp.volume(...); worker.notify();
+ *        On microcontrollers, call poll() from the main loop instead
+ */
+class DSPQueueWorker
+{
+  public:
+    DSPQueueWorker(SigmaDSP &dsp, uint32_t interval = 1000);
+    ~DSPQueueWorker();
+
+    void start();
+    void stop();
+    bool running() const;
+    void notify();
+    std::mutex &mutex();
+
+  private:
+    void run();
+
+    SigmaDSP &_dsp;                // DSP object whose queue is drained
+    const uint32_t _interval;      // Max time between two polls of an idle queue in [us]
+    std::mutex _mutex;             // Serializes all calls on the DSP object
+    std::condition_variable _wake; // Signaled by notify() and stop()
+    std::thread _thread;           // Worker thread, not joinable when stopped
+    bool _running;                 // Cleared to make the worker thread return
+    bool _notified;                // Set by notify(), cleared by the worker thread
+};
+
+#endif
+
+#endif
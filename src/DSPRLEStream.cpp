@@ -0,0 +1,103 @@
+#include "DSPRLEStream.h"
+
+/**
+ * @brief Constructs a new DSPRLEStream object on top of an encoded image
+ *
+ * @param image PROGMEM zero-run encoded image
+ * @param size Size of the encoded image in bytes
+ */
+DSPRLEStream::DSPRLEStream(const uint8_t *image, uint16_t size)
+  : _image(image), _size(size), _index(0), _remaining(0), _zeroRun(false)
+{
+
+}
+
+
+/**
+ * @brief Starts decoding from the beginning of the image again
+ */
+void DSPRLEStream::rewind()
+{
+  _index = 0;
+  _remaining = 0;
+}
+
+
+/**
+ * @brief Returns the number of bytes that can be read straight away
+ *
+ * @return int bytes left in the current record, or 1 if there are more records
+ */
+int DSPRLEStream::available()
+{
+  if(_remaining > 0)
+    return _remaining;
+  return _index < _size ? 1 : 0;
+}
+
+
+/**
+ * @brief Reads and decodes the next byte
+ *
+ * @return int decoded byte, or -1 at the end of the image
+ */
+int DSPRLEStream::read()
+{
+  int data = peek();
+  if(data >= 0)
+  {
+    if(!_zeroRun)
+      _index++;
+    _remaining--;
+  }
+  return data;
+}
+
+
+/**
+ * @brief Returns the next decoded byte without consuming it
+ *
+ * @return int decoded byte, or -1 at the end of the image
+ */
+int DSPRLEStream::peek()
+{
+  if(_remaining == 0 && !nextRecord())
+    return -1;
+
+  if(_zeroRun)
+    return 0;
+  return pgm_read_byte(&_image[_index]);
+}
+
+
+/**
+ * @brief The image lives in flash, so nothing can be written to it
+ *
+ * @return size_t always 0
+ */
+size_t DSPRLEStream::write(uint8_t data)
+{
+  (void)data;
+  return 0;
+}
+
+
+/**
+ * @brief Reads the control byte of the next record
+ *
+ * @return true if there was a record to read, false at the end of the image
+ */
+bool DSPRLEStream::nextRecord()
+{
+  if(_index >= _size)
+    return false;
+
+  uint8_t control = pgm_read_byte(&_image[_index++]);
+  _zeroRun = control & RLE_ZERO_RUN;
+  _remaining = (control & RLE_RUN_LENGTH) + 1;
+
+  // A truncated literal record ends the image
+  if(!_zeroRun && (uint32_t)_index + _remaining > _size)
+    _remaining = _size - _index;
+  return _remaining > 0;
+}
@@ -0,0 +1,39 @@
+#ifndef DSPRLESTREAM_H
+#define DSPRLESTREAM_H
+
+#include "DSPPlatform.h"
+#include <stdint.h>
+
+// Control byte of a zero-run encoded image. 0x00-0x7F: 1-128 literal bytes follow,
+// 0x80-0xFF: run of 1-128 zero bytes
+#define RLE_ZERO_RUN   0x80
+#define RLE_RUN_LENGTH 0x7F
+
+/**
+ * @brief Read-only stream that decodes a zero-run encoded PROGMEM image on the fly
+ *        (the *_rle arrays in SigmaDSP_parameters.h). The decoder only keeps track of
+ *        the current record, so it can be passed to any function that reads from a
+ *        Stream, like loadProgram(myDSP, stream) or DSPEEPROM::writeFirmware
+ */
+class DSPRLEStream : public Stream
+{
+  public:
+    DSPRLEStream(const uint8_t *image, uint16_t size);
+
+    void rewind();
+    int available();
+    int read();
+    int peek();
+    size_t write(uint8_t data);
+
+  private:
+    bool nextRecord();
+
+    const uint8_t *_image; // PROGMEM encoded image
+    const uint16_t _size;  // Size of the encoded image in bytes
+    uint16_t _index;       // Next byte to read from the image
+    uint8_t _remaining;    // Bytes left in the current record
+    bool _zeroRun;         // True if the current record is a zero run
+};
+
+#endif
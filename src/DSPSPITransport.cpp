@@ -0,0 +1,149 @@
+#include "DSPSPITransport.h"
+
+#ifdef ARDUINO
+
+/**
+ * @brief Constructs a new DSPSPITransport object
+ *
+ * @param SPIObject SPIClass object
+ * @param latchPin Pin connected to the DSP CLATCH input
+ * @param clock SPI clock speed in [Hz] (optional parameter, default 8 MHz)
+ * @param chipAddress 7-bit chip address (optional parameter, default 0)
+ */
+DSPSPITransport::DSPSPITransport(SPIClass &SPIObject, int8_t latchPin, uint32_t clock, uint8_t chipAddress)
+  : _SPIObject(SPIObject), _latchPin(latchPin), _chipAddress(chipAddress), _clock(clock)
+{
+
+}
+
+
+/**
+ * @brief Starts the SPI interface and toggles CLATCH low three times,
+ *        which moves a control port that powered up in i2c mode over to SPI mode
+ */
+void DSPSPITransport::begin()
+{
+  pinMode(_latchPin, OUTPUT);
+  digitalWrite(_latchPin, HIGH);
+  _SPIObject.begin();
+
+  for(uint8_t i = 0; i < 3; i++)
+  {
+    digitalWrite(_latchPin, LOW);
+    delayMicroseconds(1);
+    digitalWrite(_latchPin, HIGH);
+    delayMicroseconds(1);
+  }
+}
+
+
+/**
+ * @brief Sets the SPI clock speed
+ *
+ * @param clock SPI clock speed in [Hz]
+ */
+void DSPSPITransport::setClock(uint32_t clock)
+{
+  _clock = clock;
+}
+
+
+/**
+ * @brief SPI has no acknowledge, so the DSP is always reported as present
+ *
+ * @param deviceAddress Ignored
+ * @return uint8_t 0
+ */
+uint8_t DSPSPITransport::ping(uint8_t deviceAddress)
+{
+  (void)deviceAddress;
+  return 0;
+}
+
+
+/**
+ * @brief Writes a block of data in a single SPI transaction
+ *
+ * @param deviceAddress Ignored, the chip address passed to the constructor is used
+ * @param subAddress 16-bit register or memory address
+ * @param data Data array to write
+ * @param length Number of bytes to write
+ * @return uint8_t 0
+ */
+uint8_t DSPSPITransport::write(uint8_t deviceAddress, uint16_t subAddress, const uint8_t *data, uint16_t length)
+{
+  (void)deviceAddress;
+
+  startTransaction(false, subAddress);
+  for(uint16_t i = 0; i < length; i++)
+    _SPIObject.transfer(data[i]);
+  stopTransaction();
+
+  return 0;
+}
+
+
+/**
+ * @brief Reads data back from the passed sub address in a single SPI transaction
+ *
+ * @param deviceAddress Ignored, the chip address passed to the constructor is used
+ * @param subAddress 16-bit register or memory address
+ * @param data Array to store the received data in
+ * @param length Number of bytes to read
+ * @return uint8_t 0
+ */
+uint8_t DSPSPITransport::writeRead(uint8_t deviceAddress, uint16_t subAddress, uint8_t *data, uint16_t length)
+{
+  (void)deviceAddress;
+
+  startTransaction(true, subAddress);
+  for(uint16_t i = 0; i < length; i++)
+    data[i] = _SPIObject.transfer(0x00);
+  stopTransaction();
+
+  return 0;
+}
+
+
+/**
+ * @brief SPI has no transmit buffer limit
+ *
+ * @return uint16_t max data bytes per transaction
+ */
+uint16_t DSPSPITransport::maxChunk() const
+{
+  return 0xFFFF;
+}
+
+
+/*******************************************************************************************
+**                                     PRIVATE METHODS                                    **
+*******************************************************************************************/
+
+
+/**
+ * @brief Pulls CLATCH low and sends the chip address byte and the sub address
+ *
+ * @param read True for a read transaction, false for a write
+ * @param subAddress 16-bit register or memory address
+ */
+void DSPSPITransport::startTransaction(bool read, uint16_t subAddress)
+{
+  _SPIObject.beginTransaction(SPISettings(_clock, MSBFIRST, SPI_MODE3));
+  digitalWrite(_latchPin, LOW);
+  _SPIObject.transfer((_chipAddress << 1) | (read ? 0x01 : 0x00));
+  _SPIObject.transfer(subAddress >> 8);   // Send high address
+  _SPIObject.transfer(subAddress & 0xFF); // Send low address
+}
+
+
+/**
+ * @brief Releases CLATCH and ends the SPI transaction
+ */
+void DSPSPITransport::stopTransaction()
+{
+  digitalWrite(_latchPin, HIGH);
+  _SPIObject.endTransaction();
+}
+
+#endif
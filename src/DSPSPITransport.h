@@ -0,0 +1,41 @@
+#ifndef DSPSPITRANSPORT_H
+#define DSPSPITRANSPORT_H
+
+#ifdef ARDUINO
+
+#include <Arduino.h>
+#include <SPI.h>
+#include "DSPTransport.h"
+
+/**
+ * @brief SPI control port transport for the ADAU1401/ADAU1701/ADAU1702.
+ *        Every transaction starts with a chip address byte (R/W in bit 0),
+ *        followed by the 16-bit sub address and the data bytes, just like over i2c.
+ *        The i2c address passed to SigmaDSP is ignored; the chip address byte
+ *        is set in the constructor instead.
+ */
+class DSPSPITransport : public DSPTransport
+{
+  public:
+    DSPSPITransport(SPIClass &SPIObject, int8_t latchPin, uint32_t clock = 8000000, uint8_t chipAddress = 0x00);
+
+    void begin();
+    void setClock(uint32_t clock);
+    uint8_t ping(uint8_t deviceAddress);
+    uint8_t write(uint8_t deviceAddress, uint16_t subAddress, const uint8_t *data, uint16_t length);
+    uint8_t writeRead(uint8_t deviceAddress, uint16_t subAddress, uint8_t *data, uint16_t length);
+    uint16_t maxChunk() const;
+
+  private:
+    void startTransaction(bool read, uint16_t subAddress);
+    void stopTransaction();
+
+    SPIClass &_SPIObject;       // Reference to passed SPI object
+    const int8_t _latchPin;     // CLATCH (chip select) pin
+    const uint8_t _chipAddress; // 7-bit chip address sent in the first byte
+    uint32_t _clock;            // SPI clock speed in [Hz]
+};
+
+#endif
+
+#endif
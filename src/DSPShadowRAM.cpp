@@ -0,0 +1,172 @@
+#include "DSPShadowRAM.h"
+
+// Marks a free hash table slot
+#define SHADOW_FREE    0xFFFF
+// Set in the address of a tracked slot whose value is no longer known
+#define SHADOW_UNKNOWN 0x8000
+
+/**
+ * @brief Constructs a new DSPShadow object on top of the passed storage
+ *
+ * @param entries Hash table storage
+ * @param size Number of entries in the storage
+ */
+DSPShadow::DSPShadow(dspShadowEntry_t *entries, uint16_t size)
+  : _entries(entries), _size(size), _used(0), _defaults(nullptr), _defaultsWords(0), _defaultsValid(false)
+{
+
+}
+
+
+/**
+ * @brief Empties the shadow and sets the parameter RAM defaults. Call this right after
+ *        the DSP program has been loaded (SigmaDSP does this automatically when the passed
+ *        defaults array is loaded with writeRegisterBlock or loadSelfbootImage)
+ *
+ * @param defaults PROGMEM array holding the parameter RAM content after boot
+ *        (DSP_parameter_data, or DSP_eeprom_firmware + EE_PARAMETER_OFFSET)
+ * @param defaultsSize Size of the defaults array in bytes (PARAMETER_SIZE or EE_PARAMETER_SIZE)
+ */
+void DSPShadow::begin(const uint8_t *defaults, uint16_t defaultsSize)
+{
+  clear();
+  _defaults = defaults;
+  _defaultsWords = defaultsSize / 4;
+  _defaultsValid = (defaults != nullptr);
+}
+
+
+/**
+ * @brief Forgets all tracked addresses and stops trusting the defaults
+ */
+void DSPShadow::clear()
+{
+  for(uint16_t i = 0; i < _size; i++)
+    _entries[i].address = SHADOW_FREE;
+  _used = 0;
+  _defaultsValid = false;
+}
+
+
+/**
+ * @brief Checks if a word differs from what the DSP already holds, and records it
+ *
+ * @param address Parameter RAM address
+ * @param value 32-bit word about to be written
+ * @return true if the word has to be written to the DSP, false if it can be dropped
+ */
+bool DSPShadow::changed(uint16_t address, uint32_t value)
+{
+  int16_t slot = find(address);
+
+  // Tracked address
+  if(slot >= 0 && _entries[slot].address == address)
+  {
+    if(_entries[slot].value == value)
+      return false;
+    _entries[slot].value = value;
+    return true;
+  }
+
+  // Untracked address that still holds its default value
+  if(slot < 0 && _defaultsValid && address < _defaultsWords)
+  {
+    uint32_t defaultValue = 0;
+    for(uint8_t i = 0; i < 4; i++)
+      defaultValue = defaultValue << 8 | pgm_read_byte(&_defaults[address * 4 + i]);
+    if(defaultValue == value)
+      return false;
+  }
+
+  // Track the new value. Free slots are only taken for new addresses
+  if(slot >= 0 || _used < _size)
+  {
+    if(slot < 0)
+    {
+      uint16_t i = address % _size;
+      while(_entries[i].address != SHADOW_FREE)
+        i = (i + 1) % _size;
+      slot = i;
+      _used++;
+    }
+    _entries[slot].address = address;
+    _entries[slot].value = value;
+  }
+  else // Table full. This address now differs from its default without being tracked
+    _defaultsValid = false;
+
+  return true;
+}
+
+
+/**
+ * @brief Forgets the values of a range of addresses that were written outside of safeload
+ *
+ * @param address First parameter RAM address
+ * @param count Number of addresses
+ */
+void DSPShadow::invalidate(uint16_t address, uint16_t count)
+{
+  for(uint16_t i = 0; i < _size; i++)
+  {
+    uint16_t entryAddress = _entries[i].address & ~SHADOW_UNKNOWN;
+    if(_entries[i].address != SHADOW_FREE && entryAddress >= address && entryAddress < address + count)
+      _entries[i].address = entryAddress | SHADOW_UNKNOWN;
+  }
+
+  // Untracked addresses in the range may no longer hold their defaults
+  if(count > 0)
+    _defaultsValid = false;
+}
+
+
+/**
+ * @brief Checks if the passed array is the defaults array this shadow was started with
+ *
+ * @param data PROGMEM array
+ * @return true if data points to the defaults
+ */
+bool DSPShadow::isDefaults(const uint8_t *data) const
+{
+  return _defaults != nullptr && data == _defaults;
+}
+
+
+/**
+ * @brief Returns the number of tracked addresses
+ *
+ * @return uint16_t used hash table slots
+ */
+uint16_t DSPShadow::used() const
+{
+  return _used;
+}
+
+
+/*******************************************************************************************
+**                                     PRIVATE METHODS                                    **
+*******************************************************************************************/
+
+
+/**
+ * @brief Looks up the slot holding an address
+ *
+ * @param address Parameter RAM address
+ * @return int16_t slot index, or -1 if the address isn't tracked
+ */
+int16_t DSPShadow::find(uint16_t address) const
+{
+  if(_size == 0)
+    return -1;
+
+  uint16_t i = address % _size;
+  for(uint16_t probes = 0; probes < _size; probes++)
+  {
+    if(_entries[i].address == SHADOW_FREE)
+      return -1;
+    if((_entries[i].address & ~SHADOW_UNKNOWN) == address)
+      return i;
+    i = (i + 1) % _size;
+  }
+  return -1;
+}
@@ -0,0 +1,65 @@
+#ifndef DSPSHADOWRAM_H
+#define DSPSHADOWRAM_H
+
+#include "DSPPlatform.h"
+#include <stdint.h>
+
+/**
+ * @brief One tracked parameter RAM word
+ */
+typedef struct dspShadowEntry_t
+{
+  uint16_t address; // Parameter RAM address. 0xFFFF = free slot, bit 15 set = value unknown
+  uint32_t value;   // Last 32-bit word written to the address
+} dspShadowEntry;
+
+
+/**
+ * @brief Sparse shadow of the DSP parameter RAM.
+ *        Only addresses that have been written are stored, in a small open addressing
+ *        hash table. Untouched addresses are compared against the parameter defaults
+ *        (the generated DSP_parameter_data array, or the parameter record of
+ *        DSP_eeprom_firmware, in PROGMEM), so they cost no RAM.
+ *        Use DSPShadowRAM<entries> to get a shadow with its own storage.
+ */
+class DSPShadow
+{
+  public:
+    DSPShadow(dspShadowEntry_t *entries, uint16_t size);
+
+    void begin(const uint8_t *defaults = nullptr, uint16_t defaultsSize = 0);
+    void clear();
+    bool changed(uint16_t address, uint32_t value);
+    void invalidate(uint16_t address, uint16_t count);
+    bool isDefaults(const uint8_t *data) const;
+    uint16_t used() const;
+
+  private:
+    int16_t find(uint16_t address) const;
+
+    dspShadowEntry_t *_entries; // Hash table storage
+    const uint16_t _size;       // Number of slots in the hash table
+    uint16_t _used;             // Number of occupied slots
+
+    const uint8_t *_defaults;   // PROGMEM parameter RAM defaults, four bytes per word
+    uint16_t _defaultsWords;    // Number of words in the defaults array
+    bool _defaultsValid;        // False once an untracked address may differ from its default
+};
+
+
+/**
+ * @brief Shadow parameter RAM that holds its own storage
+ *
+ * @tparam entries Max number of distinct addresses to track (6 bytes of RAM each)
+ */
+template <uint16_t entries>
+class DSPShadowRAM : public DSPShadow
+{
+  public:
+    DSPShadowRAM() : DSPShadow(_storage, entries) { clear(); }
+
+  private:
+    dspShadowEntry_t _storage[entries];
+};
+
+#endif
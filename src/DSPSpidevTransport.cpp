@@ -0,0 +1,175 @@
+#include "DSPSpidevTransport.h"
+
+#if defined(__linux__) && !defined(ARDUINO)
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/spi/spidev.h>
+
+/**
+ * @brief Forwards to the system ioctl, which is variadic and can't be stored directly
+ */
+static int systemIoctl(int fd, unsigned long request, void *argument)
+{
+  return ioctl(fd, request, argument);
+}
+
+
+/**
+ * @brief Constructs a new DSPSpidevTransport object
+ *
+ * @param device spidev device path, e.g. /dev/spidev0.0
+ * @param clock SPI clock speed in [Hz] (optional parameter, default 8 MHz)
+ * @param chipAddress 7-bit chip address (optional parameter, default 0)
+ */
+DSPSpidevTransport::DSPSpidevTransport(const char *device, uint32_t clock, uint8_t chipAddress)
+  : _device(device), _chipAddress(chipAddress), _clock(clock), _fd(-1), _ioctl(systemIoctl)
+{
+
+}
+
+
+/**
+ * @brief Constructs a new DSPSpidevTransport object on top of an already open file descriptor
+ *
+ * @param fd Open spidev (or mock) file descriptor. Not closed by this object
+ * @param ioctlHandler ioctl replacement (optional parameter, defaults to the system ioctl)
+ * @param clock SPI clock speed in [Hz] (optional parameter, default 8 MHz)
+ * @param chipAddress 7-bit chip address (optional parameter, default 0)
+ */
+DSPSpidevTransport::DSPSpidevTransport(int fd, ioctlFunction ioctlHandler, uint32_t clock, uint8_t chipAddress)
+  : _device(nullptr), _chipAddress(chipAddress), _clock(clock), _fd(fd), _ioctl(ioctlHandler != nullptr ? ioctlHandler : systemIoctl)
+{
+
+}
+
+
+/**
+ * @brief Closes the spidev device if it was opened by this object
+ */
+DSPSpidevTransport::~DSPSpidevTransport()
+{
+  if(_device != nullptr && _fd >= 0)
+    close(_fd);
+}
+
+
+/**
+ * @brief Opens the spidev device, sets mode 3, 8-bit words and the clock speed,
+ *        and issues three dummy reads. The chip select toggles CLATCH low three times,
+ *        which moves a control port that powered up in i2c mode over to SPI mode
+ */
+void DSPSpidevTransport::begin()
+{
+  if(_device != nullptr && _fd < 0)
+    _fd = open(_device, O_RDWR);
+  if(_fd < 0)
+    return;
+
+  uint8_t mode = SPI_MODE_3;
+  uint8_t bits = 8;
+  _ioctl(_fd, SPI_IOC_WR_MODE, &mode);
+  _ioctl(_fd, SPI_IOC_WR_BITS_PER_WORD, &bits);
+  _ioctl(_fd, SPI_IOC_WR_MAX_SPEED_HZ, &_clock);
+
+  uint8_t dummy;
+  for(uint8_t i = 0; i < 3; i++)
+    writeRead(_chipAddress, 0x0000, &dummy, sizeof(dummy));
+}
+
+
+/**
+ * @brief Sets the SPI clock speed
+ *
+ * @param clock SPI clock speed in [Hz]
+ */
+void DSPSpidevTransport::setClock(uint32_t clock)
+{
+  _clock = clock;
+  if(_fd >= 0)
+    _ioctl(_fd, SPI_IOC_WR_MAX_SPEED_HZ, &_clock);
+}
+
+
+/**
+ * @brief SPI has no acknowledge. Reports the DSP as present if the device is open
+ *
+ * @param deviceAddress Ignored
+ * @return uint8_t 0 if the device is open, 4 otherwise
+ */
+uint8_t DSPSpidevTransport::ping(uint8_t deviceAddress)
+{
+  (void)deviceAddress;
+  return _fd >= 0 ? 0 : 4;
+}
+
+
+/**
+ * @brief Writes the chip address, sub address and data in one ioctl
+ *
+ * @param deviceAddress Ignored, the chip address passed to the constructor is used
+ * @param subAddress 16-bit register or memory address
+ * @param data Data array to write
+ * @param length Number of bytes to write
+ * @return uint8_t 0 on success, 4 on error
+ */
+uint8_t DSPSpidevTransport::write(uint8_t deviceAddress, uint16_t subAddress, const uint8_t *data, uint16_t length)
+{
+  (void)deviceAddress;
+
+  uint8_t header[3] = { (uint8_t)(_chipAddress << 1), (uint8_t)(subAddress >> 8), (uint8_t)(subAddress & 0xFF) };
+  struct spi_ioc_transfer transfer[2];
+  memset(transfer, 0, sizeof(transfer));
+
+  transfer[0].tx_buf = (unsigned long)header;
+  transfer[0].len = sizeof(header);
+  transfer[0].speed_hz = _clock;
+  transfer[1].tx_buf = (unsigned long)data;
+  transfer[1].len = length;
+  transfer[1].speed_hz = _clock;
+
+  return _ioctl(_fd, SPI_IOC_MESSAGE(length ? 2 : 1), transfer) < 0 ? 4 : 0;
+}
+
+
+/**
+ * @brief Sends the chip address and sub address and clocks the data back in one ioctl
+ *
+ * @param deviceAddress Ignored, the chip address passed to the constructor is used
+ * @param subAddress 16-bit register or memory address
+ * @param data Array to store the received data in
+ * @param length Number of bytes to read
+ * @return uint8_t 0 on success, 4 on error
+ */
+uint8_t DSPSpidevTransport::writeRead(uint8_t deviceAddress, uint16_t subAddress, uint8_t *data, uint16_t length)
+{
+  (void)deviceAddress;
+
+  uint8_t header[3] = { (uint8_t)((_chipAddress << 1) | 0x01), (uint8_t)(subAddress >> 8), (uint8_t)(subAddress & 0xFF) };
+  struct spi_ioc_transfer transfer[2];
+  memset(transfer, 0, sizeof(transfer));
+
+  transfer[0].tx_buf = (unsigned long)header;
+  transfer[0].len = sizeof(header);
+  transfer[0].speed_hz = _clock;
+  transfer[1].rx_buf = (unsigned long)data;
+  transfer[1].len = length;
+  transfer[1].speed_hz = _clock;
+
+  return _ioctl(_fd, SPI_IOC_MESSAGE(2), transfer) < 0 ? 4 : 0;
+}
+
+
+/**
+ * @brief Max bytes per transfer. spidev's default buffer is 4096 bytes
+ *
+ * @return uint16_t max data bytes per transaction
+ */
+uint16_t DSPSpidevTransport::maxChunk() const
+{
+  return 4096 - 3;
+}
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef DSPSPIDEVTRANSPORT_H
+#define DSPSPIDEVTRANSPORT_H
+
+#if defined(__linux__) && !defined(ARDUINO)
+
+#include <stdint.h>
+#include "DSPTransport.h"
+
+/**
+ * @brief Linux spidev control port transport for the ADAU1401/ADAU1701/ADAU1702.
+ *        The spidev chip select drives CLATCH. Each write and each read is issued
+ *        as a single SPI_IOC_MESSAGE ioctl with the chip select held for the whole
+ *        transaction. Like DSPLinuxI2CTransport, the ioctl call can be replaced,
+ *        which lets the transport run against a mock file descriptor.
+ */
+class DSPSpidevTransport : public DSPTransport
+{
+  public:
+    typedef int (*ioctlFunction)(int fd, unsigned long request, void *argument);
+
+    DSPSpidevTransport(const char *device, uint32_t clock = 8000000, uint8_t chipAddress = 0x00);
+    DSPSpidevTransport(int fd, ioctlFunction ioctlHandler = nullptr, uint32_t clock = 8000000, uint8_t chipAddress = 0x00);
+    ~DSPSpidevTransport();
+
+    void begin();
+    void setClock(uint32_t clock);
+    uint8_t ping(uint8_t deviceAddress);
+    uint8_t write(uint8_t deviceAddress, uint16_t subAddress, const uint8_t *data, uint16_t length);
+    uint8_t writeRead(uint8_t deviceAddress, uint16_t subAddress, uint8_t *data, uint16_t length);
+    uint16_t maxChunk() const;
+
+  private:
+    const char *_device;        // spidev device path, e.g. /dev/spidev0.0. nullptr if an fd was passed
+    const uint8_t _chipAddress; // 7-bit chip address sent in the first byte
+    uint32_t _clock;            // SPI clock speed in [Hz]
+    int _fd;                    // Open spidev file descriptor, -1 if closed
+    ioctlFunction _ioctl;       // ioctl implementation, ::ioctl unless a mock is passed
+};
+
+#endif
+
+#endif
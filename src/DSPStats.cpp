@@ -0,0 +1,123 @@
+#include "DSPStats.h"
+
+/**
+ * @brief Constructs a new DSPStats object with all counters cleared
+ */
+DSPStats::DSPStats()
+{
+  reset();
+}
+
+
+/**
+ * @brief Clears all counters
+ */
+void DSPStats::reset()
+{
+  _totals = dspStatsTotals_t();
+  for(uint8_t i = 0; i < StatsFunctionCount; i++)
+    _functions[i] = dspStatsEntry_t();
+  _current = StatsOther;
+}
+
+
+/**
+ * @brief Returns the counters for all traffic
+ *
+ * @return const dspStatsTotals_t& totals
+ */
+const dspStatsTotals_t &DSPStats::totals() const
+{
+  return _totals;
+}
+
+
+/**
+ * @brief Returns the counters for one public function
+ *
+ * @param function Function to get the counters for
+ * @return const dspStatsEntry_t& function counters
+ */
+const dspStatsEntry_t &DSPStats::function(dspStatsFunction function) const
+{
+  if(function >= StatsFunctionCount)
+    function = StatsOther;
+  return _functions[function];
+}
+
+
+/**
+ * @brief Records one bus transaction
+ *
+ * @param bytesSent Data bytes written
+ * @param bytesReceived Data bytes read
+ * @param status Transport status code (0 = success)
+ * @param elapsed Time the transaction took in [us]
+ */
+void DSPStats::record(uint16_t bytesSent, uint16_t bytesReceived, uint8_t status, uint32_t elapsed)
+{
+  _totals.transactions++;
+  _totals.bytesSent += bytesSent;
+  _totals.bytesReceived += bytesReceived;
+  _totals.busMicros += elapsed;
+
+  dspStatsEntry_t &entry = _functions[_current];
+  entry.transactions++;
+  entry.bytesSent += bytesSent;
+  entry.bytesReceived += bytesReceived;
+
+  if(status != 0)
+  {
+    if(status == 2)
+      _totals.addressNacks++;
+    else if(status == 3)
+      _totals.dataNacks++;
+    else
+      _totals.otherErrors++;
+    _totals.lastError = status;
+    entry.errors++;
+  }
+}
+
+
+/**
+ * @brief Records one safeload transfer
+ */
+void DSPStats::safeload()
+{
+  _totals.safeloads++;
+  _functions[_current].safeloads++;
+}
+
+
+/**
+ * @brief Starts accounting traffic to a public function
+ *
+ * @param stats Stats object to account to, or nullptr to do nothing
+ * @param function Function the traffic belongs to
+ */
+DSPStatsScope::DSPStatsScope(DSPStats *stats, dspStatsFunction function)
+  : _stats(nullptr), _start(0)
+{
+  // Only the outermost scope counts
+  if(stats == nullptr || stats->_current != StatsOther)
+    return;
+
+  _stats = stats;
+  _stats->_current = function;
+  _stats->_functions[function].calls++;
+  _start = micros();
+}
+
+
+/**
+ * @brief Adds the time spent in the function and stops accounting to it
+ */
+DSPStatsScope::~DSPStatsScope()
+{
+  if(_stats == nullptr)
+    return;
+
+  _stats->_functions[_stats->_current].micros += micros() - _start;
+  _stats->_current = StatsOther;
+}
@@ -0,0 +1,121 @@
+#ifndef DSPSTATS_H
+#define DSPSTATS_H
+
+#include "DSPPlatform.h"
+#include <stdint.h>
+
+/**
+ * @brief Public functions bus traffic is accounted to
+ */
+typedef enum
+{
+  StatsOther,
+  StatsMux,
+  StatsDemux,
+  StatsGain,
+  StatsVolume,
+  StatsMute,
+  StatsDcSource,
+  StatsDynamicBass,
+  StatsHardClip,
+  StatsSoftClip,
+  StatsSineSource,
+  StatsSquareSource,
+  StatsSawtoothSource,
+  StatsTriangleSource,
+  StatsAudioDelay,
+  StatsEQfirstOrder,
+  StatsEQsecondOrder,
+  StatsToneControl,
+  StatsStateVariable,
+  StatsCompressorRMS,
+  StatsCompressorPeak,
+  StatsGraphicEQ,
+  StatsMuteADC,
+  StatsMuteDAC,
+  StatsCommit,
+  StatsPoll,
+  StatsWriteRegister,
+  StatsWriteRegisterBlock,
+  StatsWriteParameterBlock,
+  StatsReadBack,
+  StatsReadRegister,
+  StatsLoadProgram,
+  StatsVerifyProgram,
+  StatsFunctionCount
+} dspStatsFunction;
+
+
+/**
+ * @brief Bus traffic totals
+ */
+typedef struct dspStatsTotals_t
+{
+  uint32_t transactions;  // Number of bus transactions
+  uint32_t bytesSent;     // Data bytes written, register addresses excluded
+  uint32_t bytesReceived; // Data bytes read
+  uint32_t safeloads;     // Number of safeload transfers (IST) triggered
+  uint32_t busMicros;     // Time spent in the transport in [us]
+  uint16_t addressNacks;  // Transactions where the address was not acknowledged
+  uint16_t dataNacks;     // Transactions where data was not acknowledged
+  uint16_t otherErrors;   // Transactions that failed for other reasons
+  uint8_t lastError;      // Status code of the last failed transaction
+} dspStatsTotals;
+
+
+/**
+ * @brief Bus traffic caused by one public function
+ */
+typedef struct dspStatsEntry_t
+{
+  uint32_t calls;         // Number of calls
+  uint32_t transactions;  // Number of bus transactions
+  uint32_t bytesSent;     // Data bytes written, register addresses excluded
+  uint32_t bytesReceived; // Data bytes read
+  uint32_t micros;        // Time spent in the function, computations included, in [us]
+  uint16_t errors;        // Number of failed transactions
+  uint16_t safeloads;     // Number of safeload transfers triggered
+} dspStatsEntry;
+
+
+/**
+ * @brief Bus traffic counters for a SigmaDSP object.
+ *        Copy the object to take a snapshot
+ */
+class DSPStats
+{
+  public:
+    DSPStats();
+
+    void reset();
+    const dspStatsTotals_t &totals() const;
+    const dspStatsEntry_t &function(dspStatsFunction function) const;
+
+    void record(uint16_t bytesSent, uint16_t bytesReceived, uint8_t status, uint32_t elapsed);
+    void safeload();
+
+  private:
+    friend class DSPStatsScope;
+
+    dspStatsTotals_t _totals;                         // Counters for all traffic
+    dspStatsEntry_t _functions[StatsFunctionCount];   // Counters per public function
+    dspStatsFunction _current;                        // Function traffic is currently accounted to
+};
+
+
+/**
+ * @brief Accounts all traffic until it goes out of scope to a public function.
+ *        Nested scopes are accounted to the outermost function
+ */
+class DSPStatsScope
+{
+  public:
+    DSPStatsScope(DSPStats *stats, dspStatsFunction function);
+    ~DSPStatsScope();
+
+  private:
+    DSPStats *_stats; // Stats object, nullptr if the scope is inactive
+    uint32_t _start;  // micros() timestamp the scope was entered
+};
+
+#endif
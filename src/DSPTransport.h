@@ -0,0 +1,36 @@
+#ifndef DSPTRANSPORT_H
+#define DSPTRANSPORT_H
+
+#include <stdint.h>
+
+/**
+ * @brief Abstract control port transport used by SigmaDSP and DSPEEPROM.
+ *        Both the ADAU1701 and the 24xx EEPROMs address their memory through
+ *        a 16-bit sub address, so every call takes a device address and a sub address.
+ *        Return codes follow the Wire library's endTransmission():
+ *        0 - success;
+ *        2 - address send, nack received;
+ *        3 - data send, nack received;
+ *        4 - other error
+ */
+class DSPTransport
+{
+  public:
+    virtual ~DSPTransport() {}
+
+    // Init and setup
+    virtual void begin() {}
+    virtual void setClock(uint32_t clock) { (void)clock; }
+    virtual uint8_t ping(uint8_t deviceAddress) = 0;
+
+    // Writes length bytes to subAddress in a single transaction
+    virtual uint8_t write(uint8_t deviceAddress, uint16_t subAddress, const uint8_t *data, uint16_t length) = 0;
+
+    // Sets subAddress and reads length bytes back from it
+    virtual uint8_t writeRead(uint8_t deviceAddress, uint16_t subAddress, uint8_t *data, uint16_t length) = 0;
+
+    // Max number of data bytes (not counting the sub address) a single write or read can hold
+    virtual uint16_t maxChunk() const = 0;
+};
+
+#endif
@@ -0,0 +1,195 @@
+#include "DSPUpdateQueue.h"
+
+// Start of the addresses in a safeload group buffer
+#define QUEUE_ADDR_OFFSET (5 * 5)
+
+/**
+ * @brief Constructs a new DSPQueue object on top of the passed storage
+ *
+ * @param entries Ring buffer storage
+ * @param size Number of entries in the storage
+ */
+DSPQueue::DSPQueue(dspQueueEntry_t *entries, uint8_t size)
+  : _entries(entries), _size(size), _head(0), _count(0)
+{
+
+}
+
+
+/**
+ * @brief Drops all pending groups
+ */
+void DSPQueue::clear()
+{
+  _head = 0;
+  _count = 0;
+}
+
+
+/**
+ * @brief Queues a safeload group. A pending group that sets exactly the same words is
+ *        replaced in place. Otherwise the words this group sets are dropped from the
+ *        pending groups, groups left empty are removed, and the group is appended
+ *
+ * @param buffer Safeload group (five 5-byte words followed by five 16-bit addresses)
+ * @param count Number of words in the group
+ * @return true if the group was queued, false if the queue is full
+ */
+bool DSPQueue::push(const uint8_t *buffer, uint8_t count)
+{
+  uint8_t slot = _size;
+  bool roomFreed = false;
+
+  for(uint8_t i = 0; i < _count; i++)
+  {
+    const dspQueueEntry_t &entry = _entries[(_head + i) % _size];
+    uint8_t overlap = 0;
+    for(uint8_t j = 0; j < entry.count; j++)
+    {
+      if(contains(buffer, count, address(entry.buffer, j)))
+        overlap++;
+    }
+
+    // Same words, the stale group is replaced and keeps its turn
+    if(overlap == entry.count && overlap == count)
+    {
+      slot = (_head + i) % _size;
+      break;
+    }
+    if(overlap == entry.count)
+      roomFreed = true;
+  }
+
+  if(slot == _size)
+  {
+    // Leave the queue untouched if the group can't go in anyway
+    if(_count >= _size && roomFreed == false)
+      return false;
+
+    // The older values of these words are stale, the rest of their groups still has to go out
+    uint8_t i = 0;
+    while(i < _count)
+    {
+      dspQueueEntry_t &entry = _entries[(_head + i) % _size];
+      uint8_t j = 0;
+      while(j < entry.count)
+      {
+        if(contains(buffer, count, address(entry.buffer, j)))
+          removeWord(entry, j);
+        else
+          j++;
+      }
+
+      if(entry.count == 0)
+        removeEntry(i);
+      else
+        i++;
+    }
+
+    slot = (_head + _count) % _size;
+    _count++;
+  }
+
+  _entries[slot].count = count;
+  for(uint8_t i = 0; i < sizeof(_entries[slot].buffer); i++)
+    _entries[slot].buffer[i] = buffer[i];
+
+  return true;
+}
+
+
+/**
+ * @brief Takes the oldest pending group out of the queue
+ *
+ * @param buffer Array to copy the safeload group to (35 bytes)
+ * @param count Variable to store the number of words in the group in
+ * @return true if a group was returned, false if the queue is empty
+ */
+bool DSPQueue::pop(uint8_t *buffer, uint8_t &count)
+{
+  if(_count == 0)
+    return false;
+
+  count = _entries[_head].count;
+  for(uint8_t i = 0; i < sizeof(_entries[_head].buffer); i++)
+    buffer[i] = _entries[_head].buffer[i];
+
+  _head = (_head + 1) % _size;
+  _count--;
+  return true;
+}
+
+
+/**
+ * @brief Returns the number of groups waiting to be sent
+ *
+ * @return uint8_t pending groups
+ */
+uint8_t DSPQueue::pending() const
+{
+  return _count;
+}
+
+
+/**
+ * @brief Returns the address of a word in a safeload group
+ *
+ * @param buffer Safeload group
+ * @param index Word in the group
+ * @return uint16_t parameter RAM address of the word
+ */
+uint16_t DSPQueue::address(const uint8_t *buffer, uint8_t index)
+{
+  return (uint16_t)buffer[QUEUE_ADDR_OFFSET + index * 2] << 8 | buffer[QUEUE_ADDR_OFFSET + index * 2 + 1];
+}
+
+
+/**
+ * @brief Checks if a safeload group sets the passed address
+ *
+ * @param buffer Safeload group
+ * @param count Number of words in the group
+ * @param memoryAddress Parameter RAM address to look for
+ * @return true if one of the words goes to memoryAddress
+ */
+bool DSPQueue::contains(const uint8_t *buffer, uint8_t count, uint16_t memoryAddress)
+{
+  for(uint8_t i = 0; i < count; i++)
+  {
+    if(address(buffer, i) == memoryAddress)
+      return true;
+  }
+  return false;
+}
+
+
+/**
+ * @brief Removes a word from a pending group, moving the words after it down
+ *
+ * @param entry Pending group
+ * @param index Word to remove
+ */
+void DSPQueue::removeWord(dspQueueEntry_t &entry, uint8_t index)
+{
+  for(uint8_t i = index; i + 1 < entry.count; i++)
+  {
+    for(uint8_t j = 0; j < 5; j++)
+      entry.buffer[i * 5 + j] = entry.buffer[(i + 1) * 5 + j];
+    entry.buffer[QUEUE_ADDR_OFFSET + i * 2] = entry.buffer[QUEUE_ADDR_OFFSET + (i + 1) * 2];
+    entry.buffer[QUEUE_ADDR_OFFSET + i * 2 + 1] = entry.buffer[QUEUE_ADDR_OFFSET + (i + 1) * 2 + 1];
+  }
+  entry.count--;
+}
+
+
+/**
+ * @brief Removes a pending group, moving the newer groups up one place
+ *
+ * @param position Position of the group, counted from the oldest one
+ */
+void DSPQueue::removeEntry(uint8_t position)
+{
+  for(uint8_t i = position; i + 1 < _count; i++)
+    _entries[(_head + i) % _size] = _entries[(_head + i + 1) % _size];
+  _count--;
+}
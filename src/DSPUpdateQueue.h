@@ -0,0 +1,61 @@
+#ifndef DSPUPDATEQUEUE_H
+#define DSPUPDATEQUEUE_H
+
+#include <stdint.h>
+
+/**
+ * @brief One queued safeload group, laid out like the safeload registers
+ */
+typedef struct dspQueueEntry_t
+{
+  uint8_t count;                   // Number of words in the group (1-5)
+  uint8_t buffer[5 * 5 + 5 * 2];   // Five 5-byte data words followed by five 16-bit addresses
+} dspQueueEntry;
+
+
+/**
+ * @brief FIFO of pending safeload groups where the latest value wins, word by word.
+ *        A new group for the same words as a waiting one replaces it in place.
+ *        Otherwise the words it sets are dropped from the waiting groups, which
+ *        may hold words of other DSP blocks packed by commit(), and it's appended.
+ *        Use DSPUpdateQueue<entries> to get a queue with its own storage.
+ */
+class DSPQueue
+{
+  public:
+    DSPQueue(dspQueueEntry_t *entries, uint8_t size);
+
+    void clear();
+    bool push(const uint8_t *buffer, uint8_t count);
+    bool pop(uint8_t *buffer, uint8_t &count);
+    uint8_t pending() const;
+
+  private:
+    static uint16_t address(const uint8_t *buffer, uint8_t index);
+    static bool contains(const uint8_t *buffer, uint8_t count, uint16_t memoryAddress);
+    void removeWord(dspQueueEntry_t &entry, uint8_t index);
+    void removeEntry(uint8_t position);
+
+    dspQueueEntry_t *_entries; // Ring buffer storage
+    const uint8_t _size;       // Number of slots in the ring buffer
+    uint8_t _head;             // Oldest pending group
+    uint8_t _count;            // Number of pending groups
+};
+
+
+/**
+ * @brief Update queue that holds its own storage
+ *
+ * @tparam entries Max number of pending safeload groups (36 bytes of RAM each)
+ */
+template <uint8_t entries>
+class DSPUpdateQueue : public DSPQueue
+{
+  public:
+    DSPUpdateQueue() : DSPQueue(_storage, entries) {}
+
+  private:
+    dspQueueEntry_t _storage[entries];
+};
+
+#endif
@@ -0,0 +1,104 @@
+#include "DSPWireTransport.h"
+
+#ifdef ARDUINO
+
+/**
+ * @brief Constructs a new DSPWireTransport object
+ *
+ * @param WireObject TwoWire i2c object
+ */
+DSPWireTransport::DSPWireTransport(TwoWire &WireObject)
+  : _WireObject(WireObject)
+{
+
+}
+
+
+/**
+ * @brief Sets the i2c clock speed
+ *
+ * @param clock i2c clock speed in [Hz]
+ */
+void DSPWireTransport::setClock(uint32_t clock)
+{
+  _WireObject.setClock(clock);
+}
+
+
+/**
+ * @brief Sends an i2c ping message
+ *
+ * @param deviceAddress 7-bit i2c address
+ * @return uint8_t endTransmission() status code
+ */
+uint8_t DSPWireTransport::ping(uint8_t deviceAddress)
+{
+  _WireObject.beginTransmission(deviceAddress);
+  return _WireObject.endTransmission();
+}
+
+
+/**
+ * @brief Writes a block of data in a single i2c transaction
+ *
+ * @param deviceAddress 7-bit i2c address
+ * @param subAddress 16-bit register or memory address
+ * @param data Data array to write
+ * @param length Number of bytes to write (max maxChunk())
+ * @return uint8_t endTransmission() status code
+ */
+uint8_t DSPWireTransport::write(uint8_t deviceAddress, uint16_t subAddress, const uint8_t *data, uint16_t length)
+{
+  _WireObject.beginTransmission(deviceAddress); // Begin write
+
+  _WireObject.write(subAddress >> 8);   // Send high address
+  _WireObject.write(subAddress & 0xFF); // Send low address
+
+  for(uint16_t i = 0; i < length; i++)
+    _WireObject.write(data[i]); // Send all bytes in passed array
+
+  return _WireObject.endTransmission(); // Write out data to I2C and stop transmitting
+}
+
+
+/**
+ * @brief Sets the sub address and reads data back using a repeated start
+ *
+ * @param deviceAddress 7-bit i2c address
+ * @param subAddress 16-bit register or memory address
+ * @param data Array to store the received data in
+ * @param length Number of bytes to read (max maxChunk())
+ * @return uint8_t endTransmission() status code, or 4 if fewer bytes than requested were received
+ */
+uint8_t DSPWireTransport::writeRead(uint8_t deviceAddress, uint16_t subAddress, uint8_t *data, uint16_t length)
+{
+  _WireObject.beginTransmission(deviceAddress); // Begin write
+  _WireObject.write(subAddress >> 8);   // Send high address
+  _WireObject.write(subAddress & 0xFF); // Send low address
+  uint8_t status = _WireObject.endTransmission(false);
+  if(status != 0)
+    return status;
+
+  _WireObject.requestFrom(deviceAddress, (uint8_t)length);
+  for(uint16_t i = 0; i < length; i++)
+  {
+    if(!_WireObject.available())
+      return 4;
+    data[i] = _WireObject.read();
+  }
+
+  return 0;
+}
+
+
+/**
+ * @brief Returns the number of data bytes the Wire buffer can hold after the two address bytes
+ *
+ * @return uint16_t max data bytes per transaction
+ */
+uint16_t DSPWireTransport::maxChunk() const
+{
+  return SIGMADSP_I2C_BUFFER_SIZE - 2;
+}
+
+#endif
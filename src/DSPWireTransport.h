@@ -0,0 +1,42 @@
+#ifndef DSPWIRETRANSPORT_H
+#define DSPWIRETRANSPORT_H
+
+#ifdef ARDUINO
+
+#include <Arduino.h>
+#include <Wire.h>
+#include "DSPTransport.h"
+
+// Number of bytes the Wire library can hold in one transaction.
+// Used to pack as many whole registers as possible into each burst write
+#ifndef SIGMADSP_I2C_BUFFER_SIZE
+  #if defined(I2C_BUFFER_LENGTH)
+    #define SIGMADSP_I2C_BUFFER_SIZE I2C_BUFFER_LENGTH
+  #elif defined(BUFFER_LENGTH)
+    #define SIGMADSP_I2C_BUFFER_SIZE BUFFER_LENGTH
+  #else
+    #define SIGMADSP_I2C_BUFFER_SIZE 32
+  #endif
+#endif
+
+/**
+ * @brief Default transport. Talks to the DSP and EEPROM through a TwoWire object
+ */
+class DSPWireTransport : public DSPTransport
+{
+  public:
+    DSPWireTransport(TwoWire &WireObject);
+
+    void setClock(uint32_t clock);
+    uint8_t ping(uint8_t deviceAddress);
+    uint8_t write(uint8_t deviceAddress, uint16_t subAddress, const uint8_t *data, uint16_t length);
+    uint8_t writeRead(uint8_t deviceAddress, uint16_t subAddress, uint8_t *data, uint16_t length);
+    uint16_t maxChunk() const;
+
+  private:
+    TwoWire &_WireObject; // Reference to passed Wire object
+};
+
+#endif
+
+#endif
@@ -1,5 +1,4 @@
 #include "SigmaDSP.h"
-#include "Arduino.h"
 
 /*******************************************************************************************
 **                                      PUBLIC METHODS                                    **
@@ -13,25 +12,50 @@
  * @param sample_freq The audio sample frequency in [Hz]
  * @param resetPin pin to reset the DSP with (optional parameter)
  */
+#ifdef ARDUINO
 SigmaDSP::SigmaDSP(TwoWire &WireObject, uint8_t i2cAddress, float sample_freq, int8_t resetPin)
-  : FS(sample_freq), _WireObject(WireObject), _dspAddress(i2cAddress), _resetPin(resetPin)
+  : FS(sample_freq), _wireTransport(WireObject), _transport(_wireTransport), _dspAddress(i2cAddress), _resetPin(resetPin)
+{
+
+}
+#endif
+
+
+/**
+ * @brief Construct a new SigmaDSP::SigmaDSP object that communicates through a custom transport
+ *
+ * @param transport Transport object (SPI, mock, batching wrapper etc.)
+ * @param i2cAddress 7-bit i2c address
+ * @param sample_freq The audio sample frequency in [Hz]
+ * @param resetPin pin to reset the DSP with, only driven on Arduino (optional parameter)
+ */
+SigmaDSP::SigmaDSP(DSPTransport &transport, uint8_t i2cAddress, float sample_freq, int8_t resetPin)
+#ifdef ARDUINO
+  : FS(sample_freq), _wireTransport(Wire), _transport(transport), _dspAddress(i2cAddress), _resetPin(resetPin)
+#else
+  : FS(sample_freq), _transport(transport), _dspAddress(i2cAddress), _resetPin(resetPin)
+#endif
 {
 
 }
 
 
 /**
- * @brief Starts the i2c interface
+ * @brief Starts the transport and resets the DSP if a reset pin is present
  */
 void SigmaDSP::begin()
 {
+  _transport.begin();
+
   // Reset DSP if pin is present
+#ifdef ARDUINO
   if(_resetPin >= 0)
   {
     pinMode(_resetPin, OUTPUT);
     digitalWrite(_resetPin, HIGH);
     reset();
   }
+#endif
 }
 
 
@@ -42,21 +66,25 @@ void SigmaDSP::begin()
  */
 void SigmaDSP::i2cClock(uint32_t clock)
 {
-  _WireObject.setClock(clock);
+  _transport.setClock(clock);
 }
 
 
 /**
- * @brief Perform a DSP hardware reset
+ * @brief Perform a DSP hardware reset. Returns right after the reset pulse,
+ *        use waitForBoot() or bootStatus() to find out when the DSP is up again.
+ *        Does nothing on a host build, where the board resets the DSP
  */
 void SigmaDSP::reset()
 {
+#ifdef ARDUINO
   if(_resetPin >= 0) // Only run of reset pin is present
   {
     digitalWrite(_resetPin, LOW);
-    delay(200);
+    delayMicroseconds(SIGMADSP_RESET_PULSE_US);
     digitalWrite(_resetPin, HIGH);
   }
+#endif
 }
 
 
@@ -71,8 +99,217 @@ void SigmaDSP::reset()
  */
 uint8_t SigmaDSP::ping()
 {
-  _WireObject.beginTransmission(_dspAddress);
-  return _WireObject.endTransmission();
+  return _transport.ping(_dspAddress);
+}
+
+
+/**
+ * @brief Checks how far the DSP has come after a reset or power-up, without blocking.
+ *        The DSP doesn't answer until it's up and done loading from the self-boot EEPROM,
+ *        and the core starts running once the last core register write of the program is in
+ *
+ * @return dspBootStatus BootBusy, BootIdle or BootRunning
+ */
+dspBootStatus SigmaDSP::bootStatus()
+{
+  if(ping() != 0)
+    return BootBusy;
+
+  uint8_t coreRegister[2];
+  if(busRead(CoreRegister, coreRegister, sizeof(coreRegister)) != 0)
+    return BootBusy;
+
+  // The CR bit releases the core from its cleared state
+  if(coreRegister[1] & 0x04)
+    return BootRunning;
+  else
+    return BootIdle;
+}
+
+
+/**
+ * @brief Waits for the DSP to reach a start-up state, and returns as soon as it does.
+ *        Use it instead of fixed delays after reset() or power-up
+ *
+ * @param timeout Max time to wait in [ms]
+ * @param state BootRunning to wait for the self-boot EEPROM to be loaded,
+ *              BootIdle to wait until the DSP is ready for loadProgram() (optional parameter)
+ * @return true if the DSP got there in time, false on timeout
+ */
+bool SigmaDSP::waitForBoot(uint16_t timeout, dspBootStatus state)
+{
+  uint32_t start = millis();
+
+  while(bootStatus() < state)
+  {
+    if(millis() - start >= timeout)
+      return false;
+    delay(SIGMADSP_BOOT_POLL_INTERVAL);
+  }
+
+  return true;
+}
+
+
+/**
+ * @brief Attaches a shadow of the parameter RAM. Safeload writes of words the DSP
+ *        already holds are dropped from then on
+ *
+ * @param shadow Shadow object, e.g. DSPShadowRAM<64>
+ * @param defaults PROGMEM parameter RAM content after boot, DSP_parameter_data, or
+ *        DSP_eeprom_firmware + EE_PARAMETER_OFFSET when the program is loaded from a self-boot image (optional parameter)
+ * @param defaultsSize Size of the defaults array in bytes, PARAMETER_SIZE or EE_PARAMETER_SIZE (optional parameter)
+ */
+void SigmaDSP::attachShadow(DSPShadow &shadow, const uint8_t *defaults, uint16_t defaultsSize)
+{
+  _shadow = &shadow;
+  _shadow->begin(defaults, defaultsSize);
+}
+
+
+/**
+ * @brief Detaches the parameter RAM shadow. All safeload writes go to the DSP again
+ */
+void SigmaDSP::detachShadow()
+{
+  _shadow = nullptr;
+}
+
+
+/**
+ * @brief Attaches bus traffic counters. Traffic is accounted to the public function that caused it
+ *
+ * @param stats Stats object to count into
+ */
+void SigmaDSP::attachStats(DSPStats &stats)
+{
+  _stats = &stats;
+}
+
+
+/**
+ * @brief Detaches the bus traffic counters
+ */
+void SigmaDSP::detachStats()
+{
+  _stats = nullptr;
+}
+
+
+/**
+ * @brief Returns the attached bus traffic counters
+ *
+ * @return DSPStats* stats object, nullptr if none is attached
+ */
+DSPStats *SigmaDSP::getStats()
+{
+  return _stats;
+}
+
+
+/**
+ * @brief Attaches an update queue. DSP functions then only queue their safeload groups and
+ *        return right away, and poll() sends them to the DSP. A newer group for the same DSP
+ *        block replaces the pending one, so only the freshest values are sent.
+ *        Direct writeRegister() calls bypass the queue, call flushQueue() before using them
+ *
+ * @param queue Update queue to use, e.g. a DSPUpdateQueue<8>
+ */
+void SigmaDSP::attachQueue(DSPQueue &queue)
+{
+  _queue = &queue;
+  _queue->clear();
+}
+
+
+/**
+ * @brief Sends all pending groups and detaches the update queue
+ */
+void SigmaDSP::detachQueue()
+{
+  flushQueue();
+  _queue = nullptr;
+}
+
+
+/**
+ * @brief Sends the oldest pending safeload group if the previous safeload transfer is done.
+ *        Call this from the main loop when an update queue is attached, or let a
+ *        DSPQueueWorker thread call it on Linux. Don't call it from an interrupt,
+ *        the transport may need interrupts to get the group out
+ *
+ * @return uint8_t number of groups still pending
+ */
+uint8_t SigmaDSP::poll()
+{
+  DSPStatsScope scope(_stats, StatsPoll);
+  if(_queue == nullptr)
+    return 0;
+
+  if(_queue->pending() > 0 && safeload_ready())
+    queue_send();
+
+  return _queue->pending();
+}
+
+
+/**
+ * @brief Sends all pending safeload groups, blocking until the queue is empty
+ */
+void SigmaDSP::flushQueue()
+{
+  DSPStatsScope scope(_stats, StatsPoll);
+  if(_queue == nullptr)
+    return;
+
+  while(_queue->pending() > 0)
+    queue_send();
+}
+
+
+/**
+ * @brief Attaches a coefficient cache. EQfirstOrder(), EQsecondOrder(), toneControl() and
+ *        dynamicBass() then look up their parameter words before calculating them, so
+ *        settings that were used recently cost no filter math
+ *
+ * @param cache Coefficient cache to use, e.g. a DSPCoefficientCache<8>
+ */
+void SigmaDSP::attachCache(DSPCache &cache)
+{
+  _cache = &cache;
+}
+
+
+/**
+ * @brief Detaches the coefficient cache. All coefficients are calculated again
+ */
+void SigmaDSP::detachCache()
+{
+  _cache = nullptr;
+}
+
+
+/**
+ * @brief Sets the PROGMEM coefficient table graphicEQ() reads from. The table is
+ *        generated by extras/graphic_eq_table.cpp for a fixed sample rate, Q and gain grid.
+ *        The sample rate can't be checked at compile time, as FS is a constructor parameter,
+ *        so a table generated for a different sample rate is refused here instead
+ *
+ * @param table PROGMEM table of 5 words per band and gain step, graphicEQTable
+ * @param bands Number of bands in the table, GRAPHIC_EQ_BANDS
+ * @param steps Number of gain steps per band, GRAPHIC_EQ_STEPS
+ * @param fs Sample rate the table was generated for in [Hz], GRAPHIC_EQ_FS
+ * @return true if the table is used, false if fs doesn't match the sample rate of this object
+ */
+bool SigmaDSP::setGraphicEQTable(const int32_t *table, uint8_t bands, uint8_t steps, float fs)
+{
+  if(fabsf(fs - FS) > 0.5f)
+    return false;
+
+  _graphicEQTable = table;
+  _graphicEQBands = bands;
+  _graphicEQSteps = steps;
+  return true;
 }
 
 
@@ -87,6 +324,7 @@ uint8_t SigmaDSP::ping()
  */
 void SigmaDSP::mux(uint16_t startMemoryAddress, uint8_t index, uint8_t numberOfIndexes)
 {
+  DSPStatsScope scope(_stats, StatsMux);
   if(numberOfIndexes == 0)
     safeload_write(startMemoryAddress, index);
   else
@@ -116,6 +354,7 @@ void SigmaDSP::mux(uint16_t startMemoryAddress, uint8_t index, uint8_t numberOfI
  */
 void SigmaDSP::demux(uint16_t startMemoryAddress, uint8_t index, uint8_t numberOfIndexes)
 {
+  DSPStatsScope scope(_stats, StatsDemux);
   uint8_t i = 0;
 
   // Load leading zeros
@@ -143,6 +382,7 @@ void SigmaDSP::demux(uint16_t startMemoryAddress, uint8_t index, uint8_t numberO
  */
 void SigmaDSP::gain(uint16_t startMemoryAddress, float gain, uint8_t channels)
 {
+  DSPStatsScope scope(_stats, StatsGain);
   for(uint8_t i = 0; i < channels - 1; i++)
     safeload_writeRegister(startMemoryAddress++, gain, false);
 
@@ -160,6 +400,7 @@ void SigmaDSP::gain(uint16_t startMemoryAddress, float gain, uint8_t channels)
  */
 void SigmaDSP::gain(uint16_t startMemoryAddress, int32_t gain, uint8_t channels)
 {
+  DSPStatsScope scope(_stats, StatsGain);
 
   int32_t value = (gain * ((int32_t)1 << 23));
 
@@ -181,6 +422,7 @@ void SigmaDSP::gain(uint16_t startMemoryAddress, int32_t gain, uint8_t channels)
  */
 void SigmaDSP::volume_slew(uint16_t startMemoryAddress, float dB, uint8_t slew)
 {
+  DSPStatsScope scope(_stats, StatsVolume);
   float volume = pow(10, dB / 20); // 10^(dB / 20)
   int32_t slewrate = 0x400000 / (1 << (slew - 1)); // 0x400000/2^(slew - 1))
 
@@ -199,6 +441,7 @@ void SigmaDSP::volume_slew(uint16_t startMemoryAddress, float dB, uint8_t slew)
  */
 void SigmaDSP::volume(uint16_t startMemoryAddress, float dB)
 {
+  DSPStatsScope scope(_stats, StatsVolume);
   float volume = pow(10, dB / 20); // 10^(dB / 20)
 
   safeload_write(startMemoryAddress, volume);
@@ -214,6 +457,7 @@ void SigmaDSP::volume(uint16_t startMemoryAddress, float dB)
  */
 void SigmaDSP::mute(uint16_t startMemoryAddress, bool state)
 {
+  DSPStatsScope scope(_stats, StatsMute);
   safeload_write(startMemoryAddress, state ? 0x800000 : 0);
 }
 
@@ -227,6 +471,7 @@ void SigmaDSP::mute(uint16_t startMemoryAddress, bool state)
  */
  void SigmaDSP::dcSource(uint16_t startMemoryAddress, uint32_t value)
  {
+   DSPStatsScope scope(_stats, StatsDcSource);
    safeload_write(startMemoryAddress, value);
  }
 
@@ -242,7 +487,9 @@ void SigmaDSP::mute(uint16_t startMemoryAddress, bool state)
  */
 void SigmaDSP::dynamicBass(uint16_t startMemoryAddress, float dB)
 {
-  float boost = pow(10, -dB / 20); // 10^(-dB / 20)
+  DSPStatsScope scope(_stats, StatsDynamicBass);
+  dspCoefficient_t boost;
+  dspDecibelsToLinear(-dB, boost); // 10^(-dB / 20)
 
   // Set boost (8th memory address in this algorithm)
   safeload_write(startMemoryAddress + 8, boost);
@@ -260,25 +507,23 @@ void SigmaDSP::dynamicBass(uint16_t startMemoryAddress, float dB)
  */
 void SigmaDSP::dynamicBass(uint16_t startMemoryAddress, float dB, uint16_t frequency)
 {
-  // Formula found here: https://ez.analog.com/dsp/sigmadsp/f/q-a/65338/dynamic-bass-boost-basics
-  float omega       = 2 * pi * ((frequency * 3) / FS);
-  float alpha       = sin(omega)/(2 * 0.707);
-  float a0          = 1 + alpha;
-  float gain_lin    = 1.00;
-
-  float freq_varq   = 2 * pi * (frequency / FS);
-  float iir_coeff_0 = (1 - cos(omega)) * gain_lin / (2 * a0);
-  float iir_coeff_1 = (1 - cos(omega)) * gain_lin / a0;
-  float iir_coeff_2 = (1 - cos(omega)) * gain_lin / (2 * a0);
-  float iir_coeff_3 = (2 / a0) * cos(omega);
-  float iir_coeff_4 = (alpha - 1) / a0;
-  // Boost are independent from the frequency and iir coefficients
-  float boost       = pow(10, -dB / 20);
+  DSPStatsScope scope(_stats, StatsDynamicBass);
+  int32_t words[DYNAMIC_BASS_WORDS];
+  dspCacheKey_t key = { 0, 0 };
+  if(_cache != nullptr)
+    key = DSPCache::dynamicBassKey(dB, frequency, FS);
+  if(!cache_lookup(key, words, DYNAMIC_BASS_WORDS))
+  {
+    dspCoefficient_t parameters[DYNAMIC_BASS_WORDS];
+    dspDynamicBass(dB, frequency, FS, parameters);
+    coefficient_words(parameters, words, DYNAMIC_BASS_WORDS);
+    cache_store(key, words, DYNAMIC_BASS_WORDS);
+  }
 
   // Set frequency
-  safeload_write(startMemoryAddress, freq_varq, iir_coeff_0, iir_coeff_1, iir_coeff_2, iir_coeff_3, iir_coeff_4);
+  safeload_write(startMemoryAddress, words[0], words[1], words[2], words[3], words[4], words[5]);
   // Set boost (8th memory address in this algorithm)
-  safeload_write(startMemoryAddress + 8, boost);
+  safeload_write(startMemoryAddress + 8, words[6]);
 }
 
 
@@ -295,13 +540,23 @@ void SigmaDSP::dynamicBass(uint16_t startMemoryAddress, float dB, uint16_t frequ
  */
 void SigmaDSP::dynamicBass(uint16_t startMemoryAddress, float dB, uint16_t frequency, int16_t threshold, uint16_t time_constant)
 {
-  float tc = 1000 / (time_constant * FS);
-  float th = exp(0.029 * threshold);
+  DSPStatsScope scope(_stats, StatsDynamicBass);
+  int32_t words[2];
+  dspCacheKey_t key = { 0, 0 };
+  if(_cache != nullptr)
+    key = DSPCache::detectorKey(threshold, time_constant, FS);
+  if(!cache_lookup(key, words, 2))
+  {
+    dspCoefficient_t detector[2];
+    dspDynamicBassDetector(threshold, time_constant, FS, detector);
+    coefficient_words(detector, words, 2);
+    cache_store(key, words, 2);
+  }
 
   // Set frequency and boost
   dynamicBass(startMemoryAddress, dB, frequency);
   // Set threshold and time constant
-  safeload_write(startMemoryAddress + 6, tc, th);
+  safeload_write(startMemoryAddress + 6, words[0], words[1]);
 }
 
 
@@ -316,6 +571,7 @@ void SigmaDSP::dynamicBass(uint16_t startMemoryAddress, float dB, uint16_t frequ
  */
 void SigmaDSP::hardClip(uint16_t startMemoryAddress, float highThreshold, float lowThreshold)
 {
+  DSPStatsScope scope(_stats, StatsHardClip);
   safeload_write(startMemoryAddress, highThreshold, lowThreshold);
 }
 
@@ -330,6 +586,7 @@ void SigmaDSP::hardClip(uint16_t startMemoryAddress, float highThreshold, float
  */
 void SigmaDSP::softClip(uint16_t startMemoryAddress, float alpha)
 {
+  DSPStatsScope scope(_stats, StatsSoftClip);
   const float oneThird = 0.333;
   const float twoThird = 0.666;
 
@@ -347,6 +604,7 @@ void SigmaDSP::softClip(uint16_t startMemoryAddress, float alpha)
  */
 void SigmaDSP::dcSource(uint16_t startMemoryAddress, float level)
 {
+  DSPStatsScope scope(_stats, StatsDcSource);
   safeload_write(startMemoryAddress, level);
 }
 
@@ -361,6 +619,7 @@ void SigmaDSP::dcSource(uint16_t startMemoryAddress, float level)
  */
 void SigmaDSP::sineSource(uint16_t startMemoryAddress, float frequency)
 {
+  DSPStatsScope scope(_stats, StatsSineSource);
   float value = (1.00/24000.00)*frequency;
 
   safeload_write(startMemoryAddress, 0xff, value, 0x800000);
@@ -376,6 +635,7 @@ void SigmaDSP::sineSource(uint16_t startMemoryAddress, float frequency)
  */
 void SigmaDSP::sineSource(uint16_t startMemoryAddress, int32_t frequency)
 {
+  DSPStatsScope scope(_stats, StatsSineSource);
   // Multiply frequency by 349.5234375 (ideally 349.525333333)
   int32_t value = (frequency << 9) - (frequency << 7) - (frequency << 5) - (frequency << 1) - (frequency >> 1) + (frequency >> 5) - (frequency >> 7);
 
@@ -391,7 +651,7 @@ void SigmaDSP::sineSource(uint16_t startMemoryAddress, int32_t frequency)
  * @param startMemoryAddress DSP memory address
  * @param frequency Square wave frequency in [Hz]
  */
-void SigmaDSP::squareSource(uint16_t startMemoryAddress, float frequency) { sineSource(startMemoryAddress, frequency); }
+void SigmaDSP::squareSource(uint16_t startMemoryAddress, float frequency) { DSPStatsScope scope(_stats, StatsSquareSource); sineSource(startMemoryAddress, frequency); }
 
 
 /**
@@ -402,7 +662,7 @@ void SigmaDSP::squareSource(uint16_t startMemoryAddress, float frequency) { sine
  * @param startMemoryAddress DSP memory address
  * @param frequency Square wave frequency in [Hz]
  */
-void SigmaDSP::squareSource(uint16_t startMemoryAddress, int32_t frequency) { sineSource(startMemoryAddress, frequency); }
+void SigmaDSP::squareSource(uint16_t startMemoryAddress, int32_t frequency) { DSPStatsScope scope(_stats, StatsSquareSource); sineSource(startMemoryAddress, frequency); }
 
 
 /**
@@ -415,6 +675,7 @@ void SigmaDSP::squareSource(uint16_t startMemoryAddress, int32_t frequency) { si
  */
 void SigmaDSP::sawtoothSource(uint16_t startMemoryAddress, float frequency)
 {
+  DSPStatsScope scope(_stats, StatsSawtoothSource);
   float value = (0.50/24000.00)*frequency;
 
   safeload_write(startMemoryAddress, value, 0x800000);
@@ -431,6 +692,7 @@ void SigmaDSP::sawtoothSource(uint16_t startMemoryAddress, float frequency)
  */
 void SigmaDSP::sawtoothSource(uint16_t startMemoryAddress, int32_t frequency)
 {
+  DSPStatsScope scope(_stats, StatsSawtoothSource);
   // Multiply frequency by 174.75 (ideally 174.762666667)
   int32_t value = (frequency << 8) - (frequency << 6) - (frequency << 4) - frequency - (frequency >> 1) + (frequency >> 2);
 
@@ -448,6 +710,7 @@ void SigmaDSP::sawtoothSource(uint16_t startMemoryAddress, int32_t frequency)
  */
 void SigmaDSP::triangleSource(uint16_t startMemoryAddress, float frequency)
 {
+  DSPStatsScope scope(_stats, StatsTriangleSource);
   float value = (0.50/24000.00)*frequency;
 
   safeload_write(startMemoryAddress, 0x00, 0x800000, 0x00, -0x800000, 0x03, value, 0x800000);
@@ -464,6 +727,7 @@ void SigmaDSP::triangleSource(uint16_t startMemoryAddress, float frequency)
  */
 void SigmaDSP::triangleSource(uint16_t startMemoryAddress, int32_t frequency)
 {
+  DSPStatsScope scope(_stats, StatsTriangleSource);
   // Multiply frequency by 174.75 (ideally 174.762666667)
   int32_t value = (frequency << 8) - (frequency << 6) - (frequency << 4) - frequency - (frequency >> 1) + (frequency >> 2);
 
@@ -495,6 +759,7 @@ void SigmaDSP::triangleSource(uint16_t startMemoryAddress, int32_t frequency)
  */
 void SigmaDSP::audioDelay(uint16_t startMemoryAddress, float delayMs)
 {
+  DSPStatsScope scope(_stats, StatsAudioDelay);
   int32_t ticks = (int32_t)(delayMs*0.001/(1/FS));
 
   if(ticks > 2048)
@@ -514,54 +779,24 @@ void SigmaDSP::audioDelay(uint16_t startMemoryAddress, float delayMs)
  */
 void SigmaDSP::EQfirstOrder(uint16_t startMemoryAddress, firstOrderEQ_t &equalizer)
 {
-  float w0, gainLinear;
-  float b0, b1, a1;
-  float coefficients[3];
-
-  w0=2*PI*equalizer.freq/FS; //2*PI*freq/FS
-  gainLinear = pow(10,(equalizer.gain/20)); //10^(gain/20)
-
-  switch(equalizer.filterType)
-  {
-// Lowpass
-    case parameters::filterType::lowpass:
-    default:
-      a1 = pow(2.7,-w0);
-      b0 = gainLinear * (1.0 - a1);
-      b1 = 0;
-      break;
-
-// Highpass
-    case parameters::filterType::highpass:
-      a1 = pow(2.7,-w0);
-      b0 = gainLinear * a1;
-      b1 = -a1 * gainLinear;
-      break;
-  }
-
-  if(equalizer.state == parameters::state::on)
-  {
-    if(equalizer.phase == parameters::phase::nonInverted) // 0 deg
-    {
-      coefficients[0] = b0;
-      coefficients[1] = b1;
-      coefficients[2] = a1;
-    }
-    else //if(equalizer.phase == parameters::phase::inverted) // 180 deg
-    {
-      coefficients[0] = -1*b0;
-      coefficients[1] = -1*b1;
-      coefficients[2] = a1; // This coefficient does not change sign
-    }
-  }
-  else //if(equalizer.state == parameters::state::off)
+  DSPStatsScope scope(_stats, StatsEQfirstOrder);
+  int32_t words[3];
+  dspCacheKey_t key = { 0, 0 };
+  if(_cache != nullptr)
+    key = DSPCache::key(equalizer, FS);
+  if(!cache_lookup(key, words, 3))
   {
-    coefficients[0] = 1.00;
-    coefficients[1] = 0.00;
-    coefficients[2] = 0.00;
+    dspCoefficient_t coefficients[3];
+#ifdef SIGMADSP_FAST_MATH
+    dspFirstOrderEQFast(equalizer, FS, coefficients);
+#else
+    dspFirstOrderEQ(equalizer, FS, coefficients);
+#endif
+    coefficient_words(coefficients, words, 3);
+    cache_store(key, words, 3);
   }
 
-  safeload_write(startMemoryAddress, coefficients[0], coefficients[1], coefficients[2]);
+  safeload_write(startMemoryAddress, words[0], words[1], words[2]);
 }
 
 
@@ -575,172 +810,24 @@ void SigmaDSP::EQfirstOrder(uint16_t startMemoryAddress, firstOrderEQ_t &equaliz
  */
 void SigmaDSP::EQsecondOrder(uint16_t startMemoryAddress, secondOrderEQ_t &equalizer)
 {
-  float A, w0, alpha, gainLinear;
-  float b0, b1, b2, a0, a1, a2;
-  float coefficients[5];
-
-  A=pow(10,(equalizer.boost/40));           // 10^(boost/40)
-  w0=2*PI*equalizer.freq/FS;                // 2*PI*freq/FS
-  gainLinear = pow(10,(equalizer.gain/20)); // 10^(gain/20)
-
-  switch(equalizer.filterType)
-  {
-// Parametric
-    case parameters::filterType::parametric:
-// Peaking
-    case parameters::filterType::peaking:
-    default:
-      alpha = sin(w0)/(2*equalizer.Q);
-      a0 =  1 + alpha/A;
-      a1 = -2 * cos(w0);
-      a2 =  1 - alpha/A;
-      b0 = (1 + alpha*A) * gainLinear;
-      b1 = -(2 * cos(w0)) * gainLinear;
-      b2 = (1 - alpha*A) * gainLinear;
-      break;
-
-// Low shelf
-    case parameters::filterType::lowShelf:
-      alpha=sin(w0)/2*sqrt((A+1/A)*(1/equalizer.S-1)+2);
-      a0 = (A+1)+(A-1)*cos(w0)+2*sqrt(A)*alpha;
-      a1 = -2*((A-1)+(A+1)*cos(w0));
-      a2 = (A+1)+(A-1)*cos(w0)-2*sqrt(A)*alpha;
-      b0 = A*((A+1)-(A-1)*cos(w0)+2*sqrt(A)*alpha)*gainLinear;
-      b1 = 2*A*((A-1)-(A+1)*cos(w0)) * gainLinear;
-      b2 = A*((A+1)-(A-1)*cos(w0)-2*sqrt(A)*alpha)*gainLinear;
-      break;
-
-// High shelf
-    case parameters::filterType::highShelf:
-      alpha = sin(w0)/2 * sqrt((A + 1/A)*(1/equalizer.S - 1) + 2);
-      a0 = (A+1) - (A-1)*cos(w0) + 2*sqrt(A)*alpha;
-      a1 = 2*((A-1) - (A+1)*cos(w0));
-      a2 = (A+1) - (A-1)*cos(w0) - 2*sqrt(A)*alpha;
-      b0 = A*((A+1) + (A-1)*cos(w0) + 2*sqrt(A)*alpha) * gainLinear;
-      b1 = -2*A*((A-1) + (A+1)*cos(w0)) * gainLinear;
-      b2 = A*((A+1) + (A-1)*cos(w0) - 2*sqrt(A)*alpha) * gainLinear;
-      break;
-
-// Lowpass
-    case parameters::filterType::lowpass:
-      alpha = sin(w0)/(2*equalizer.Q);
-      a0 = 1 + alpha;
-      a1 = -2*cos(w0);
-      a2 = 1 - alpha;
-      b0 = (1 - cos(w0)) * (gainLinear/2);
-      b1 = (1 - cos(w0))  * gainLinear;
-      b2 = (1 - cos(w0)) * (gainLinear/2);
-      break;
-
-// Highpass
-    case parameters::filterType::highpass:
-      alpha = sin(w0)/(2*equalizer.Q);
-      a0 = 1 + alpha;
-      a1 = -2*cos(w0);
-      a2 = 1 - alpha;
-      b0 = (1 + cos(w0)) * (gainLinear/2);
-      b1 = -(1 + cos(w0)) * gainLinear;
-      b2 = (1 + cos(w0)) * (gainLinear/2);
-      break;
-
-// Bandpass
-    case parameters::filterType::bandpass:
-      alpha = sin(w0) * sinh(log(2)/(2 * equalizer.bandwidth * w0/sin(w0)));
-      a0 = 1 + alpha;
-      a1 = -2*cos(w0);
-      a2 = 1 - alpha;
-      b0 = alpha * gainLinear;
-      b1 = 0;
-      b2 = -alpha * gainLinear;
-      break;
-
-// Bandstop
-    case parameters::filterType::bandstop:
-      alpha = sin(w0) * sinh(log(2)/(2 * equalizer.bandwidth * w0/sin(w0)));
-      a0 = 1 + alpha;
-      a1 = -2*cos(w0);
-      a2 = 1 - alpha;
-      b0 = 1 * gainLinear;
-      b1 = -2*cos(w0) * gainLinear;
-      b2 = 1 * gainLinear;
-      break;
-
-// Butterworth lowpass
-    case parameters::filterType::butterworthLowpass:
-      alpha = sin(w0) / 2.0 * 1/sqrt(2);
-      a0 = 1 + alpha;
-      a1 = -2*cos(w0);
-      a2 = 1 - alpha;
-      b0 = (1 - cos(w0)) * gainLinear / 2;
-      b1 = (1 - cos(w0)) * gainLinear;
-      b2 = (1 - cos(w0)) * gainLinear / 2;
-      break;
-
-// Butterworth highpass
-    case parameters::filterType::butterworthHighpass:
-      alpha = sin(w0) / 2.0 * 1/sqrt(2);
-      a0 = 1 + alpha;
-      a1 = -2*cos(w0);
-      a2 = 1 - alpha;
-      b0 = (1 + cos(w0)) * gainLinear / 2;
-      b1 = -(1 + cos(w0)) * gainLinear;
-      b2 = (1 + cos(w0)) * gainLinear / 2;
-      break;
-
-// Bessel lowpass
-    case parameters::filterType::besselLowpass:
-      alpha = sin(w0) / 2.0 * 1/sqrt(3) ;
-      a0 = 1 + alpha;
-      a1 = -2*cos(w0);
-      a2 = 1 - alpha;
-      b0 = (1 - cos(w0)) * gainLinear / 2;
-      b1 = (1 - cos(w0)) * gainLinear;
-      b2 = (1 - cos(w0)) * gainLinear / 2;
-      break;
-
-// Bessel highpass
-    case parameters::filterType::besselHighpass:
-      alpha = sin(w0) / 2.0 * 1/sqrt(3) ;
-      a0 = 1 + alpha;
-      a1 = -2*cos(w0);
-      a2 = 1 - alpha;
-      b0 = (1 + cos(w0)) * gainLinear / 2;
-      b1 = -(1 + cos(w0)) * gainLinear;
-      b2 = (1 + cos(w0)) * gainLinear / 2;
-      break;
-  }
-
-  // For Sigma DSP implementation we need to normalize all the coefficients respect to a0
-  // and inverting by sign a1 and a2
-  if(a0 != 0.00 && equalizer.state == parameters::state::on)
-  {
-    if(equalizer.phase == parameters::phase::nonInverted) // 0 deg
-    {
-      coefficients[0] = b0/a0;
-      coefficients[1] = b1/a0;
-      coefficients[2] = b2/a0;
-      coefficients[3] = -1*a1/a0;
-      coefficients[4] = -1*a2/a0;
-    }
-    else //if(equalizer.phase == parameters::phase::inverted) // 180 deg
-    {
-      coefficients[0] = -1*b0/a0;
-      coefficients[1] = -1*b1/a0;
-      coefficients[2] = -1*b2/a0;
-      coefficients[3] = -1*a1/a0; // This coefficient does not change sign!
-      coefficients[4] = -1*a2/a0; // This coefficient does not change sign!
-    }
-  }
-  else //if(equalizer.state == parameters::state::off)
+  DSPStatsScope scope(_stats, StatsEQsecondOrder);
+  int32_t words[5];
+  dspCacheKey_t key = { 0, 0 };
+  if(_cache != nullptr)
+    key = DSPCache::key(equalizer, FS);
+  if(!cache_lookup(key, words, 5))
   {
-    coefficients[0] = 1.00;
-    coefficients[1] = 0;
-    coefficients[2] = 0;
-    coefficients[3] = 0;
-    coefficients[4] = 0;
+    dspCoefficient_t coefficients[5];
+#ifdef SIGMADSP_FAST_MATH
+    dspSecondOrderEQFast(equalizer, FS, coefficients);
+#else
+    dspSecondOrderEQ(equalizer, FS, coefficients);
+#endif
+    coefficient_words(coefficients, words, 5);
+    cache_store(key, words, 5);
   }
 
-  safeload_write(startMemoryAddress, coefficients[0], coefficients[1], coefficients[2], coefficients[3], coefficients[4]);
+  safeload_write(startMemoryAddress, words[0], words[1], words[2], words[3], words[4]);
 }
 
 
@@ -752,69 +839,20 @@ void SigmaDSP::EQsecondOrder(uint16_t startMemoryAddress, secondOrderEQ_t &equal
  */
 void SigmaDSP::toneControl(uint16_t startMemoryAddress, toneCtrl_t &toneCtrl)
 {
-  float tb,bb,wT,wB,Knum_T,Kden_T,Knum_B,Kden_B,alpha0,beta1,alpha1,beta2,alpha2,beta3,alpha3,beta4;
-  float b0,b1,b2,a0,a1,a2;
-  float coefficients[5];
-
-  tb = pow(10, toneCtrl.boost_Treble_dB / 20.0);
-  bb = pow(10, toneCtrl.boost_Bass_dB / 20.0);
-
-  wT = tan(PI * toneCtrl.freq_Treble / FS);
-  wB = tan(PI * toneCtrl.freq_Bass / FS);
-
-  Knum_T = 2 / (1 + (1.0 / tb));
-  Kden_T = 2 / (1 + tb);
-  Knum_B = 2.0 / (1.0 + (1.0 / bb));
-  Kden_B = 2.0 / (1.0 + bb);
-
-  alpha0 = wT + Kden_T;
-  beta1 = wT + Knum_T;
-  alpha1 = wT - Kden_T;
-  beta2 = wT - Knum_T;
-
-  alpha2 = (wB*Kden_B) + 1;
-  beta3 = (wB*Knum_B) - 1;
-  alpha3 = (wB*Kden_B) - 1;
-  beta4 = (wB*Knum_B) + 1;
-
-  a0 = alpha0 * alpha2;
-  a1 = (alpha0 * alpha3) + (alpha1 * alpha2);
-  a2 = alpha1 * alpha3;
-  b0 = beta1 * beta3;
-  b1 = (beta1 * beta4) + (beta2 * beta3);
-  b2 = beta2 * beta4;
-
-  // For Sigma DSP implementation we need to normalize all the coefficients respect to a0
-  // and inverting a1 and a2 by sign
-  if(a0 != 0.00 && toneCtrl.state == parameters::state::on)
-  {
-    if(toneCtrl.phase == parameters::phase::nonInverted) // 0 deg
-    {
-      coefficients[0] = b0/a0;
-      coefficients[1] = b1/a0;
-      coefficients[2] = b2/a0;
-      coefficients[3] = -1*a1/a0;
-      coefficients[4] = -1*a2/a0;
-    }
-    else //if(toneCtrl.phase == parameters::phase::inverted) // 180 deg
-    {
-      coefficients[0] = -1*b0/a0;
-      coefficients[1] = -1*b1/a0;
-      coefficients[2] = -1*b2/a0;
-      coefficients[3] = a1/a0;
-      coefficients[4] = a2/a0;
-    }
-  }
-  else //if(toneCtrl.state == parameters::state::off)
+  DSPStatsScope scope(_stats, StatsToneControl);
+  int32_t words[5];
+  dspCacheKey_t key = { 0, 0 };
+  if(_cache != nullptr)
+    key = DSPCache::key(toneCtrl, FS);
+  if(!cache_lookup(key, words, 5))
   {
-    coefficients[0] = 1.00;
-    coefficients[1] = 0;
-    coefficients[2] = 0;
-    coefficients[3] = 0;
-    coefficients[4] = 0;
+    dspCoefficient_t coefficients[5];
+    dspToneControl(toneCtrl, FS, coefficients);
+    coefficient_words(coefficients, words, 5);
+    cache_store(key, words, 5);
   }
 
-  safeload_write(startMemoryAddress, coefficients[0], coefficients[1], coefficients[2], coefficients[3], coefficients[4]);
+  safeload_write(startMemoryAddress, words[0], words[1], words[2], words[3], words[4]);
 }
 
 
@@ -827,6 +865,7 @@ void SigmaDSP::toneControl(uint16_t startMemoryAddress, toneCtrl_t &toneCtrl)
  */
 void SigmaDSP::stateVariable(uint16_t startMemoryAddress, float frequency, float q)
 {
+  DSPStatsScope scope(_stats, StatsStateVariable);
   float param1 = 2*sin(PI*frequency/FS);
   float param2 = 1/q;
 
@@ -845,78 +884,15 @@ void SigmaDSP::stateVariable(uint16_t startMemoryAddress, float frequency, float
  */
 void SigmaDSP::compressorRMS(uint16_t startMemoryAddress, compressor_t &compressor)
 {
-  uint8_t i;
-  uint8_t count;
-
-  float curve[34];
-  float x[34];
-  float y[34];
-  float delta = 0.00;
-  float coeff = 0.00;
-
-  float dbps = 0.00;
-  float attack_par = 0.00;
-  float hold_par = 0.00;
-  float decay_par = 0.00;
-  float postgain_par = 0.00;
-
-  linspace(-90, 6, 34, x);
-
-  count = 0;
-
-  coeff = 1/compressor.ratio;
-  for(i = 0; i < 34; i++) // This algorithm creates the curve with 1 1 1 1 1 1 1 0.9 0.8 0.72 0.64 and so on coefficients
-  {
-    if(x[i] >= compressor.threshold)
-    {
-      count++;
-      if(count == 1)
-        delta = x[i]*coeff-x[i]*1;
-      y[i] = (x[i] * coeff)-delta;
-    }
-    else
-      y[i] = x[i] * 1;
-  }
-
-  for(i = 0; i < 34; i++)  // Coefficients of the curve calculation
-    curve[i] = (pow(10, y[i]/20)) / (pow(10, x[i]/20));  // Coefficients are the ratio between the linearized values of vect. y and x
-
-  // Create buffer to store converted data
-  uint8_t storeData[5];
-
-  // Parameter load into Sigma DSP
-  for(i = 0; i < 34; i++)
-  {
-    floatToFixed(curve[i], storeData);
-    safeload_writeRegister(startMemoryAddress++, storeData, false);
-  }
-
-  // Conversion dBps -> ms
-  // dBps = 121;
-  // TCms = (20/(dBps*2.3))*1000
-
-  // RMS TC (dB/s)
-  dbps = (20/(compressor.rms_tc*2.3))*1e3;
-  attack_par = abs(1.0 - pow(10,(dbps/(10*FS))));
-  floatToFixed(attack_par, storeData);
-  safeload_writeRegister(startMemoryAddress++, storeData, true);
-
-  //#ifdef COMPRESSORWITHPOSTGAIN
-    postgain_par = pow(10, compressor.postgain/20);
-    floatToFixed(postgain_par, storeData);
-    safeload_writeRegister(startMemoryAddress++, storeData, true);
-  //#endif
-
-  // Hold
-  hold_par = compressor.hold*FS/1000;
-  floatToFixed(hold_par, storeData);
-  safeload_writeRegister(startMemoryAddress++, storeData, true);
-
-  // Decay (dB/s)
-  dbps = (20/(compressor.decay*2.3))*1e3;
-  decay_par = dbps/(96*FS);
-  floatToFixed(decay_par, storeData);
-  safeload_writeRegister(startMemoryAddress, storeData, true);
+  DSPStatsScope scope(_stats, StatsCompressorRMS);
+  dspCoefficient_t parameters[COMPRESSOR_RMS_WORDS];
+  dspCompressorRMS(compressor, FS, parameters);
+
+  // Parameter load into Sigma DSP. The 38 words may be written directly, see setBulkPolicy()
+  bulk_begin(COMPRESSOR_RMS_WORDS);
+  for(uint8_t i = 0; i < COMPRESSOR_RMS_WORDS; i++)
+    safeload_writeRegister(startMemoryAddress++, parameters[i], i >= 34);
+  bulk_end();
 }
 
 
@@ -931,67 +907,112 @@ void SigmaDSP::compressorRMS(uint16_t startMemoryAddress, compressor_t &compress
  */
 void SigmaDSP::compressorPeak(uint16_t startMemoryAddress, compressor_t &compressor)
 {
-  uint8_t i;
-  uint8_t count;
+  DSPStatsScope scope(_stats, StatsCompressorPeak);
+  dspCoefficient_t parameters[COMPRESSOR_PEAK_WORDS];
+  dspCompressorPeak(compressor, FS, parameters);
+
+  // Parameter load into Sigma DSP. The 36 words may be written directly, see setBulkPolicy()
+  bulk_begin(COMPRESSOR_PEAK_WORDS);
+  for(uint8_t i = 0; i < COMPRESSOR_PEAK_WORDS; i++)
+    safeload_writeRegister(startMemoryAddress++, parameters[i], i >= 33);
+  bulk_end();
+}
 
-  float curve[33];
-  float x[33];
-  float y[33];
-  float delta = 0.00;
-  float coeff = 0.00;
 
-  float dbps = 0.00;
-  float hold_par = 0.00;
-  float decay_par = 0.00;
-  float postgain_par = 0.00;
+/**
+ * @brief Loads precalculated parameters into an RMS compressor block,
+ *        e.g. from dspConstCompressorRMS()
+ *
+ * @param startMemoryAddress DSP memory address
+ * @param parameters The 38 5.23 parameter words
+ */
+void SigmaDSP::compressorRMS(uint16_t startMemoryAddress, const dspCompressorRMSWords_t &parameters)
+{
+  DSPStatsScope scope(_stats, StatsCompressorRMS);
+  bulk_begin(COMPRESSOR_RMS_WORDS);
+  for(uint8_t i = 0; i < COMPRESSOR_RMS_WORDS; i++)
+    safeload_writeRegister(startMemoryAddress++, parameters.words[i], i >= 34);
+  bulk_end();
+}
+
 
-  linspace(-90, 6, 33, x);
+/**
+ * @brief Loads precalculated parameters into a peak compressor block,
+ *        e.g. from dspConstCompressorPeak()
+ *
+ * @param startMemoryAddress DSP memory address
+ * @param parameters The 36 5.23 parameter words
+ */
+void SigmaDSP::compressorPeak(uint16_t startMemoryAddress, const dspCompressorPeakWords_t &parameters)
+{
+  DSPStatsScope scope(_stats, StatsCompressorPeak);
+  bulk_begin(COMPRESSOR_PEAK_WORDS);
+  for(uint8_t i = 0; i < COMPRESSOR_PEAK_WORDS; i++)
+    safeload_writeRegister(startMemoryAddress++, parameters.words[i], i >= 33);
+  bulk_end();
+}
 
-  count = 0;
 
-  coeff = 1/compressor.ratio;
-  for(i = 0; i < 33; i++) // This algorithm creates the curve with 1 1 1 1 1 1 1 0.9 0.8 0.72 0.64 and so on coefficients
-  {
-    if(x[i] >= compressor.threshold)
-    {
-      count++;
-      if(count == 1)
-        delta = x[i]*coeff-x[i]*1;
-      y[i] = (x[i] * coeff)-delta;
-    }
-    else
-      y[i] = x[i] * 1;
-  }
+/**
+ * @brief Loads precalculated parameters stored in PROGMEM into an RMS compressor block,
+ *        e.g. a constexpr dspConstCompressorRMS() result. Unlike the reference
+ *        version, the words are never copied to RAM
+ *
+ * @param startMemoryAddress DSP memory address
+ * @param parameters PROGMEM pointer to the 38 5.23 parameter words
+ */
+void SigmaDSP::compressorRMS(uint16_t startMemoryAddress, const dspCompressorRMSWords_t *parameters)
+{
+  DSPStatsScope scope(_stats, StatsCompressorRMS);
+  bulk_begin(COMPRESSOR_RMS_WORDS);
+  for(uint8_t i = 0; i < COMPRESSOR_RMS_WORDS; i++)
+    safeload_writeRegister(startMemoryAddress++, (int32_t)pgm_read_dword(&parameters->words[i]), i >= 34);
+  bulk_end();
+}
 
-  for(i = 0; i < 33; i++)  // Coefficients of the curve calculation
-    curve[i] = (pow(10, y[i]/20)) / (pow(10, x[i]/20));  // Coefficients are the ratio between the linearized values of vect. y and x
 
-  // Create buffer to store converted data
-  uint8_t storeData[5];
+/**
+ * @brief Loads precalculated parameters stored in PROGMEM into a peak compressor block,
+ *        e.g. a constexpr dspConstCompressorPeak() result. Unlike the reference
+ *        version, the words are never copied to RAM
+ *
+ * @param startMemoryAddress DSP memory address
+ * @param parameters PROGMEM pointer to the 36 5.23 parameter words
+ */
+void SigmaDSP::compressorPeak(uint16_t startMemoryAddress, const dspCompressorPeakWords_t *parameters)
+{
+  DSPStatsScope scope(_stats, StatsCompressorPeak);
+  bulk_begin(COMPRESSOR_PEAK_WORDS);
+  for(uint8_t i = 0; i < COMPRESSOR_PEAK_WORDS; i++)
+    safeload_writeRegister(startMemoryAddress++, (int32_t)pgm_read_dword(&parameters->words[i]), i >= 33);
+  bulk_end();
+}
 
-  // Parameter load into Sigma DSP
-  for(i = 0; i < 33; i++)
-  {
-    floatToFixed(curve[i], storeData);
-    safeload_writeRegister(startMemoryAddress++, storeData, false);
-  }
 
- // #ifdef COMPRESSORWITHPOSTGAIN
-    postgain_par = pow(10, compressor.postgain/40);
-    floatToFixed(postgain_par, storeData);
-    safeload_writeRegister(startMemoryAddress++, storeData, true);
-  //#endif
+/**
+ * @brief Sets one band of a graphic EQ to a precalculated gain step.
+ *        No filter math is done, the five words are read from the PROGMEM table
+ *        passed to setGraphicEQTable() and written in a single safeload.
+ *        The words match EQsecondOrder() for the same peaking filter in the default build.
+ *        With SIGMADSP_FAST_MATH or SIGMADSP_FIXED_POINT_COEFFICIENTS they differ by a few LSBs
+ *
+ * @param startMemoryAddress DSP memory address of the first band, MOD_[EQ]_ALG0_STAGE0_B0_ADDR.
+ *        The bands of a SigmaStudio multi-band EQ follow each other, five words apart
+ * @param band Band to set, 0 to GRAPHIC_EQ_BANDS - 1
+ * @param gainStep Gain step to use, 0 to GRAPHIC_EQ_STEPS - 1. GRAPHIC_EQ_FLAT_STEP is 0dB
+ */
+void SigmaDSP::graphicEQ(uint16_t startMemoryAddress, uint8_t band, uint8_t gainStep)
+{
+  DSPStatsScope scope(_stats, StatsGraphicEQ);
+  if(_graphicEQTable == nullptr || band >= _graphicEQBands || gainStep >= _graphicEQSteps)
+    return;
 
-  // Hold
-  hold_par = compressor.hold*FS/1000;
-  floatToFixed(hold_par, storeData);
-  safeload_writeRegister(startMemoryAddress++, storeData, true);
+  const int32_t *entry = &_graphicEQTable[((uint16_t)band * _graphicEQSteps + gainStep) * 5];
+  int32_t words[5];
+  for(uint8_t i = 0; i < 5; i++)
+    words[i] = (int32_t)pgm_read_dword(&entry[i]);
 
-  // Decay (dB/s)
-  dbps = (20/(compressor.decay*2.3))*1e3;
-  decay_par = dbps/(96*FS);
-  floatToFixed(decay_par, storeData);
-  safeload_writeRegister(startMemoryAddress, storeData, true);
+  safeload_write(startMemoryAddress + band * 5, words[0], words[1], words[2], words[3], words[4]);
 }
 
 
@@ -1002,6 +1023,7 @@ void SigmaDSP::compressorPeak(uint16_t startMemoryAddress, compressor_t &compres
  */
 void SigmaDSP::muteADC(bool mute)
 {
+  DSPStatsScope scope(_stats, StatsMuteADC);
   // Read two bytes from the DSP core register
   uint16_t coreRegister = readRegister(dspRegister::CoreRegister, 2);
 
@@ -1026,6 +1048,7 @@ void SigmaDSP::muteADC(bool mute)
  */
 void SigmaDSP::muteDAC(bool mute)
 {
+  DSPStatsScope scope(_stats, StatsMuteDAC);
   // Read two bytes from the DSP core register
   uint16_t coreRegister = readRegister(dspRegister::CoreRegister, 2);
 
@@ -1044,70 +1067,163 @@ void SigmaDSP::muteDAC(bool mute)
 
 
 /**
- * @brief Writes 5 bytes of data to the parameter memory of the DSP. The first byte is 0x00
- *
- * @param memoryAddress DSP memory address
- * @param data Data array to write
- * @param finished Indicates if this is the last packet or not
+ * @brief Starts collecting safeload writes instead of sending them right away.
+ *        Writes from any DSP function are deduplicated per address and kept sorted
+ *        until commit() is called. Calls can be nested; only the outermost commit() flushes
  */
-void SigmaDSP::safeload_writeRegister(uint16_t memoryAddress, uint8_t *data, bool finished)
+void SigmaDSP::beginUpdate()
 {
-  static uint8_t _safeload_count = 0; // Keeps track of the safeload count
+  _updateDepth++;
+}
 
-  uint8_t addr[2]; // Address array
 
-  addr[0] = (memoryAddress >> 8) & 0xFF;
-  addr[1] = memoryAddress & 0xFF;
+/**
+ * @brief Sends all writes collected since beginUpdate() in as few safeload groups as possible.
+ *        Words written by the same DSP function call are kept in the same group when they fit,
+ *        so a filter never runs with half of its coefficients updated
+ */
+void SigmaDSP::commit()
+{
+  DSPStatsScope scope(_stats, StatsCommit);
+  if(_updateDepth == 0)
+    return;
 
-  writeRegister(dspRegister::SafeloadAddress0 + _safeload_count, sizeof(addr), addr); // Place passed 16-bit memory address in safeload address area
+  _updateDepth--;
+  if(_updateDepth == 0)
+    update_flush();
+}
 
-  // Q: Why is the safeload registers five bytes long, while I'm loading four-byte parameters into the RAM using these registers?
-  // A: The safeload registers are also used to load the slew RAM data, which is five bytes long. For parameter RAM writes using safeload,
-  // the first byte of the safeload register can be set to 0x00.
 
-  // Needs 5 bytes of data
-  writeRegister(dspRegister::SafeloadData0 + _safeload_count, 5, data); // Placed passed data (5 bytes) in the next safeload data space
+/**
+ * @brief Sets how large parameter blocks (compressor curves, FIR and lookup tables) are written.
+ *        Safeload moves five words per transfer and waits one sample period between transfers,
+ *        while a direct write bursts the whole block into the parameter RAM. Blocks of at least
+ *        threshold words are written directly, smaller ones still use safeload.
+ *        Safeload is always used between beginUpdate() and commit() and when an update queue is attached
+ *
+ * @param policy BulkOff, BulkDirect, BulkMuteDAC or BulkMuteBlock
+ * @param threshold Min number of words for a direct write (optional parameter)
+ * @param muteAddress Address of the mute block to use with BulkMuteBlock (optional parameter)
+ */
+void SigmaDSP::setBulkPolicy(dspBulkPolicy policy, uint8_t threshold, uint16_t muteAddress)
+{
+  _bulkPolicy = policy;
+  _bulkThreshold = threshold;
+  _bulkMuteAddress = muteAddress;
+}
 
-  _safeload_count++; // Increase counter
 
-  if(finished == true || _safeload_count >= 5) // Max 5 safeload memory registers
-  {
-    addr[0] = 0x00;
-    addr[1] = 0x3C; // Set the IST bit (initiate safeload transfer bit)
-    writeRegister(dspRegister::CoreRegister, sizeof(addr), addr); // Load content from the safeload registers
-    _safeload_count = 0;
-  }
+/**
+ * @brief Writes a block of 5.23 parameters to consecutive parameter RAM addresses,
+ *        through safeload or directly depending on the policy set by setBulkPolicy()
+ *
+ * @param startMemoryAddress DSP memory address of the first parameter
+ * @param values Array of parameters to write
+ * @param count Number of parameters in the array
+ */
+void SigmaDSP::writeParameterBlock(uint16_t startMemoryAddress, const float *values, uint16_t count)
+{
+  DSPStatsScope scope(_stats, StatsWriteParameterBlock);
+  bulk_begin(count);
+  for(uint16_t i = 0; i < count; i++)
+    safeload_writeRegister(startMemoryAddress + i, values[i], i == count - 1);
+  bulk_end();
 }
 
+
 /**
- * @brief Writes 28.0 data to the parameter memory of the DSP.
+ * @brief Writes a block of 28.0 parameters to consecutive parameter RAM addresses,
+ *        through safeload or directly depending on the policy set by setBulkPolicy()
  *
- * @param memoryAddress DSP memory address
- * @param data Data array to write
- * @param finished Indicates if this is the last packet or not
+ * @param startMemoryAddress DSP memory address of the first parameter
+ * @param values Array of parameters to write
+ * @param count Number of parameters in the array
  */
-void SigmaDSP::safeload_writeRegister(uint16_t memoryAddress, int32_t data, bool finished)
+void SigmaDSP::writeParameterBlock(uint16_t startMemoryAddress, const int32_t *values, uint16_t count)
 {
-  uint8_t dataArray[5];
-  intToFixed(data, dataArray);
-  safeload_writeRegister(memoryAddress, dataArray, finished);
+  DSPStatsScope scope(_stats, StatsWriteParameterBlock);
+  bulk_begin(count);
+  for(uint16_t i = 0; i < count; i++)
+    safeload_writeRegister(startMemoryAddress + i, values[i], i == count - 1);
+  bulk_end();
 }
 
+
 /**
- * @brief Writes 5.23 data to the parameter memory of the DSP.
+ * @brief Writes 5 bytes of data to the parameter memory of the DSP. The first byte is 0x00
  *
  * @param memoryAddress DSP memory address
  * @param data Data array to write
  * @param finished Indicates if this is the last packet or not
  */
-void SigmaDSP::safeload_writeRegister(uint16_t memoryAddress, float data, bool finished)
+void SigmaDSP::safeload_writeRegister(uint16_t memoryAddress, uint8_t *data, bool finished)
+{
+  // Q: Why is the safeload registers five bytes long, while I'm loading four-byte parameters into the RAM using these registers?
+  // A: The safeload registers are also used to load the slew RAM data, which is five bytes long. For parameter RAM writes using safeload,
+  // the first byte of the safeload register can be set to 0x00.
+
+  // Large blocks are written straight to the parameter RAM instead
+  if(_bulkActive == true)
+  {
+    bulk_add(memoryAddress, data);
+    return;
+  }
+
+  // Drop parameter RAM words the DSP already holds
+  // Queued words are checked when they're sent instead, as they may still be replaced
+  bool unchanged = false;
+  if(_shadow != nullptr && _queue == nullptr && data[0] == 0x00)
+  {
+    uint32_t value = (uint32_t)data[1] << 24 | (uint32_t)data[2] << 16 | (uint32_t)data[3] << 8 | data[4];
+    unchanged = !_shadow->changed(memoryAddress, value);
+  }
+
+  // Collect the word if an update is in progress
+  if(_updateDepth > 0)
+  {
+    if(unchanged == false)
+      update_add(memoryAddress, data);
+    if(finished == true)
+      _updateModule++; // Next word belongs to a new DSP function call
+    return;
+  }
+
+  if(unchanged == false)
+    safeload_stage(memoryAddress, data);
+
+  if(finished == true)
+    safeload_flush();
+}
+
+/**
+ * @brief Writes 28.0 data to the parameter memory of the DSP.
+ *
+ * @param memoryAddress DSP memory address
+ * @param data Data array to write
+ * @param finished Indicates if this is the last packet or not
+ */
+void SigmaDSP::safeload_writeRegister(uint16_t memoryAddress, int32_t data, bool finished)
+{
+  uint8_t dataArray[5];
+  intToFixed(data, dataArray);
+  safeload_writeRegister(memoryAddress, dataArray, finished);
+}
+
+/**
+ * @brief Writes 5.23 data to the parameter memory of the DSP.
+ *
+ * @param memoryAddress DSP memory address
+ * @param data Data array to write
+ * @param finished Indicates if this is the last packet or not
+ */
+void SigmaDSP::safeload_writeRegister(uint16_t memoryAddress, float data, bool finished)
 {
   uint8_t dataArray[5];
   floatToFixed(data, dataArray);
   safeload_writeRegister(memoryAddress, dataArray, finished);
 }
 
-#if defined(ARDUINO_ARCH_ESP8266) || (defined(ARDUINO_ARCH_ESP32) && ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(5, 0, 0))
+#if defined(ARDUINO_ARCH_ESP8266) || (defined(ARDUINO_ARCH_ESP32) && ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(5, 0, 0)) || !defined(ARDUINO)
   void SigmaDSP::safeload_writeRegister(uint16_t memoryAddress, int16_t data, bool finished) { safeload_writeRegister(memoryAddress, (int32_t)data, finished); }
 #else
   void SigmaDSP::safeload_writeRegister(uint16_t memoryAddress,     int data, bool finished) { safeload_writeRegister(memoryAddress, (int32_t)data, finished); }
@@ -1119,7 +1235,7 @@ void SigmaDSP::safeload_writeRegister(uint16_t memoryAddress,    double data, bo
 
 
 /**
- * @brief Writes data to the DSP (max 32 bytes a time due to the default i2c buffer size of the Wire library)
+ * @brief Writes data to the DSP in a single transaction (max maxChunk() bytes, 30 bytes with the default Wire buffer)
  *
  * @param memoryAddress DSP memory address
  * @param length Number of bytes to write
@@ -1127,78 +1243,270 @@ void SigmaDSP::safeload_writeRegister(uint16_t memoryAddress,    double data, bo
  */
 void SigmaDSP::writeRegister(uint16_t memoryAddress, uint8_t length, uint8_t *data)
 {
-  uint8_t LSByte = (uint8_t)memoryAddress & 0xFF;
-  uint8_t MSByte = memoryAddress >> 8;
+  DSPStatsScope scope(_stats, StatsWriteRegister);
+  if(_shadow != nullptr && memoryAddress < PARAMETER_RAM_WORDS)
+    _shadow->invalidate(memoryAddress, length / 4);
+
+  busWrite(memoryAddress, data, length);
+}
+
 
-  _WireObject.beginTransmission(_dspAddress); // Begin write
+/**
+ * @brief Writes data to the DSP from PROGMEM in a single transaction
+ *        (max SIGMADSP_STAGING_BUFFER_SIZE bytes)
+ *
+ * @param memoryAddress DSP memory address
+ * @param length Number of bytes to write
+ * @param data Data array to write
+ */
+void SigmaDSP::writeRegister(uint16_t memoryAddress, uint8_t length, const uint8_t *data)
+{
+  DSPStatsScope scope(_stats, StatsWriteRegister);
+  uint8_t buffer[SIGMADSP_STAGING_BUFFER_SIZE];
 
-  _WireObject.write(MSByte); // Send high address
-  _WireObject.write(LSByte); // Send low address
+  if(length > sizeof(buffer))
+    length = sizeof(buffer);
 
   for(uint8_t i = 0; i < length; i++)
-    _WireObject.write(data[i]); // Send all bytes in passed array
+    buffer[i] = pgm_read_byte(&data[i]);
+
+  if(_shadow != nullptr && memoryAddress < PARAMETER_RAM_WORDS)
+    _shadow->invalidate(memoryAddress, length / 4);
 
-  _WireObject.endTransmission(); // Write out data to I2C and stop transmitting
+  busWrite(memoryAddress, buffer, length);
 }
 
 
 /**
- * @brief Writes data to the DSP from PROGMEM (max 32 bytes a time due to the default i2c buffer size of the Wire library)
+ * @brief Writes data to the DSP from PROGMEM. The DSP auto-increments the register
+ *        address in burst mode, so as many whole registers as the transport can hold
+ *        are packed into each transaction
  *
  * @param memoryAddress DSP memory address
  * @param length Number of bytes to write
  * @param data Data array to write
+ * @param registerSize Number of bytes each register can hold
  */
-void SigmaDSP::writeRegister(uint16_t memoryAddress, uint8_t length, const uint8_t *data)
+void SigmaDSP::writeRegisterBlock(uint16_t memoryAddress, uint16_t length, const uint8_t *data, uint8_t registerSize)
 {
-  uint8_t LSByte = (uint8_t)memoryAddress & 0xFF;
-  uint8_t MSByte = memoryAddress >> 8;
+  DSPStatsScope scope(_stats, StatsWriteRegisterBlock);
+  uint8_t buffer[SIGMADSP_STAGING_BUFFER_SIZE];
+  uint16_t bytesSent = 0;
 
-  _WireObject.beginTransmission(_dspAddress); // Begin write
+  // Number of whole registers that fits in one transaction
+  uint16_t chunk = busMaxChunk();
+  if(chunk > sizeof(buffer))
+    chunk = sizeof(buffer);
+  uint8_t registersPerChunk = chunk / registerSize;
+  if(registersPerChunk == 0)
+    registersPerChunk = 1;
 
-  _WireObject.write(MSByte); // Send high address
-  _WireObject.write(LSByte); // Send low address
+  // Loading the parameter defaults resets the shadow. Any other parameter RAM write invalidates it
+  if(_shadow != nullptr && memoryAddress < PARAMETER_RAM_WORDS)
+  {
+    if(memoryAddress == 0 && _shadow->isDefaults(data))
+      _shadow->begin(data, length);
+    else
+      _shadow->invalidate(memoryAddress, length / registerSize);
+  }
 
-  for(uint8_t i = 0; i < length; i++)
-    _WireObject.write(pgm_read_byte(&data[i])); // Send all bytes in passed array
+  // Run until all bytes are sent
+  while(bytesSent < length)
+  {
+    uint16_t chunkLength = 0;
+    uint8_t registers = 0;
+
+    for(; registers < registersPerChunk && bytesSent < length; registers++)
+    {
+      for(uint8_t i = 0; i < registerSize; i++) // Copy n bytes
+        buffer[chunkLength++] = pgm_read_byte(&data[bytesSent++]);
+    }
 
-  _WireObject.endTransmission(); // Write out data to I2C and stop transmitting
+    busWrite(memoryAddress, buffer, chunkLength);
+    memoryAddress += registers; // Increase address
+  }
 }
 
 
 /**
- * @brief Writes data to the DSP from PROGMEM
+ * @brief Writes data to the DSP straight from a stream (Serial, a file etc.).
+ *        Whole registers are read into a small buffer and sent in bursts,
+ *        the same way as the PROGMEM version
  *
  * @param memoryAddress DSP memory address
  * @param length Number of bytes to write
- * @param data Data array to write
+ * @param stream Stream to read the data from
  * @param registerSize Number of bytes each register can hold
+ * @param skipZeros Don't send registers that are all zero. Only valid for program
+ *        and parameter RAM right after a DSP reset, when the RAM is already cleared
+ * @return true if all bytes were read from the stream and written, false if the stream timed out
  */
-void SigmaDSP::writeRegisterBlock(uint16_t memoryAddress, uint16_t length, const uint8_t *data, uint8_t registerSize)
+bool SigmaDSP::writeRegisterBlock(uint16_t memoryAddress, uint16_t length, Stream &stream, uint8_t registerSize, bool skipZeros)
 {
-  uint8_t MSByte = 0;
-  uint8_t LSByte = 0;
+  DSPStatsScope scope(_stats, StatsWriteRegisterBlock);
+  uint8_t buffer[SIGMADSP_STAGING_BUFFER_SIZE];
   uint16_t bytesSent = 0;
 
+  // Number of whole registers that fits in one transaction
+  uint16_t chunk = busMaxChunk();
+  if(chunk > sizeof(buffer))
+    chunk = sizeof(buffer);
+  uint8_t registersPerChunk = chunk / registerSize;
+  if(registersPerChunk == 0)
+    registersPerChunk = 1;
+
+  if(_shadow != nullptr && memoryAddress < PARAMETER_RAM_WORDS)
+    _shadow->invalidate(memoryAddress, length / registerSize);
+
   // Run until all bytes are sent
   while(bytesSent < length)
   {
-    // Convert address to 8-bit
-    MSByte = memoryAddress >> 8;
-    LSByte = (uint8_t)memoryAddress & 0xFF;
-
-    _WireObject.beginTransmission(_dspAddress);
-    _WireObject.write(MSByte); // Send high address
-    _WireObject.write(LSByte); // Send low address
-    for(uint8_t i = 0; i < registerSize; i++) // Send n bytes
+    uint16_t chunkLength = registersPerChunk * registerSize;
+    if(chunkLength > length - bytesSent)
+      chunkLength = length - bytesSent;
+
+    if(stream.readBytes(buffer, chunkLength) != chunkLength)
+      return false;
+
+    // Control registers don't reset to zero, so only RAM writes are skipped
+    if(skipZeros && memoryAddress < InterfaceRegister0)
+      writeNonZeroRegisters(memoryAddress, buffer, chunkLength, registerSize);
+    else
+      busWrite(memoryAddress, buffer, chunkLength);
+    memoryAddress += chunkLength / registerSize; // Increase address
+    bytesSent += chunkLength;
+  }
+
+  return true;
+}
+
+
+/**
+ * @brief Sends a buffer of whole registers, leaving out the ones that are all zero.
+ *        Consecutive non-zero registers still go out as a single burst
+ *
+ * @param memoryAddress DSP memory address of the first register in the buffer
+ * @param data Register data
+ * @param length Number of bytes in the buffer
+ * @param registerSize Number of bytes each register can hold
+ */
+void SigmaDSP::writeNonZeroRegisters(uint16_t memoryAddress, const uint8_t *data, uint16_t length, uint8_t registerSize)
+{
+  uint16_t burstStart = 0; // First byte of the burst being collected
+
+  for(uint16_t i = 0; i < length; i += registerSize)
+  {
+    bool zero = true;
+    for(uint16_t j = i; j < i + registerSize && j < length; j++)
+      zero = zero && data[j] == 0x00;
+
+    if(zero)
     {
-      _WireObject.write(pgm_read_byte(&data[bytesSent]));
-      bytesSent++;
+      if(i > burstStart)
+        busWrite(memoryAddress + burstStart / registerSize, &data[burstStart], i - burstStart);
+      burstStart = i + registerSize;
     }
-    _WireObject.endTransmission();
+  }
+
+  if(burstStart < length)
+    busWrite(memoryAddress + burstStart / registerSize, &data[burstStart], length - burstStart);
+}
+
+
+/**
+ * @brief Loads the DSP program by replaying a self-boot image, the same
+ *        command stream the DSP reads from the EEPROM when SELFBOOT is tied high
+ *        (DSP_eeprom_firmware). Write records are sent as burst writes split on
+ *        register boundaries. The image only holds the words the program uses, so
+ *        before the first RAM write the rest of the program RAM is filled with the
+ *        word SigmaStudio pads the program with, and the rest of the parameter RAM is
+ *        zeroed unless it's known to be cleared already. The interface register
+ *        records are skipped. The DSP ends up with the same memory content as after
+ *        loading the full SigmaStudio arrays, so PROGRAM_CRC32 matches
+ *
+ * @param image PROGMEM self-boot image
+ * @param size Size of the image in bytes (EE_SIZE)
+ * @param ramCleared Set to true right after a DSP reset or power-up to skip zeroing the unused parameter RAM (optional parameter)
+ * @return true if the image was replayed up to its end record, false if it's malformed
+ */
+bool SigmaDSP::loadSelfbootImage(const uint8_t *image, uint16_t size, bool ramCleared)
+{
+  DSPStatsScope scope(_stats, StatsLoadProgram);
+
+  // Everything the shadow knows is about to be replaced
+  if(_shadow != nullptr)
+    _shadow->clear();
 
-    memoryAddress++; // Increase address
+  bool gapsFilled = false;
+  uint16_t i = 0;
+  while(i < size)
+  {
+    uint8_t command = pgm_read_byte(&image[i++]);
+
+    switch(command)
+    {
+      // Length (2 bytes), device address (1 byte), subaddress (2 bytes) and data
+      case SELFBOOT_WRITE:
+      {
+        if(i + 2 > size)
+          return false;
+        uint16_t length = (uint16_t)pgm_read_byte(&image[i]) << 8 | pgm_read_byte(&image[i + 1]);
+        i += 2;
+        if(length < 3 || i + length > size)
+          return false;
+        uint16_t address = (uint16_t)pgm_read_byte(&image[i + 1]) << 8 | pgm_read_byte(&image[i + 2]);
+
+        // The interface registers hold values passed between the DSP program and the
+        // control port at run time. Loading the program from the arrays never wrote them
+        if(address >= InterfaceRegister0 && address <= InterfaceRegister7)
+        {
+          i += length;
+          break;
+        }
+
+        // Words left over from a previous program would still be there. The image starts
+        // by writing the core control register, so the gaps are filled right after that
+        if(gapsFilled == false && address < 0x0800)
+        {
+          selfboot_clear(image, size, ramCleared);
+          gapsFilled = true;
+        }
+
+        selfboot_write(address, &image[i + 3], length - 3);
+
+        // The shadow can trust its defaults again if they point into this record
+        if(_shadow != nullptr && address == 0 && _shadow->isDefaults(&image[i + 3]))
+          _shadow->begin(&image[i + 3], length - 3);
+        i += length;
+        break;
+      }
+
+      // Delay count (2 bytes). Each count is 1024 core clock cycles, one sample period
+      case SELFBOOT_DELAY:
+      {
+        if(i + 2 > size)
+          return false;
+        uint16_t count = (uint16_t)pgm_read_byte(&image[i]) << 8 | pgm_read_byte(&image[i + 1]);
+        i += 2;
+        uint32_t us = (uint32_t)(count * (1000000 / FS)) + 1;
+        delay(us / 1000);
+        delayMicroseconds(us % 1000);
+        break;
+      }
+
+      case SELFBOOT_NOP:
+        break;
+
+      case SELFBOOT_END:
+      case SELFBOOT_END_WAIT:
+        return true;
+
+      default:
+        return false;
+    }
   }
+
+  return false;
 }
 
 
@@ -1214,29 +1522,23 @@ void SigmaDSP::writeRegisterBlock(uint16_t memoryAddress, uint16_t length, const
  */
 int32_t SigmaDSP::readBack(uint16_t memoryAddress, uint16_t readout, uint8_t numberOfBytes)
 {
-  uint8_t LSByte = (uint8_t)memoryAddress & 0xFF;
-  uint8_t MSByte = memoryAddress >> 8;
-
-  _WireObject.beginTransmission(_dspAddress); // Begin write
-  _WireObject.write(MSByte); // Send high address
-  _WireObject.write(LSByte); // Send low address
-  LSByte = (uint8_t)readout & 0xFF;
-  MSByte = readout >> 8;
-  _WireObject.write(MSByte); // Send high register to read
-  _WireObject.write(LSByte); // Send low register to read
-  _WireObject.endTransmission();
-
-  _WireObject.beginTransmission(_dspAddress);
-  LSByte = (uint8_t)memoryAddress & 0xFF;
-  MSByte = memoryAddress >> 8;
-  _WireObject.write(MSByte);
-  _WireObject.write(LSByte);
-  _WireObject.endTransmission(false);
+  DSPStatsScope scope(_stats, StatsReadBack);
+  uint8_t readoutData[2];
+  uint8_t buffer[4] = {0};
+
+  if(numberOfBytes > sizeof(buffer))
+    numberOfBytes = sizeof(buffer);
+
+  // Tell the readback block which register to capture
+  readoutData[0] = readout >> 8;   // High register to read
+  readoutData[1] = readout & 0xFF; // Low register to read
+  busWrite(memoryAddress, readoutData, sizeof(readoutData));
+
+  busRead(memoryAddress, buffer, numberOfBytes);
 
   int32_t returnVal = 0;
-  _WireObject.requestFrom(_dspAddress, numberOfBytes, (uint8_t)0);
   for(uint8_t i = 0; i < numberOfBytes; i++)
-    returnVal = returnVal << 8 | _WireObject.read();
+    returnVal = returnVal << 8 | buffer[i];
 
   return returnVal;
 }
@@ -1251,23 +1553,60 @@ int32_t SigmaDSP::readBack(uint16_t memoryAddress, uint16_t readout, uint8_t num
  */
 uint32_t SigmaDSP::readRegister(dspRegister reg, uint8_t numberOfBytes)
 {
-  uint8_t LSByte = (uint8_t)reg & 0xFF;
-  uint8_t MSByte = reg >> 8;
+  DSPStatsScope scope(_stats, StatsReadRegister);
+  uint8_t buffer[4] = {0};
+
+  if(numberOfBytes > sizeof(buffer))
+    numberOfBytes = sizeof(buffer);
 
-  _WireObject.beginTransmission(_dspAddress); // Begin write
-  _WireObject.write(MSByte); // Send high address
-  _WireObject.write(LSByte); // Send low address
-  _WireObject.endTransmission(false);
+  busRead(reg, buffer, numberOfBytes);
 
   uint32_t returnVal = 0;
-  _WireObject.requestFrom(_dspAddress, numberOfBytes);
   for(uint8_t i = 0; i < numberOfBytes; i++)
-    returnVal = returnVal << 8 | _WireObject.read();
+    returnVal = returnVal << 8 | buffer[i];
 
   return returnVal;
 }
 
 
+/**
+ * @brief Checks if the DSP already runs a program by reading the program RAM back
+ *        in bursts and comparing its CRC-32 with the expected one. When only the
+ *        microcontroller was reset, this lets you skip loadProgram() and the audible
+ *        dropout that comes with it
+ *
+ * @param crc Expected CRC-32 of the program, PROGRAM_CRC32
+ * @param length Number of program RAM bytes to check, PROGRAM_SIZE.
+ *        Pass a smaller multiple of 5 to only check the start of the program
+ * @return true if the program RAM matches
+ */
+bool SigmaDSP::verifyProgram(uint32_t crc, uint16_t length)
+{
+  DSPStatsScope scope(_stats, StatsVerifyProgram);
+  uint32_t programCrc = 0;
+  return program_read(nullptr, length, programCrc) && programCrc == crc;
+}
+
+
+/**
+ * @brief Checks if the DSP already runs a program by reading the program RAM back
+ *        in bursts and comparing it with the passed PROGMEM program.
+ *        Parameter headers generated with a self-boot image hold no program array,
+ *        use verifyProgram(PROGRAM_CRC32, PROGRAM_SIZE) with those
+ *
+ * @param program PROGMEM copy of the full program RAM content, starting at address 0x0400.
+ *        DSP_program_data in parameter headers generated without a self-boot image
+ * @param length Number of program bytes to check, PROGRAM_SIZE
+ * @return true if the program RAM matches
+ */
+bool SigmaDSP::verifyProgram(const uint8_t *program, uint16_t length)
+{
+  DSPStatsScope scope(_stats, StatsVerifyProgram);
+  uint32_t programCrc = 0;
+  return program_read(program, length, programCrc);
+}
+
+
 /**
  * @brief Converts a 5.23 float value to 5-byte HEX and stores it in the passed buffer
  *
@@ -1323,18 +1662,645 @@ int32_t SigmaDSP::floatToInt(float value)
 *******************************************************************************************/
 
 
+// Start of the staged addresses in the safeload buffer
+static const uint8_t _safeload_addrOffset = 5 * 5;
+
+
+/**
+ * @brief Writes a block of data to the DSP in a single transaction.
+ *        Every DSP write goes through here
+ *
+ * @param subAddress DSP register or memory address
+ * @param data Data array to write
+ * @param length Number of bytes to write
+ * @return uint8_t transport status code (0 = success)
+ */
+uint8_t SigmaDSP::busWrite(uint16_t subAddress, const uint8_t *data, uint16_t length)
+{
+  if(_stats == nullptr)
+    return _transport.write(_dspAddress, subAddress, data, length);
+
+  uint32_t start = micros();
+  uint8_t status = _transport.write(_dspAddress, subAddress, data, length);
+  _stats->record(length, 0, status, micros() - start);
+  return status;
+}
+
+
+/**
+ * @brief Reads a block of data from the DSP. Every DSP read goes through here
+ *
+ * @param subAddress DSP register or memory address
+ * @param data Array to store the received data in
+ * @param length Number of bytes to read
+ * @return uint8_t transport status code (0 = success)
+ */
+uint8_t SigmaDSP::busRead(uint16_t subAddress, uint8_t *data, uint16_t length)
+{
+  if(_stats == nullptr)
+    return _transport.writeRead(_dspAddress, subAddress, data, length);
+
+  uint32_t start = micros();
+  uint8_t status = _transport.writeRead(_dspAddress, subAddress, data, length);
+  _stats->record(0, length, status, micros() - start);
+  return status;
+}
+
+
 /**
- * @brief Calculates the points of a linearly spaced vector
+ * @brief Returns the max number of data bytes a single write can hold
  *
- * @param x1 Start point
- * @param x2 End point
- * @param n Number of points to calculate
- * @param vect Array to store calculated data in
+ * @return uint16_t max data bytes per transaction
  */
-void SigmaDSP::linspace(float x1, float x2, float n, float *vect)
+uint16_t SigmaDSP::busMaxChunk()
 {
-  float k = (abs(x1) + abs(x2))/(n);
+  return _transport.maxChunk();
+}
+
 
-  for(uint8_t i = 0; i < n; i++)
-    vect[i] = x1+(k*i);
+/**
+ * @brief Starts a parameter block. The following words are written directly to the
+ *        parameter RAM if the bulk policy allows it for a block of this size
+ *
+ * @param words Number of words in the block
+ */
+void SigmaDSP::bulk_begin(uint16_t words)
+{
+  if(_bulkPolicy == BulkOff || words < _bulkThreshold || _updateDepth > 0 || _queue != nullptr)
+    return;
+
+  // The burst buffer shares storage with the safeload staging area
+  safeload_flush();
+
+  _bulkActive = true;
+  _bulkMuted = false;
+  _bulkCount = 0;
+}
+
+
+/**
+ * @brief Adds a word to the burst buffer, sending the buffer first if it's full
+ *        or the word doesn't follow the buffered ones
+ *
+ * @param memoryAddress DSP memory address
+ * @param data Safeload data (5 bytes). Only the lower four go to the parameter RAM
+ */
+void SigmaDSP::bulk_add(uint16_t memoryAddress, const uint8_t *data)
+{
+  uint16_t chunk = busMaxChunk();
+  if(chunk > sizeof(_safeload_buffer))
+    chunk = sizeof(_safeload_buffer);
+
+  if(_bulkCount > 0 && (memoryAddress != _bulkAddress + _bulkCount || (_bulkCount + 1) * 4 > chunk))
+    bulk_flush();
+
+  if(_bulkCount == 0)
+  {
+    _bulkAddress = memoryAddress;
+    _bulkChanged = false;
+  }
+
+  for(uint8_t i = 0; i < 4; i++)
+    _safeload_buffer[_bulkCount * 4 + i] = data[i + 1];
+
+  // Keep the shadow up to date, and leave out bursts the DSP already holds
+  uint32_t value = (uint32_t)data[1] << 24 | (uint32_t)data[2] << 16 | (uint32_t)data[3] << 8 | data[4];
+  if(_shadow == nullptr || _shadow->changed(memoryAddress, value))
+    _bulkChanged = true;
+
+  _bulkCount++;
+}
+
+
+/**
+ * @brief Writes the burst buffer to the parameter RAM. The mute policy is applied
+ *        before the first write of a block, so a block that didn't change is never muted
+ */
+void SigmaDSP::bulk_flush()
+{
+  if(_bulkCount == 0)
+    return;
+
+  if(_bulkChanged == true)
+  {
+    if(_bulkMuted == false)
+    {
+      bulk_mute(true);
+      _bulkMuted = true;
+    }
+    // The shadow took the words for written, forget them if they didn't get there
+    if(busWrite(_bulkAddress, _safeload_buffer, _bulkCount * 4) != 0 && _shadow != nullptr)
+      _shadow->invalidate(_bulkAddress, _bulkCount);
+  }
+
+  _bulkCount = 0;
+}
+
+
+/**
+ * @brief Ends a parameter block. Sends what's left in the burst buffer and undoes the mute
+ */
+void SigmaDSP::bulk_end()
+{
+  if(_bulkActive == false)
+    return;
+
+  bulk_flush();
+  if(_bulkMuted == true)
+    bulk_mute(false);
+
+  _bulkActive = false;
+}
+
+
+/**
+ * @brief Applies or undoes the mute policy around a direct parameter block write
+ *
+ * @param mute True to mute and save the previous state, false to restore it
+ */
+void SigmaDSP::bulk_mute(bool mute)
+{
+  if(_bulkPolicy == BulkMuteDAC)
+  {
+    if(mute == true)
+    {
+      busRead(CoreRegister, _bulkRestore, 2);
+      _bulkRestore[1] &= 0xDF; // Never write the IST bit back, it would start a safeload transfer
+      uint8_t muteDACdata[2] = {_bulkRestore[0], (uint8_t)(_bulkRestore[1] & 0xF7)}; // Clear the DAC unmute bit
+      busWrite(CoreRegister, muteDACdata, sizeof(muteDACdata));
+    }
+    else
+      busWrite(CoreRegister, _bulkRestore, 2);
+  }
+
+  else if(_bulkPolicy == BulkMuteBlock)
+  {
+    if(mute == true)
+    {
+      busRead(_bulkMuteAddress, _bulkRestore, 4);
+      uint8_t muteData[4] = {0x00, 0x00, 0x00, 0x00};
+      busWrite(_bulkMuteAddress, muteData, sizeof(muteData));
+    }
+    else
+      busWrite(_bulkMuteAddress, _bulkRestore, 4);
+  }
+}
+
+
+/**
+ * @brief Reads the program RAM back in whole-word bursts
+ *
+ * @param program PROGMEM program to compare the RAM content with, or nullptr to only calculate the CRC
+ * @param length Number of program RAM bytes to read
+ * @param crc Variable to store the CRC-32 of the read bytes in
+ * @return true if all reads succeeded and the content matched the passed program
+ */
+bool SigmaDSP::program_read(const uint8_t *program, uint16_t length, uint32_t &crc)
+{
+  uint8_t buffer[SIGMADSP_STAGING_BUFFER_SIZE];
+  uint16_t address = PROGRAM_RAM_ADDR;
+  uint16_t bytesRead = 0;
+
+  // Number of whole program words that fits in one transaction
+  uint16_t chunk = busMaxChunk();
+  if(chunk > sizeof(buffer))
+    chunk = sizeof(buffer);
+  chunk -= chunk % 5;
+  if(chunk == 0)
+    chunk = 5;
+
+  crc = 0;
+  while(bytesRead < length)
+  {
+    uint16_t chunkLength = chunk;
+    if(chunkLength > length - bytesRead)
+      chunkLength = length - bytesRead;
+
+    if(busRead(address, buffer, chunkLength) != 0)
+      return false;
+
+    if(program != nullptr)
+    {
+      for(uint16_t i = 0; i < chunkLength; i++)
+      {
+        if(buffer[i] != pgm_read_byte(&program[bytesRead + i]))
+          return false;
+      }
+    }
+
+    crc = dspCrc32(crc, buffer, chunkLength);
+    address += chunkLength / 5;
+    bytesRead += chunkLength;
+  }
+
+  return true;
+}
+
+
+/**
+ * @brief Returns the width of a DSP register or memory location
+ *
+ * @param address DSP register or memory address
+ * @return uint8_t width in bytes
+ */
+uint8_t SigmaDSP::registerWidth(uint16_t address)
+{
+  if(address < 0x0400)
+    return 4; // Parameter RAM
+  if(address < 0x0800)
+    return 5; // Program RAM
+  if(address < GpioAllRegister)
+    return 4; // Interface registers
+  if(address >= SafeloadData0 && address <= SafeloadData4)
+    return 5;
+  if(address == RAMRegister || address == SerialInputRegister)
+    return 1;
+  if(address == MpCfg0 || address == MpCfg1)
+    return 3;
+  return 2;
+}
+
+
+/**
+ * @brief Writes PROGMEM data that may span several registers of different widths.
+ *        Only whole registers go into each transaction
+ *
+ * @param address DSP register or memory address
+ * @param data PROGMEM data
+ * @param length Number of bytes to write
+ */
+void SigmaDSP::selfboot_write(uint16_t address, const uint8_t *data, uint16_t length)
+{
+  uint8_t buffer[SIGMADSP_STAGING_BUFFER_SIZE];
+  uint16_t chunk = busMaxChunk();
+  if(chunk > sizeof(buffer))
+    chunk = sizeof(buffer);
+
+  uint16_t bytesSent = 0;
+  while(bytesSent < length)
+  {
+    uint16_t chunkLength = 0;
+    uint16_t nextAddress = address;
+
+    // Pack whole registers until the next one doesn't fit
+    while(bytesSent + chunkLength < length)
+    {
+      uint8_t width = registerWidth(nextAddress);
+      if(chunkLength > 0 && chunkLength + width > chunk)
+        break;
+      for(uint8_t i = 0; i < width && bytesSent + chunkLength < length; i++)
+      {
+        buffer[chunkLength] = pgm_read_byte(&data[bytesSent + chunkLength]);
+        chunkLength++;
+      }
+      nextAddress++;
+    }
+
+    busWrite(address, buffer, chunkLength);
+    bytesSent += chunkLength;
+    address = nextAddress;
+  }
+}
+
+
+/**
+ * @brief Fills the parameter and program RAM words no write record in a
+ *        self-boot image covers, in bursts of whole words. Parameter RAM is zeroed,
+ *        program RAM gets the 00 00 00 00 01 word SigmaStudio pads Program_Data with
+ *
+ * @param image PROGMEM self-boot image
+ * @param size Size of the image in bytes
+ * @param parameterCleared True to leave the parameter RAM alone, it's already zeroed
+ */
+void SigmaDSP::selfboot_clear(const uint8_t *image, uint16_t size, bool parameterCleared)
+{
+  uint8_t buffer[SIGMADSP_STAGING_BUFFER_SIZE] = { 0 };
+  uint16_t chunk = busMaxChunk();
+  if(chunk > sizeof(buffer))
+    chunk = sizeof(buffer);
+
+  // Parameter RAM (0x0000-0x03FF), then program RAM (0x0400-0x07FF)
+  uint16_t address = parameterCleared ? 0x0400 : 0x0000;
+  while(address < 0x0800)
+  {
+    uint16_t ramEnd = (address < 0x0400) ? 0x0400 : 0x0800;
+    uint16_t next = ramEnd;
+    uint16_t covered = selfboot_covered(image, size, address, next);
+    if(covered > address)
+    {
+      address = covered;
+      continue;
+    }
+
+    // Fill the gap up to the next record or the end of this RAM
+    if(next > ramEnd)
+      next = ramEnd;
+    uint8_t width = registerWidth(address);
+    for(uint16_t j = 0; j < sizeof(buffer); j++)
+      buffer[j] = (width == 5 && j % 5 == 4) ? 0x01 : 0x00;
+    while(address < next)
+    {
+      uint16_t words = chunk / width;
+      if(words > next - address)
+        words = next - address;
+      busWrite(address, buffer, words * width);
+      address += words;
+    }
+  }
+}
+
+
+/**
+ * @brief Looks for the RAM words a self-boot image writes at and after an address
+ *
+ * @param image PROGMEM self-boot image
+ * @param size Size of the image in bytes
+ * @param address Parameter or program RAM address
+ * @param next Lowered to the first address above address that a write record starts at
+ * @return uint16_t end address of a write record covering address, or address if none does
+ */
+uint16_t SigmaDSP::selfboot_covered(const uint8_t *image, uint16_t size, uint16_t address, uint16_t &next)
+{
+  uint16_t covered = address;
+  uint16_t i = 0;
+  while(i < size)
+  {
+    uint8_t command = pgm_read_byte(&image[i++]);
+    if(command == SELFBOOT_WRITE && i + 5 <= size)
+    {
+      uint16_t length = (uint16_t)pgm_read_byte(&image[i]) << 8 | pgm_read_byte(&image[i + 1]);
+      uint16_t start = (uint16_t)pgm_read_byte(&image[i + 3]) << 8 | pgm_read_byte(&image[i + 4]);
+      i += 2 + length;
+      if(length < 3 || start >= 0x0800)
+        continue;
+
+      uint16_t end = start + (length - 3) / registerWidth(start);
+      if(start <= address && end > covered)
+        covered = end;
+      else if(start > address && start < next)
+        next = start;
+    }
+    else if(command == SELFBOOT_DELAY)
+      i += 2;
+    else if(command != SELFBOOT_NOP)
+      break; // End record, or a malformed image
+  }
+  return covered;
+}
+
+
+/**
+ * @brief Stages a word in the next free safeload slot. Flushes when all five slots are used
+ *
+ * @param memoryAddress DSP memory address
+ * @param data Data array (5 bytes) to stage
+ */
+void SigmaDSP::safeload_stage(uint16_t memoryAddress, const uint8_t *data)
+{
+  // Stage passed data (5 bytes) and 16-bit memory address in the next free safeload slot
+  for(uint8_t i = 0; i < 5; i++)
+    _safeload_buffer[_safeload_count * 5 + i] = data[i];
+  _safeload_buffer[_safeload_addrOffset + _safeload_count * 2]     = (memoryAddress >> 8) & 0xFF;
+  _safeload_buffer[_safeload_addrOffset + _safeload_count * 2 + 1] = memoryAddress & 0xFF;
+
+  _safeload_count++; // Increase counter
+
+  if(_safeload_count >= 5) // Max 5 safeload memory registers
+    safeload_flush();
+}
+
+
+/**
+ * @brief Sends the staged safeload words and triggers the safeload transfer,
+ *        or hands them to the update queue if one is attached
+ */
+void SigmaDSP::safeload_flush()
+{
+  if(_safeload_count == 0)
+    return;
+
+  // Hand the group to the update queue if there is one, making room by sending the oldest group
+  if(_queue != nullptr)
+  {
+    while(_queue->push(_safeload_buffer, _safeload_count) == false)
+      queue_send();
+  }
+  else
+    safeload_send(_safeload_buffer, _safeload_count);
+
+  _safeload_count = 0;
+}
+
+
+/**
+ * @brief Writes a safeload group to the safeload registers and initiates the transfer
+ *
+ * @param buffer Safeload group, five 5-byte data words followed by five 16-bit addresses
+ * @param count Number of words in the group
+ */
+void SigmaDSP::safeload_send(const uint8_t *buffer, uint8_t count)
+{
+  // The DSP performs the safeload transfer at the end of the current audio frame.
+  // Make sure the previous one is done before the safeload registers are overwritten
+  while(safeload_ready() == false);
+
+  // SafeloadData0..4 and SafeloadAddress0..4 are contiguous, and the DSP auto-increments
+  // the register address in burst mode. A full group goes out in one transaction if the
+  // transport can hold it, otherwise data and addresses are sent in one transaction each
+  uint8_t status;
+  if(count == 5 && busMaxChunk() >= sizeof(_safeload_buffer))
+    status = busWrite(dspRegister::SafeloadData0, buffer, sizeof(_safeload_buffer));
+  else
+  {
+    status = busWrite(dspRegister::SafeloadData0, buffer, count * 5);
+    if(status == 0)
+      status = busWrite(dspRegister::SafeloadAddress0, &buffer[_safeload_addrOffset], count * 2);
+  }
+
+  // Don't start a transfer of half written safeload registers
+  if(status == 0)
+  {
+    uint8_t istData[2];
+    istData[0] = 0x00;
+    istData[1] = 0x3C; // Set the IST bit (initiate safeload transfer bit)
+    status = busWrite(dspRegister::CoreRegister, istData, sizeof(istData)); // Load content from the safeload registers
+    _safeload_istTime = micros();
+  }
+
+  // The shadow took the words for written, forget them if they didn't get there
+  if(status != 0 && _shadow != nullptr)
+  {
+    for(uint8_t i = 0; i < count; i++)
+      _shadow->invalidate((uint16_t)buffer[_safeload_addrOffset + i * 2] << 8 | buffer[_safeload_addrOffset + i * 2 + 1], 1);
+  }
+
+  if(_stats != nullptr)
+    _stats->safeload();
+}
+
+
+/**
+ * @brief Checks if at least one sample period has passed since the last safeload transfer
+ *
+ * @return true if the safeload registers can be written
+ */
+bool SigmaDSP::safeload_ready()
+{
+  uint32_t framePeriod = (uint32_t)(1000000 / FS) + 1;
+  return micros() - _safeload_istTime >= framePeriod;
+}
+
+
+/**
+ * @brief Sends the oldest group in the update queue, leaving out words the DSP already holds
+ */
+void SigmaDSP::queue_send()
+{
+  uint8_t buffer[sizeof(_safeload_buffer)];
+  uint8_t count;
+  if(_queue->pop(buffer, count) == false)
+    return;
+
+  // Compact the group down to the words that changed
+  uint8_t kept = 0;
+  for(uint8_t i = 0; i < count; i++)
+  {
+    const uint8_t *data = &buffer[i * 5];
+    const uint8_t *address = &buffer[_safeload_addrOffset + i * 2];
+    if(_shadow != nullptr && data[0] == 0x00)
+    {
+      uint32_t value = (uint32_t)data[1] << 24 | (uint32_t)data[2] << 16 | (uint32_t)data[3] << 8 | data[4];
+      if(_shadow->changed((uint16_t)address[0] << 8 | address[1], value) == false)
+        continue;
+    }
+    for(uint8_t j = 0; j < 5; j++)
+      buffer[kept * 5 + j] = data[j];
+    buffer[_safeload_addrOffset + kept * 2]     = address[0];
+    buffer[_safeload_addrOffset + kept * 2 + 1] = address[1];
+    kept++;
+  }
+
+  if(kept > 0)
+    safeload_send(buffer, kept);
+}
+
+
+/**
+ * @brief Adds a word to the update buffer, kept sorted by address.
+ *        A word already collected for the same address is replaced
+ *
+ * @param memoryAddress DSP memory address
+ * @param data Data array (5 bytes) to collect
+ */
+void SigmaDSP::update_add(uint16_t memoryAddress, const uint8_t *data)
+{
+  uint8_t i = 0;
+  while(i < _updateCount && _update[i].address < memoryAddress)
+    i++;
+
+  // New address. Make room, flushing first if the buffer is full
+  if(i == _updateCount || _update[i].address != memoryAddress)
+  {
+    if(_updateCount >= SIGMADSP_UPDATE_BUFFER_SIZE)
+    {
+      update_flush();
+      i = 0;
+    }
+    for(uint8_t j = _updateCount; j > i; j--)
+      _update[j] = _update[j - 1];
+    _updateCount++;
+  }
+
+  _update[i].address = memoryAddress;
+  _update[i].module = _updateModule;
+  for(uint8_t j = 0; j < 5; j++)
+    _update[i].data[j] = data[j];
+}
+
+
+/**
+ * @brief Sends the collected words. Words from the same DSP function call are
+ *        packed into the same safeload group whenever they fit
+ */
+void SigmaDSP::update_flush()
+{
+  uint8_t i = 0;
+
+  while(i < _updateCount)
+  {
+    // Find the run of words written by the same function call
+    uint8_t run = 1;
+    while(i + run < _updateCount && _update[i + run].module == _update[i].module)
+      run++;
+
+    // Start a new group if the run doesn't fit in what's left of the current one
+    if(_safeload_count > 0 && _safeload_count + run > 5)
+      safeload_flush();
+
+    for(uint8_t j = 0; j < run; j++)
+      safeload_stage(_update[i + j].address, _update[i + j].data);
+
+    i += run;
+  }
+
+  safeload_flush();
+  _updateCount = 0;
+}
+
+
+/**
+ * @brief Looks up the parameter words of a DSP function in the attached cache
+ *
+ * @param key Cache key of the function's settings
+ * @param words Array to copy the cached words to
+ * @param count Number of words
+ * @return true if the words were found, false if they have to be calculated
+ */
+bool SigmaDSP::cache_lookup(const dspCacheKey_t &key, int32_t *words, uint8_t count)
+{
+  if(_cache == nullptr)
+    return false;
+  return _cache->lookup(key, words, count);
+}
+
+
+/**
+ * @brief Stores freshly calculated parameter words in the attached cache
+ *
+ * @param key Cache key of the function's settings
+ * @param words Calculated words
+ * @param count Number of words
+ */
+void SigmaDSP::cache_store(const dspCacheKey_t &key, const int32_t *words, uint8_t count)
+{
+  if(_cache != nullptr)
+    _cache->store(key, words, count);
+}
+
+
+/**
+ * @brief Converts calculated coefficients to 5.23 words, the same way floatToFixed() does
+ *
+ * @param coefficients Float coefficients
+ * @param words Array to store the words in
+ * @param count Number of coefficients
+ */
+void SigmaDSP::coefficient_words(const float *coefficients, int32_t *words, uint8_t count)
+{
+  for(uint8_t i = 0; i < count; i++)
+    words[i] = floatToInt(coefficients[i]);
+}
+
+
+/**
+ * @brief Copies coefficients that are already 5.23 words
+ *
+ * @param coefficients Fixed-point coefficients
+ * @param words Array to store the words in
+ * @param count Number of coefficients
+ */
+void SigmaDSP::coefficient_words(const int32_t *coefficients, int32_t *words, uint8_t count)
+{
+  for(uint8_t i = 0; i < count; i++)
+    words[i] = coefficients[i];
 }
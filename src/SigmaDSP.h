@@ -1,16 +1,78 @@
 #ifndef SIGMADSP_H
 #define SIGMADSP_H
 
-#include <Arduino.h>
-#include <Wire.h>
+#include "DSPPlatform.h"
+#ifdef ARDUINO
+  #include <Wire.h>
+#endif
 #include <stdint.h>
 #include "parameters.h"
+#include "DSPTransport.h"
+#include "DSPWireTransport.h"
+#include "DSPShadowRAM.h"
+#include "DSPUpdateQueue.h"
+#include "DSPStats.h"
+#include "DSPCRC32.h"
 #include "DSPEEPROM.h"
+#include "DSPRLEStream.h"
+#include "DSPFilterDesign.h"
+#include "DSPConstDesign.h"
+#include "DSPCoefficientCache.h"
 
 #ifndef ESP_IDF_VERSION_VAL
 #define ESP_IDF_VERSION_VAL(x, y, z) 0
 #endif
 
+// Size of the RAM buffer used to stage PROGMEM data before it's handed to the transport.
+// Burst writes never exceed this or the transport's maxChunk()
+#ifndef SIGMADSP_STAGING_BUFFER_SIZE
+  #ifdef ARDUINO
+    #define SIGMADSP_STAGING_BUFFER_SIZE SIGMADSP_I2C_BUFFER_SIZE
+  #else
+    #define SIGMADSP_STAGING_BUFFER_SIZE 240 // Whole parameter and program words, fits the uint8_t lengths
+  #endif
+#endif
+
+// Max number of distinct addresses collected between beginUpdate() and commit().
+// The buffer is flushed early if it fills up
+#ifndef SIGMADSP_UPDATE_BUFFER_SIZE
+  #if defined(__AVR__)
+    #define SIGMADSP_UPDATE_BUFFER_SIZE 10
+  #else
+    #define SIGMADSP_UPDATE_BUFFER_SIZE 64
+  #endif
+#endif
+
+// Length of the reset pulse. The ADAU1701 needs at least 20 ns
+#ifndef SIGMADSP_RESET_PULSE_US
+  #define SIGMADSP_RESET_PULSE_US 1
+#endif
+
+// Time between polls while waitForBoot() waits for the DSP.
+// During self-boot the DSP is bus master, so don't poll too eagerly
+#ifndef SIGMADSP_BOOT_POLL_INTERVAL
+  #define SIGMADSP_BOOT_POLL_INTERVAL 5
+#endif
+
+// Default number of parameter words from which a block is written directly
+// instead of through safeload, once a bulk policy is set with setBulkPolicy()
+#ifndef SIGMADSP_BULK_THRESHOLD
+  #define SIGMADSP_BULK_THRESHOLD 16
+#endif
+
+// Number of 32-bit words in the ADAU1701 parameter RAM (addresses 0x0000 to 0x03FF)
+#define PARAMETER_RAM_WORDS 1024
+
+// Start of the ADAU1701 program RAM (40-bit words, addresses 0x0400 to 0x07FF)
+#define PROGRAM_RAM_ADDR 0x0400
+
+// Self-boot image record types
+#define SELFBOOT_END      0x00
+#define SELFBOOT_WRITE    0x01
+#define SELFBOOT_DELAY    0x02
+#define SELFBOOT_NOP      0x03
+#define SELFBOOT_END_WAIT 0x06
+
 /**
  * @brief ADAU1701 hardware register constants
  *
@@ -37,7 +99,7 @@ typedef enum
   SafeloadData4            = 0x0814,
   SafeloadAddress0         = 0x0815,
   SafeloadAddress1         = 0x0816,
-  SafeloadAddress2         = 0x0816,
+  SafeloadAddress2         = 0x0817,
   SafeloadAddress3         = 0x0818,
   SafeloadAddress4         = 0x0819,
   DataCapture0             = 0x081A,
@@ -52,17 +114,71 @@ typedef enum
   AnalogInterfaceRegister0 = 0x0824
 } dspRegister;
 
+
+/**
+ * @brief DSP start-up progress, as reported by bootStatus()
+ */
+typedef enum
+{
+  BootBusy,   // Not answering yet. Held in reset, starting up or loading from the self-boot EEPROM
+  BootIdle,   // Answering, but the core isn't running. Ready for loadProgram()
+  BootRunning // The core is running a program
+} dspBootStatus;
+
+
+/**
+ * @brief How large parameter blocks are written, see setBulkPolicy()
+ */
+typedef enum
+{
+  BulkOff,      // Always use safeload, five words per transfer
+  BulkDirect,   // Write the parameter RAM directly. The block may run half updated for a moment
+  BulkMuteDAC,  // Mute the DACs while writing, then restore the previous mute state
+  BulkMuteBlock // Mute a SigmaStudio mute block while writing, then restore its previous state
+} dspBulkPolicy;
+
+
+/**
+ * @brief Safeload word collected between beginUpdate() and commit()
+ */
+typedef struct dspUpdateEntry_t
+{
+  uint16_t address; // Parameter RAM address
+  uint8_t module;   // Tells which DSP function call the word belongs to
+  uint8_t data[5];  // Safeload data
+} dspUpdateEntry;
+
 class SigmaDSP
 {
+  friend class SigmaDSPGroup;
+
   public:
     // Store passed device type and i2c address to private constants
-    SigmaDSP(TwoWire &WireObject, uint8_t i2cAddress, float sample_freq, int8_t resetPin = -1);
+    #ifdef ARDUINO
+      SigmaDSP(TwoWire &WireObject, uint8_t i2cAddress, float sample_freq, int8_t resetPin = -1);
+    #endif
+    SigmaDSP(DSPTransport &transport, uint8_t i2cAddress, float sample_freq, int8_t resetPin = -1);
+    virtual ~SigmaDSP() {}
 
-    // Init and setup
-    void begin();
-    void i2cClock(uint32_t clock);
-    void reset();
-    uint8_t ping();
+    // Init and setup. Virtual so a SigmaDSPGroup passed as SigmaDSP still drives all its members
+    virtual void begin();
+    virtual void i2cClock(uint32_t clock);
+    virtual void reset();
+    virtual uint8_t ping();
+    virtual dspBootStatus bootStatus();
+    virtual bool waitForBoot(uint16_t timeout, dspBootStatus state = BootRunning);
+    void attachShadow(DSPShadow &shadow, const uint8_t *defaults = nullptr, uint16_t defaultsSize = 0);
+    void detachShadow();
+    void attachStats(DSPStats &stats);
+    void detachStats();
+    DSPStats *getStats();
+    void attachQueue(DSPQueue &queue);
+    void detachQueue();
+    void attachCache(DSPCache &cache);
+    void detachCache();
+    bool setGraphicEQTable(const int32_t *table, uint8_t bands, uint8_t steps, float fs);
+    uint8_t poll();
+    void flushQueue();
 
     // DSP functions
     void mux(uint16_t startMemoryAddress,         uint8_t index,   uint8_t numberOfIndexes = 0);
@@ -130,6 +246,17 @@ class SigmaDSP
     void stateVariable(uint16_t startMemoryAddress,  float freq, float q);
     void compressorRMS(uint16_t startMemoryAddress,  compressor_t &compressor);
     void compressorPeak(uint16_t startMemoryAddress, compressor_t &compressor);
+    void graphicEQ(uint16_t startMemoryAddress,      uint8_t band,    uint8_t gainStep);
+
+    // Precalculated parameter words, see DSPConstDesign.h. The short ones are inline so constexpr words become immediates,
+    // the compressor words are best kept in PROGMEM and passed as a pointer
+    void EQfirstOrder(uint16_t startMemoryAddress,   const dspFirstOrderWords_t &c)    { DSPStatsScope scope(_stats, StatsEQfirstOrder);  safeload_write(startMemoryAddress, c.words[0], c.words[1], c.words[2]); }
+    void EQsecondOrder(uint16_t startMemoryAddress,  const dspBiquadWords_t &c)        { DSPStatsScope scope(_stats, StatsEQsecondOrder); safeload_write(startMemoryAddress, c.words[0], c.words[1], c.words[2], c.words[3], c.words[4]); }
+    void stateVariable(uint16_t startMemoryAddress,  const dspStateVariableWords_t &c) { DSPStatsScope scope(_stats, StatsStateVariable); safeload_write(startMemoryAddress, c.words[0], c.words[1]); }
+    void compressorRMS(uint16_t startMemoryAddress,  const dspCompressorRMSWords_t &parameters);
+    void compressorPeak(uint16_t startMemoryAddress, const dspCompressorPeakWords_t &parameters);
+    void compressorRMS(uint16_t startMemoryAddress,  const dspCompressorRMSWords_t *parameters);
+    void compressorPeak(uint16_t startMemoryAddress, const dspCompressorPeakWords_t *parameters);
 
     // Hardware functions
     void muteADC(bool mute);
@@ -141,6 +268,12 @@ class SigmaDSP
     int32_t floatToInt(float value);
 
     // DSP data write methods
+    void beginUpdate();
+    void commit();
+    void setBulkPolicy(dspBulkPolicy policy, uint8_t threshold = SIGMADSP_BULK_THRESHOLD, uint16_t muteAddress = 0);
+    void writeParameterBlock(uint16_t startMemoryAddress, const float *values, uint16_t count);
+    void writeParameterBlock(uint16_t startMemoryAddress, const int32_t *values, uint16_t count);
+
     /**
      * @brief Template wrapper for safeload_writeRegister.
      *        Handles both int 28.0 and float 5.23 formatted parameters.
@@ -161,7 +294,7 @@ class SigmaDSP
     void safeload_writeRegister(uint16_t memoryAddress,  uint8_t *data, bool finished);
     void safeload_writeRegister(uint16_t memoryAddress,   int32_t data, bool finished);
     void safeload_writeRegister(uint16_t memoryAddress,     float data, bool finished);
-    #if defined(ARDUINO_ARCH_ESP8266) || (defined(ARDUINO_ARCH_ESP32) && ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(5, 0, 0))
+    #if defined(ARDUINO_ARCH_ESP8266) || (defined(ARDUINO_ARCH_ESP32) && ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(5, 0, 0)) || !defined(ARDUINO)
       void safeload_writeRegister(uint16_t memoryAddress, int16_t data, bool finished);
     #else
       void safeload_writeRegister(uint16_t memoryAddress,     int data, bool finished);
@@ -173,6 +306,10 @@ class SigmaDSP
     void writeRegister(uint16_t memoryAddress, uint8_t length, uint8_t *data);
     void writeRegister(uint16_t memoryAddress, uint8_t length, const uint8_t *data);
     void writeRegisterBlock(uint16_t memoryAddress, uint16_t length, const uint8_t *data, uint8_t registerSize);
+    bool writeRegisterBlock(uint16_t memoryAddress, uint16_t length, Stream &stream, uint8_t registerSize, bool skipZeros = false);
+    bool loadSelfbootImage(const uint8_t *image, uint16_t size, bool ramCleared = false);
+    bool verifyProgram(uint32_t crc, uint16_t length);
+    bool verifyProgram(const uint8_t *program, uint16_t length);
     int32_t readBack(uint16_t address, uint16_t value, uint8_t length);
     uint32_t readRegister(dspRegister hwReg, uint8_t numberOfBytes);
 
@@ -180,6 +317,13 @@ class SigmaDSP
     const float FS; // Sample rate in [Hz]
 
 
+  protected:
+    // Bus access. All DSP communication goes through these
+    virtual uint8_t busWrite(uint16_t subAddress, const uint8_t *data, uint16_t length);
+    virtual uint8_t busRead(uint16_t subAddress, uint8_t *data, uint16_t length);
+    virtual uint16_t busMaxChunk();
+
+
   private:
     // Wrapper template functions for safeload template
     template <typename Data1, typename... DataN>
@@ -196,11 +340,43 @@ class SigmaDSP
       safeload_writeRegister(_dspRegAddr, data1, true);
     }
 
-    // Math
-    void linspace(float x1, float x2, float n, float *vect);
+    // Safeload staging and update buffer
+    void safeload_stage(uint16_t memoryAddress, const uint8_t *data);
+    void safeload_flush();
+    void safeload_send(const uint8_t *buffer, uint8_t count);
+    bool safeload_ready();
+    void queue_send();
+    void update_add(uint16_t memoryAddress, const uint8_t *data);
+    void update_flush();
+
+    // Coefficient cache
+    bool cache_lookup(const dspCacheKey_t &key, int32_t *words, uint8_t count);
+    void cache_store(const dspCacheKey_t &key, const int32_t *words, uint8_t count);
+    void coefficient_words(const float *coefficients, int32_t *words, uint8_t count);
+    void coefficient_words(const int32_t *coefficients, int32_t *words, uint8_t count);
+
+    // Block writes
+    void writeNonZeroRegisters(uint16_t memoryAddress, const uint8_t *data, uint16_t length, uint8_t registerSize);
+    void bulk_begin(uint16_t words);
+    void bulk_add(uint16_t memoryAddress, const uint8_t *data);
+    void bulk_flush();
+    void bulk_end();
+    void bulk_mute(bool mute);
+
+    // Program RAM read back
+    bool program_read(const uint8_t *program, uint16_t length, uint32_t &crc);
+
+    // Self-boot image replay
+    static uint8_t registerWidth(uint16_t address);
+    void selfboot_write(uint16_t address, const uint8_t *data, uint16_t length);
+    void selfboot_clear(const uint8_t *image, uint16_t size, bool parameterCleared);
+    static uint16_t selfboot_covered(const uint8_t *image, uint16_t size, uint16_t address, uint16_t &next);
 
     // Objects
-    TwoWire &_WireObject;      // Reference to passed Wire object
+    #ifdef ARDUINO
+      DSPWireTransport _wireTransport; // Default transport, wraps the passed Wire object
+    #endif
+    DSPTransport &_transport;        // Transport all DSP communication goes through
 
     // Private constants
     const uint8_t _dspAddress; // Passed device i2c address
@@ -208,6 +384,39 @@ class SigmaDSP
 
     // Private variables
     uint16_t _dspRegAddr;      // Used by template safeload functions
+    DSPShadow *_shadow = nullptr; // Optional shadow of the parameter RAM
+    DSPQueue *_queue = nullptr;   // Optional queue of pending safeload groups
+    DSPStats *_stats = nullptr;   // Optional bus traffic counters
+    DSPCache *_cache = nullptr;   // Optional cache of calculated filter coefficients
+    const int32_t *_graphicEQTable = nullptr; // PROGMEM graphic EQ words, see extras/graphic_eq_table.cpp
+    uint8_t _graphicEQBands = 0;  // Number of bands in the graphic EQ table
+    uint8_t _graphicEQSteps = 0;  // Number of gain steps per band
+
+    dspUpdateEntry_t _update[SIGMADSP_UPDATE_BUFFER_SIZE]; // Words collected between beginUpdate() and commit()
+    uint8_t _updateCount = 0;  // Number of collected words
+    uint8_t _updateModule = 0; // Id of the DSP function call currently being collected
+    uint8_t _updateDepth = 0;  // beginUpdate() nesting depth
+
+    // Safeload staging area. SafeloadData0..4 (5 bytes each) followed by SafeloadAddress0..4 (2 bytes each),
+    // laid out the same way as the registers so a full group can go out in a single burst
+    uint8_t _safeload_buffer[5 * 5 + 5 * 2];
+    uint8_t _safeload_count = 0;      // Keeps track of the safeload count
+    uint32_t _safeload_istTime = 0;   // micros() timestamp of the last safeload transfer
+
+    // Direct parameter RAM writes of large blocks. The safeload buffer doubles as burst buffer,
+    // it's always empty while a block is written
+    dspBulkPolicy _bulkPolicy = BulkOff;
+    uint8_t _bulkThreshold = SIGMADSP_BULK_THRESHOLD;
+    uint16_t _bulkMuteAddress = 0;  // Mute block address used by BulkMuteBlock
+    bool _bulkActive = false;       // True while words go to the burst buffer instead of safeload
+    bool _bulkMuted = false;        // True once the mute policy has been applied for the current block
+    bool _bulkChanged = false;      // True if a word in the burst buffer differs from the shadow
+    uint16_t _bulkAddress = 0;      // Address of the first word in the burst buffer
+    uint8_t _bulkCount = 0;         // Number of words in the burst buffer
+    uint8_t _bulkRestore[4];        // Core register or mute block content to restore after the block
 };
 
+#include "SigmaDSPGroup.h"
+#include "DSPEEPROMFlasher.h"
+
 #endif //SIGMADSP_H
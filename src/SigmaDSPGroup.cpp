@@ -0,0 +1,172 @@
+#include "SigmaDSPGroup.h"
+
+/*******************************************************************************************
+**                                      PUBLIC METHODS                                    **
+*******************************************************************************************/
+
+/**
+ * @brief Construct a new SigmaDSPGroup object
+ *
+ * @param members Array of DSP objects to drive. Must hold at least one DSP,
+ *                and all of them must run the same program at the same sample rate
+ * @param memberCount Number of DSP objects in the array
+ */
+SigmaDSPGroup::SigmaDSPGroup(SigmaDSP *members[], uint8_t memberCount)
+  : SigmaDSP(members[0]->_transport, members[0]->_dspAddress, members[0]->FS),
+    _members(members), _memberCount(memberCount)
+{
+
+}
+
+
+/**
+ * @brief Starts the transport of every DSP in the group and resets them
+ */
+void SigmaDSPGroup::begin()
+{
+  for(uint8_t i = 0; i < _memberCount; i++)
+    _members[i]->begin();
+}
+
+
+/**
+ * @brief Sets the clock speed of every DSP's transport
+ *
+ * @param clock i2c (or SPI) clock speed in [Hz]
+ */
+void SigmaDSPGroup::i2cClock(uint32_t clock)
+{
+  for(uint8_t i = 0; i < _memberCount; i++)
+    _members[i]->i2cClock(clock);
+}
+
+
+/**
+ * @brief Performs a hardware reset of every DSP in the group that has a reset pin
+ */
+void SigmaDSPGroup::reset()
+{
+  for(uint8_t i = 0; i < _memberCount; i++)
+    _members[i]->reset();
+}
+
+
+/**
+ * @brief Pings every DSP in the group
+ *
+ * @return uint8_t status of the first DSP that didn't respond, 0 if all did
+ */
+uint8_t SigmaDSPGroup::ping()
+{
+  for(uint8_t i = 0; i < _memberCount; i++)
+  {
+    uint8_t status = _members[i]->ping();
+    if(status != 0)
+      return status;
+  }
+  return 0;
+}
+
+
+/**
+ * @brief Checks how far the DSPs in the group have come after a reset or power-up
+ *
+ * @return dspBootStatus status of the DSP that's furthest behind
+ */
+dspBootStatus SigmaDSPGroup::bootStatus()
+{
+  dspBootStatus status = BootRunning;
+  for(uint8_t i = 0; i < _memberCount; i++)
+  {
+    dspBootStatus memberStatus = _members[i]->bootStatus();
+    if(memberStatus < status)
+      status = memberStatus;
+  }
+  return status;
+}
+
+
+/**
+ * @brief Waits for every DSP in the group to reach a start-up state
+ *
+ * @param timeout Max time to wait in [ms], shared by all DSPs
+ * @param state State to wait for (optional parameter)
+ * @return true if all DSPs got there in time, false on timeout
+ */
+bool SigmaDSPGroup::waitForBoot(uint16_t timeout, dspBootStatus state)
+{
+  uint32_t start = millis();
+
+  for(uint8_t i = 0; i < _memberCount; i++)
+  {
+    uint32_t elapsed = millis() - start;
+    if(elapsed > timeout || _members[i]->waitForBoot(timeout - elapsed, state) == false)
+      return false;
+  }
+
+  return true;
+}
+
+
+/*******************************************************************************************
+**                                      PRIVATE METHODS                                   **
+*******************************************************************************************/
+
+/**
+ * @brief Writes the same block of data to every DSP in the group, one after the other
+ *
+ * @param subAddress DSP register or memory address
+ * @param data Data array to write
+ * @param length Number of bytes to write
+ * @return uint8_t status of the first failed write, 0 if all succeeded
+ */
+uint8_t SigmaDSPGroup::busWrite(uint16_t subAddress, const uint8_t *data, uint16_t length)
+{
+  uint8_t result = 0;
+  for(uint8_t i = 0; i < _memberCount; i++)
+  {
+    uint32_t start = micros();
+    uint8_t status = _members[i]->busWrite(subAddress, data, length);
+    if(_stats != nullptr)
+      _stats->record(length, 0, status, micros() - start);
+    if(result == 0)
+      result = status;
+  }
+  return result;
+}
+
+
+/**
+ * @brief Reads a block of data from the first DSP in the group
+ *
+ * @param subAddress DSP register or memory address
+ * @param data Array to store the received data in
+ * @param length Number of bytes to read
+ * @return uint8_t transport status code (0 = success)
+ */
+uint8_t SigmaDSPGroup::busRead(uint16_t subAddress, uint8_t *data, uint16_t length)
+{
+  uint32_t start = micros();
+  uint8_t status = _members[0]->busRead(subAddress, data, length);
+  if(_stats != nullptr)
+    _stats->record(0, length, status, micros() - start);
+  return status;
+}
+
+
+/**
+ * @brief Returns the largest write every DSP in the group can take
+ *
+ * @return uint16_t max data bytes per transaction
+ */
+uint16_t SigmaDSPGroup::busMaxChunk()
+{
+  uint16_t chunk = 0xFFFF;
+  for(uint8_t i = 0; i < _memberCount; i++)
+  {
+    uint16_t memberChunk = _members[i]->busMaxChunk();
+    if(memberChunk < chunk)
+      chunk = memberChunk;
+  }
+  return chunk;
+}
@@ -0,0 +1,37 @@
+#ifndef SIGMADSPGROUP_H
+#define SIGMADSPGROUP_H
+
+#include "DSPPlatform.h"
+#include "SigmaDSP.h"
+
+/**
+ * @brief Drives several DSPs running the same program in lock-step.
+ *        Every DSP function is computed once and the resulting writes are sent
+ *        to the members one after the other, each of them getting its own safeload
+ *        transfer. There's no shared-address broadcast, the bus time grows with
+ *        the number of members. Reads are served by the first member.
+ *        Shadows attached to the member objects are not updated by group writes,
+ *        attach one to the group instead
+ */
+class SigmaDSPGroup : public SigmaDSP
+{
+  public:
+    SigmaDSPGroup(SigmaDSP *members[], uint8_t memberCount);
+    void begin() override;
+    void i2cClock(uint32_t clock) override;
+    void reset() override;
+    uint8_t ping() override;
+    dspBootStatus bootStatus() override;
+    bool waitForBoot(uint16_t timeout, dspBootStatus state = BootRunning) override;
+
+  protected:
+    uint8_t busWrite(uint16_t subAddress, const uint8_t *data, uint16_t length) override;
+    uint8_t busRead(uint16_t subAddress, uint8_t *data, uint16_t length) override;
+    uint16_t busMaxChunk() override;
+
+  private:
+    SigmaDSP **_members;        // DSPs driven by this group
+    const uint8_t _memberCount; // Number of DSPs in the group
+};
+
+#endif //SIGMADSPGROUP_H
@@ -0,0 +1,226 @@
+/*
+ * Mock ADAU1701 behind a mocked i2c-dev or spidev ioctl, for the host tests that drive SigmaDSP.
+ * Parameter RAM, program RAM and the registers are plain arrays addressed like the
+ * real part: the sub address auto-increments per word, and words are 4 bytes in
+ * parameter RAM, 5 bytes in program RAM and 1-5 bytes in the register area.
+ * Setting the IST bit in the core register copies the safeload slots written since
+ * the last transfer to parameter RAM.
+ */
+
+#ifndef MOCK_ADAU1701_H
+#define MOCK_ADAU1701_H
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <linux/spi/spidev.h>
+#include "DSPLinuxI2CTransport.h"
+#include "DSPSpidevTransport.h"
+
+#define MOCK_FD          42
+#define MOCK_DSP_ADDRESS 0x34
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { if(!(condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); failures++; } } while(0)
+
+struct mockDSP
+{
+  uint8_t parameterRAM[0x0400][4];
+  uint8_t programRAM[0x0400][5];
+  uint8_t registers[0x0030][5];
+  uint8_t safeloadWritten;  // Bit mask of the safeload address slots written since the last IST
+  uint16_t failAddress;     // Writes starting at this sub address fail, 0xFFFF for none
+  uint32_t writes;          // Number of write transactions, pings excluded
+  uint32_t reads;           // Number of read transactions
+  uint8_t spiMode;          // Mode set through SPI_IOC_WR_MODE
+  uint32_t spiClock;        // Clock set through SPI_IOC_WR_MAX_SPEED_HZ
+  uint32_t latchToggles;    // Number of SPI messages, each one pulls CLATCH low once
+};
+
+static mockDSP mock;
+
+static void mockReset()
+{
+  memset(&mock, 0, sizeof(mock));
+  mock.failAddress = 0xFFFF;
+}
+
+// Width of a word at a DSP address, the same layout SigmaDSP::registerWidth() assumes
+static uint8_t mockWidth(uint16_t address)
+{
+  if(address < 0x0400)
+    return 4;
+  if(address < 0x0800)
+    return 5;
+  if(address < 0x0808)
+    return 4;
+  if(address >= 0x0810 && address <= 0x0814)
+    return 5;
+  if(address == 0x081D || address == 0x081F)
+    return 1;
+  if(address == 0x0820 || address == 0x0821)
+    return 3;
+  return 2;
+}
+
+// Storage of a word, nullptr outside the mocked memory
+static uint8_t *mockWord(uint16_t address)
+{
+  if(address < 0x0400)
+    return mock.parameterRAM[address];
+  if(address < 0x0800)
+    return mock.programRAM[address - 0x0400];
+  if(address < 0x0800 + 0x0030)
+    return mock.registers[address - 0x0800];
+  return nullptr;
+}
+
+static void mockSafeloadTransfer()
+{
+  for(uint8_t slot = 0; slot < 5; slot++)
+  {
+    if((mock.safeloadWritten & (1 << slot)) == 0)
+      continue;
+    const uint8_t *data = mock.registers[0x10 + slot];
+    const uint8_t *address = mock.registers[0x15 + slot];
+    uint16_t target = (uint16_t)address[0] << 8 | address[1];
+    if(target < 0x0400)
+      memcpy(mock.parameterRAM[target], &data[1], 4);
+  }
+  mock.safeloadWritten = 0;
+}
+
+static void mockWrite(uint16_t address, const uint8_t *data, uint16_t length)
+{
+  uint16_t offset = 0;
+  while(offset < length)
+  {
+    uint8_t width = mockWidth(address);
+    uint8_t *word = mockWord(address);
+    for(uint8_t i = 0; i < width && offset + i < length; i++)
+    {
+      if(word != nullptr)
+        word[i] = data[offset + i];
+    }
+
+    if(address >= 0x0815 && address <= 0x0819)
+      mock.safeloadWritten |= 1 << (address - 0x0815);
+    if(address == 0x081C && (data[offset + 1] & 0x20))
+    {
+      mockSafeloadTransfer();
+      mock.registers[0x1C][1] &= ~0x20; // The IST bit clears itself
+    }
+
+    offset += width;
+    address++;
+  }
+}
+
+static void mockRead(uint16_t address, uint8_t *data, uint16_t length)
+{
+  uint16_t offset = 0;
+  while(offset < length)
+  {
+    uint8_t width = mockWidth(address);
+    const uint8_t *word = mockWord(address);
+    for(uint8_t i = 0; i < width && offset + i < length; i++)
+      data[offset + i] = word != nullptr ? word[i] : 0;
+    offset += width;
+    address++;
+  }
+}
+
+static int mockIoctl(int fd, unsigned long request, void *argument)
+{
+  struct i2c_rdwr_ioctl_data *rdwr = (struct i2c_rdwr_ioctl_data *)argument;
+  if(fd != MOCK_FD || request != I2C_RDWR || rdwr->msgs[0].addr != MOCK_DSP_ADDRESS)
+  {
+    errno = ENXIO;
+    return -1;
+  }
+
+  // Ping
+  if(rdwr->msgs[0].len < 2)
+    return rdwr->nmsgs;
+
+  uint16_t address = (uint16_t)rdwr->msgs[0].buf[0] << 8 | rdwr->msgs[0].buf[1];
+  if(rdwr->nmsgs == 2)
+  {
+    mock.reads++;
+    mockRead(address, rdwr->msgs[1].buf, rdwr->msgs[1].len);
+  }
+  else
+  {
+    if(address == mock.failAddress)
+    {
+      errno = EIO;
+      return -1;
+    }
+    mock.writes++;
+    mockWrite(address, &rdwr->msgs[0].buf[2], rdwr->msgs[0].len - 2);
+  }
+  return rdwr->nmsgs;
+}
+
+static int mockSpiIoctl(int fd, unsigned long request, void *argument)
+{
+  if(fd != MOCK_FD)
+  {
+    errno = EBADF;
+    return -1;
+  }
+
+  if(request == SPI_IOC_WR_MODE)
+  {
+    mock.spiMode = *(uint8_t *)argument;
+    return 0;
+  }
+  if(request == SPI_IOC_WR_BITS_PER_WORD)
+    return 0;
+  if(request == SPI_IOC_WR_MAX_SPEED_HZ)
+  {
+    mock.spiClock = *(uint32_t *)argument;
+    return 0;
+  }
+
+  // SPI_IOC_MESSAGE(n): chip address + R/W bit and the sub address in the first transfer,
+  // the data in the second
+  struct spi_ioc_transfer *transfer = (struct spi_ioc_transfer *)argument;
+  uint32_t count = _IOC_SIZE(request) / sizeof(struct spi_ioc_transfer);
+  const uint8_t *header = (const uint8_t *)(uintptr_t)transfer[0].tx_buf;
+  mock.latchToggles++;
+  if(count == 0 || transfer[0].len != 3 || (header[0] >> 1) != 0)
+    return (int)count;
+
+  uint16_t address = (uint16_t)header[1] << 8 | header[2];
+  uint32_t length = count > 1 ? transfer[1].len : 0;
+  if(header[0] & 0x01)
+  {
+    mock.reads++;
+    mockRead(address, (uint8_t *)(uintptr_t)transfer[1].rx_buf, length);
+  }
+  else
+  {
+    if(address == mock.failAddress)
+    {
+      errno = EIO;
+      return -1;
+    }
+    mock.writes++;
+    mockWrite(address, (const uint8_t *)(uintptr_t)transfer[1].tx_buf, length);
+  }
+  return (int)(3 + length);
+}
+
+// Value of a parameter RAM word
+static int32_t mockParameter(uint16_t address)
+{
+  const uint8_t *word = mock.parameterRAM[address];
+  return (int32_t)((uint32_t)word[0] << 24 | (uint32_t)word[1] << 16 | (uint32_t)word[2] << 8 | word[3]);
+}
+
+#endif
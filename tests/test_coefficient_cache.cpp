@@ -0,0 +1,100 @@
+/*
+ * Checks the LRU order of DSPCache, also on storage the caller owns,
+ * and that a hit needs both key hashes to match.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "DSPCoefficientCache.h"
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { if(!(condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); failures++; } } while(0)
+
+static dspCacheKey_t makeKey(uint32_t crc, uint32_t check)
+{
+  dspCacheKey_t key;
+  key.crc = crc;
+  key.check = check;
+  return key;
+}
+
+
+static void testExternalStorage()
+{
+  // Zeroed storage, like a global array. Every entry must still be usable
+  static dspCacheEntry_t storage[4];
+  memset(storage, 0, sizeof(storage));
+  DSPCache cache(storage, 4);
+
+  int32_t words[3] = { 1, 2, 3 };
+  for(uint32_t i = 0; i < 4; i++)
+  {
+    words[0] = i;
+    cache.store(makeKey(i, i), words, 3);
+  }
+  CHECK(cache.used() == 4);
+
+  for(uint32_t i = 0; i < 4; i++)
+  {
+    CHECK(cache.lookup(makeKey(i, i), words, 3) == true);
+    CHECK(words[0] == (int32_t)i);
+  }
+}
+
+
+static void testLeastRecentlyUsed()
+{
+  DSPCoefficientCache<3> cache;
+  int32_t words[2] = { 0, 0 };
+
+  cache.store(makeKey(1, 1), words, 2);
+  cache.store(makeKey(2, 2), words, 2);
+  cache.store(makeKey(3, 3), words, 2);
+
+  // Key 1 is used again, so key 2 is the oldest and goes first
+  CHECK(cache.lookup(makeKey(1, 1), words, 2) == true);
+  cache.store(makeKey(4, 4), words, 2);
+  CHECK(cache.lookup(makeKey(2, 2), words, 2) == false);
+  CHECK(cache.lookup(makeKey(1, 1), words, 2) == true);
+  CHECK(cache.lookup(makeKey(3, 3), words, 2) == true);
+  CHECK(cache.lookup(makeKey(4, 4), words, 2) == true);
+  CHECK(cache.hits() == 4);
+  CHECK(cache.misses() == 1);
+}
+
+
+static void testCollision()
+{
+  DSPCoefficientCache<2> cache;
+  int32_t words[5] = { 10, 20, 30, 40, 50 };
+
+  // Same CRC-32, different settings
+  cache.store(makeKey(0x12345678, 0x1111), words, 5);
+  CHECK(cache.lookup(makeKey(0x12345678, 0x2222), words, 5) == false);
+  CHECK(cache.lookup(makeKey(0x12345678, 0x1111), words, 5) == true);
+
+  // Different settings of the same block get different keys
+  secondOrderEQ_t eq1, eq2;
+  eq1.freq = 1000;
+  eq2.freq = 1001;
+  dspCacheKey_t key1 = DSPCache::key(eq1, 48000);
+  dspCacheKey_t key2 = DSPCache::key(eq2, 48000);
+  CHECK(key1.crc != key2.crc);
+  CHECK(key1.check != key2.check);
+  dspCacheKey_t again = DSPCache::key(eq1, 48000);
+  CHECK(again.crc == key1.crc && again.check == key1.check);
+}
+
+
+int main()
+{
+  testExternalStorage();
+  testLeastRecentlyUsed();
+  testCollision();
+
+  if(failures != 0)
+    printf("%d check(s) failed\n", failures);
+  return failures != 0;
+}
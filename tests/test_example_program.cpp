@@ -0,0 +1,112 @@
+/*
+ * Loads an example's program into the mock ADAU1701 twice: by replaying the
+ * self-boot image with loadProgram(), and from the full SigmaStudio arrays
+ * (R0, program, parameters, hardware configuration, R4) in DSP_firmware_rle.
+ * Both must leave the DSP memory byte-for-byte the same, and verifyProgram()
+ * must recognize the loaded program by its PROGRAM_CRC32.
+ * Built once per example, with the example directory on the include path.
+ */
+
+#include "mock_adau1701.h"
+#include "SigmaDSP_parameters.h"
+
+
+// Fills the mocked memory with a pattern no program uses, like a previous program would
+static void mockGarbage()
+{
+  mockReset();
+  memset(mock.parameterRAM, 0xA5, sizeof(mock.parameterRAM));
+  memset(mock.programRAM, 0x5A, sizeof(mock.programRAM));
+  memset(mock.registers, 0x3C, sizeof(mock.registers));
+}
+
+
+static void testSelfbootMatchesArrays(bool ramCleared)
+{
+  DSPLinuxI2CTransport transport(MOCK_FD, mockIoctl);
+  SigmaDSP dsp(transport, MOCK_DSP_ADDRESS, 48000.00f);
+  dsp.begin();
+
+  // Reference: the full arrays. After a reset the RAM is cleared
+  if(ramCleared)
+    mockReset();
+  else
+    mockGarbage();
+  CHECK(loadCompressedProgram(dsp, ramCleared) == true);
+  mockDSP arrays = mock;
+
+  if(ramCleared)
+    mockReset();
+  else
+    mockGarbage();
+  loadProgram(dsp, ramCleared);
+
+  CHECK(memcmp(mock.parameterRAM, arrays.parameterRAM, sizeof(arrays.parameterRAM)) == 0);
+  CHECK(memcmp(mock.programRAM, arrays.programRAM, sizeof(arrays.programRAM)) == 0);
+  CHECK(memcmp(mock.registers, arrays.registers, sizeof(arrays.registers)) == 0);
+
+  // Point out the first difference to make a failure easier to track down
+  for(uint16_t i = 0; i < 0x0400; i++)
+  {
+    if(memcmp(mock.parameterRAM[i], arrays.parameterRAM[i], 4) != 0)
+    {
+      printf("first parameter RAM difference at 0x%04X\n", i);
+      break;
+    }
+  }
+  for(uint16_t i = 0; i < 0x0400; i++)
+  {
+    if(memcmp(mock.programRAM[i], arrays.programRAM[i], 5) != 0)
+    {
+      printf("first program RAM difference at 0x%04X\n", 0x0400 + i);
+      break;
+    }
+  }
+  for(uint16_t i = 0; i < 0x0030; i++)
+  {
+    if(memcmp(mock.registers[i], arrays.registers[i], 5) != 0)
+    {
+      printf("first register difference at 0x%04X\n", 0x0800 + i);
+      break;
+    }
+  }
+}
+
+
+static void testVerifyProgram()
+{
+  DSPLinuxI2CTransport transport(MOCK_FD, mockIoctl);
+  SigmaDSP dsp(transport, MOCK_DSP_ADDRESS, 48000.00f);
+  dsp.begin();
+
+  mockGarbage();
+  CHECK(dsp.verifyProgram(PROGRAM_CRC32, PROGRAM_SIZE) == false);
+
+  loadProgram(dsp);
+  CHECK(dsp.verifyProgram(PROGRAM_CRC32, PROGRAM_SIZE) == true);
+
+  // Right after a reset
+  mockReset();
+  loadProgram(dsp, true);
+  CHECK(dsp.verifyProgram(PROGRAM_CRC32, PROGRAM_SIZE) == true);
+
+  mockGarbage();
+  CHECK(loadCompressedProgram(dsp) == true);
+  CHECK(dsp.verifyProgram(PROGRAM_CRC32, PROGRAM_SIZE) == true);
+
+  // A single changed bit in the last program word is caught
+  mock.programRAM[0x03FF][4] ^= 0x01;
+  CHECK(dsp.verifyProgram(PROGRAM_CRC32, PROGRAM_SIZE) == false);
+}
+
+
+int main()
+{
+  testSelfbootMatchesArrays(false);
+  testSelfbootMatchesArrays(true);
+  testVerifyProgram();
+
+  if(failures != 0)
+    printf("%d check(s) failed\n", failures);
+  return failures != 0;
+}
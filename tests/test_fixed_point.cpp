@@ -0,0 +1,103 @@
+/*
+ * Checks the 32-bit products of DSPFixedPoint against 64-bit references, so the
+ * partial product arithmetic used on AVR rounds and saturates like a plain multiply.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "DSPFixedPoint.h"
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { if(!(condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); failures++; } } while(0)
+
+static uint32_t random32()
+{
+  return (uint32_t)rand() << 17 ^ (uint32_t)rand() << 2 ^ (uint32_t)rand();
+}
+
+
+static void testMulShift()
+{
+  const uint32_t edges[] = { 0, 1, 2, 0x7FFF, 0x8000, 0xFFFF, 0x10000, 0x7FFFFFFF, 0x80000000, 0xFFFFFFFF };
+  for(uint8_t shift = 1; shift < 64; shift++)
+  {
+    for(uint32_t a : edges)
+      for(uint32_t b : edges)
+      {
+        unsigned __int128 product = (unsigned __int128)a * b;
+        unsigned __int128 expected = (product + ((unsigned __int128)1 << (shift - 1))) >> shift;
+        CHECK(dspFixedMulShift(a, b, shift) == (expected > 0xFFFFFFFFU ? 0xFFFFFFFFU : (uint32_t)expected));
+      }
+
+    for(int i = 0; i < 2000; i++)
+    {
+      uint32_t a = random32() >> (rand() % 32);
+      uint32_t b = random32() >> (rand() % 32);
+      unsigned __int128 product = (unsigned __int128)a * b;
+      unsigned __int128 expected = (product + ((unsigned __int128)1 << (shift - 1))) >> shift;
+      CHECK(dspFixedMulShift(a, b, shift) == (expected > 0xFFFFFFFFU ? 0xFFFFFFFFU : (uint32_t)expected));
+    }
+  }
+}
+
+
+static void testMul()
+{
+  CHECK(dspFixedMul(FIXED_ONE, FIXED_ONE) == FIXED_ONE);
+  CHECK(dspFixedMul(-FIXED_ONE, FIXED_ONE / 2) == -FIXED_ONE / 2);
+  CHECK(dspFixedMul(FIXED_MAX, FIXED_MAX) == FIXED_MAX);
+  CHECK(dspFixedMul(FIXED_MIN, FIXED_MAX) == FIXED_MIN);
+  CHECK(dspFixedMul(FIXED_MIN, FIXED_MIN) == FIXED_MAX);
+
+  for(int i = 0; i < 100000; i++)
+  {
+    int32_t a = (int32_t)random32() >> (rand() % 16);
+    int32_t b = (int32_t)random32() >> (rand() % 16);
+    int64_t product = (int64_t)a * b;
+    int64_t rounded = ((product < 0 ? -product : product) + (FIXED_ONE >> 1)) >> FIXED_FRACTION_BITS;
+    int64_t expected = product < 0 ? -rounded : rounded;
+    if(expected > FIXED_MAX)
+      expected = FIXED_MAX;
+    if(expected < FIXED_MIN)
+      expected = FIXED_MIN;
+    CHECK(dspFixedMul(a, b) == expected);
+  }
+}
+
+
+static void testDivAndSqrt()
+{
+  for(int i = 0; i < 100000; i++)
+  {
+    int32_t a = (int32_t)random32() >> (rand() % 24 + 4);
+    int32_t b = (int32_t)random32() >> (rand() % 24 + 4);
+    if(b == 0)
+      continue;
+    double expected = (double)a / b;
+    if(expected > -127 && expected < 127)
+    {
+      // A few LSBs, relative for large quotients
+      double error = dspFixedToFloat(dspFixedDiv(a, b)) - expected;
+      double limit = 2.0 / FIXED_ONE + (expected < 0 ? -expected : expected) * 1e-6;
+      CHECK(error > -limit && error < limit);
+    }
+
+    int32_t value = a < 0 ? -a : a;
+    double root = dspFixedToFloat(dspFixedSqrt(value)) * dspFixedToFloat(dspFixedSqrt(value));
+    CHECK(root - dspFixedToFloat(value) < 1e-5 && dspFixedToFloat(value) - root < 1e-5);
+  }
+}
+
+
+int main()
+{
+  testMulShift();
+  testMul();
+  testDivAndSqrt();
+
+  if(failures != 0)
+    printf("%d check(s) failed\n", failures);
+  return failures != 0;
+}
@@ -0,0 +1,173 @@
+/*
+ * Runs DSPLinuxI2CTransport against a mock ioctl and checks the I2C_RDWR
+ * messages it issues: address, flags and payload of every message.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include "DSPLinuxI2CTransport.h"
+
+#define MOCK_FD 42
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { if(!(condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); failures++; } } while(0)
+
+// Copy of the last I2C_RDWR request, the transport's buffers are gone after the call
+struct mockMessage
+{
+  uint16_t addr;
+  uint16_t flags;
+  uint16_t len;
+  uint8_t buf[64];
+};
+
+static int mockCalls;
+static int mockFd;
+static unsigned long mockRequest;
+static uint32_t mockCount;
+static mockMessage mockMessages[2];
+static int mockErrno; // errno to fail with, 0 to succeed
+
+static int mockIoctl(int fd, unsigned long request, void *argument)
+{
+  struct i2c_rdwr_ioctl_data *data = (struct i2c_rdwr_ioctl_data *)argument;
+
+  mockCalls++;
+  mockFd = fd;
+  mockRequest = request;
+  mockCount = data->nmsgs;
+  for(uint32_t i = 0; i < data->nmsgs && i < 2; i++)
+  {
+    mockMessages[i].addr = data->msgs[i].addr;
+    mockMessages[i].flags = data->msgs[i].flags;
+    mockMessages[i].len = data->msgs[i].len;
+
+    // Read messages get a known pattern, write messages are recorded
+    for(uint16_t j = 0; j < data->msgs[i].len && j < sizeof(mockMessages[i].buf); j++)
+    {
+      if(data->msgs[i].flags & I2C_M_RD)
+        data->msgs[i].buf[j] = 0xA0 + j;
+      else
+        mockMessages[i].buf[j] = data->msgs[i].buf[j];
+    }
+  }
+
+  if(mockErrno != 0)
+  {
+    errno = mockErrno;
+    return -1;
+  }
+  return data->nmsgs;
+}
+
+static void mockReset(int error = 0)
+{
+  mockCalls = 0;
+  mockFd = -1;
+  mockRequest = 0;
+  mockCount = 0;
+  memset(mockMessages, 0, sizeof(mockMessages));
+  mockErrno = error;
+}
+
+
+static void testWrite()
+{
+  DSPLinuxI2CTransport transport(MOCK_FD, mockIoctl);
+  const uint8_t data[] = { 0x00, 0x80, 0x00, 0x00, 0x01 };
+
+  mockReset();
+  CHECK(transport.write(0x34, 0x0812, data, sizeof(data)) == 0);
+  CHECK(mockCalls == 1);
+  CHECK(mockFd == MOCK_FD);
+  CHECK(mockRequest == I2C_RDWR);
+  CHECK(mockCount == 1);
+
+  // One message: sub address high, low, then the data
+  CHECK(mockMessages[0].addr == 0x34);
+  CHECK(mockMessages[0].flags == 0);
+  CHECK(mockMessages[0].len == 2 + sizeof(data));
+  CHECK(mockMessages[0].buf[0] == 0x08);
+  CHECK(mockMessages[0].buf[1] == 0x12);
+  CHECK(memcmp(&mockMessages[0].buf[2], data, sizeof(data)) == 0);
+}
+
+
+static void testWriteRead()
+{
+  DSPLinuxI2CTransport transport(MOCK_FD, mockIoctl);
+  uint8_t data[4] = { 0 };
+
+  mockReset();
+  CHECK(transport.writeRead(0x50, 0x1FFE, data, sizeof(data)) == 0);
+  CHECK(mockCalls == 1);
+  CHECK(mockRequest == I2C_RDWR);
+  CHECK(mockCount == 2);
+
+  // Sub address write, then a read after a repeated start, in the same ioctl
+  CHECK(mockMessages[0].addr == 0x50);
+  CHECK(mockMessages[0].flags == 0);
+  CHECK(mockMessages[0].len == 2);
+  CHECK(mockMessages[0].buf[0] == 0x1F);
+  CHECK(mockMessages[0].buf[1] == 0xFE);
+  CHECK(mockMessages[1].addr == 0x50);
+  CHECK(mockMessages[1].flags == I2C_M_RD);
+  CHECK(mockMessages[1].len == sizeof(data));
+
+  // The read data ends up in the caller's buffer
+  for(uint8_t i = 0; i < sizeof(data); i++)
+    CHECK(data[i] == 0xA0 + i);
+}
+
+
+static void testPing()
+{
+  DSPLinuxI2CTransport transport(MOCK_FD, mockIoctl);
+
+  mockReset();
+  CHECK(transport.ping(0x34) == 0);
+  CHECK(mockCount == 1);
+  CHECK(mockMessages[0].addr == 0x34);
+  CHECK(mockMessages[0].flags == 0);
+  CHECK(mockMessages[0].len == 0);
+}
+
+
+static void testErrors()
+{
+  DSPLinuxI2CTransport transport(MOCK_FD, mockIoctl);
+  uint8_t data[2] = { 0x12, 0x34 };
+
+  // Missing ack is reported like Wire does, both errno values the i2c core uses
+  mockReset(ENXIO);
+  CHECK(transport.write(0x34, 0x0000, data, sizeof(data)) == 2);
+  mockReset(EREMOTEIO);
+  CHECK(transport.writeRead(0x34, 0x0000, data, sizeof(data)) == 2);
+
+  mockReset(EIO);
+  CHECK(transport.write(0x34, 0x0000, data, sizeof(data)) == 4);
+
+  // Oversized writes are refused without touching the bus
+  static uint8_t large[SIGMADSP_LINUX_I2C_CHUNK_SIZE + 1];
+  mockReset();
+  CHECK(transport.write(0x34, 0x0000, large, sizeof(large)) == 4);
+  CHECK(mockCalls == 0);
+}
+
+
+int main()
+{
+  testWrite();
+  testWriteRead();
+  testPing();
+  testErrors();
+
+  if(failures != 0)
+    printf("%d check(s) failed\n", failures);
+  return failures != 0;
+}
@@ -0,0 +1,271 @@
+/*
+ * Drives SigmaDSP on the host through DSPLinuxI2CTransport and DSPSpidevTransport,
+ * with a mock ADAU1701 behind the mocked ioctl, and checks what ends up in the DSP's memory.
+ */
+
+#include <math.h>
+#include "mock_adau1701.h"
+#include "SigmaDSP.h"
+#include "DSPShadowRAM.h"
+#include "SigmaDSPGroup.h"
+#include "DSPStats.h"
+
+
+static void testBoot()
+{
+  DSPLinuxI2CTransport transport(MOCK_FD, mockIoctl);
+  SigmaDSP dsp(transport, MOCK_DSP_ADDRESS, 48000.00f);
+
+  mockReset();
+  dsp.begin();
+  CHECK(dsp.ping() == 0);
+  CHECK(dsp.bootStatus() == BootIdle);
+
+  // Core running once the CR bit is set
+  mock.registers[0x1C][1] = 0x1C;
+  CHECK(dsp.bootStatus() == BootRunning);
+  CHECK(dsp.waitForBoot(10) == true);
+
+  // A DSP on another address doesn't answer
+  SigmaDSP absent(transport, MOCK_DSP_ADDRESS + 1, 48000.00f);
+  CHECK(absent.ping() != 0);
+  CHECK(absent.bootStatus() == BootBusy);
+}
+
+
+static void testSpidevBegin()
+{
+  DSPSpidevTransport transport(MOCK_FD, mockSpiIoctl, 4000000);
+  SigmaDSP dsp(transport, MOCK_DSP_ADDRESS, 48000.00f);
+
+  mockReset();
+  dsp.begin();
+  CHECK(mock.spiMode == SPI_MODE_3);
+  CHECK(mock.spiClock == 4000000);
+  CHECK(mock.latchToggles == 3); // Moves the control port over to SPI mode
+  CHECK(mock.writes == 0);
+  CHECK(dsp.ping() == 0);
+
+  dsp.i2cClock(8000000);
+  CHECK(mock.spiClock == 8000000);
+}
+
+
+static void testSafeload(DSPTransport &transport)
+{
+  SigmaDSP dsp(transport, MOCK_DSP_ADDRESS, 48000.00f);
+
+  mockReset();
+  dsp.begin();
+
+  // 5.23 fixed point words land in parameter RAM through the safeload registers
+  dsp.mute(0x0010, true);
+  CHECK(mockParameter(0x0010) == 0x800000);
+  dsp.mute(0x0010, false);
+  CHECK(mockParameter(0x0010) == 0);
+
+  dsp.volume(0x0020, -6);
+  CHECK(fabs(mockParameter(0x0020) - pow(10, -6.0 / 20) * 0x800000) <= 2);
+
+  // Stereo gain, one word per channel
+  dsp.gain(0x0030, 0.5f, 2);
+  CHECK(mockParameter(0x0030) == 0x400000);
+  CHECK(mockParameter(0x0031) == 0x400000);
+  CHECK(mockParameter(0x0032) == 0);
+
+  // A batch of updates goes out as one safeload group
+  dsp.beginUpdate();
+  for(uint16_t i = 0; i < 5; i++)
+    dsp.dcSource(0x0040 + i, (uint32_t)(i + 1) << 20);
+  dsp.commit();
+  for(uint16_t i = 0; i < 5; i++)
+    CHECK(mockParameter(0x0040 + i) == (int32_t)(i + 1) << 20);
+}
+
+
+static void testRegisters(DSPTransport &transport)
+{
+  SigmaDSP dsp(transport, MOCK_DSP_ADDRESS, 48000.00f);
+
+  mockReset();
+  dsp.begin();
+
+  // Hardware registers round trip through the transport
+  const uint8_t serialOut[2] = { 0x08, 0x00 };
+  dsp.writeRegister(SerialOutRegister1, sizeof(serialOut), serialOut);
+  CHECK(dsp.readRegister(SerialOutRegister1, 2) == 0x0800);
+
+  // Readback writes the capture selection and reads from the same address,
+  // which the mock answers with what was written
+  CHECK(dsp.readBack(0x0100, 0x0123, 2) == 0x0123);
+
+  // Parameter blocks are written in bursts
+  const int32_t block[3] = { 0x00100000, -0x00100000, 0x007FFFFF };
+  dsp.writeParameterBlock(0x0200, block, 3);
+  for(uint16_t i = 0; i < 3; i++)
+    CHECK(mockParameter(0x0200 + i) == block[i]);
+}
+
+
+static void testShadowWriteError(DSPTransport &transport)
+{
+  SigmaDSP dsp(transport, MOCK_DSP_ADDRESS, 48000.00f);
+  DSPShadowRAM<16> shadow;
+
+  mockReset();
+  dsp.begin();
+  dsp.attachShadow(shadow);
+
+  // A failed safeload must not leave the word marked as written
+  mock.failAddress = SafeloadData0;
+  dsp.dcSource(0x0010, (uint32_t)0x123456);
+  CHECK(mockParameter(0x0010) == 0);
+  mock.failAddress = 0xFFFF;
+  dsp.dcSource(0x0010, (uint32_t)0x123456);
+  CHECK(mockParameter(0x0010) == 0x123456);
+
+  // Neither must a failed transfer trigger
+  mock.failAddress = CoreRegister;
+  dsp.dcSource(0x0011, (uint32_t)0x654321);
+  CHECK(mockParameter(0x0011) == 0);
+  mock.failAddress = 0xFFFF;
+  dsp.dcSource(0x0011, (uint32_t)0x654321);
+  CHECK(mockParameter(0x0011) == 0x654321);
+
+  // Same for a direct burst write of a parameter block
+  const int32_t block[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+  dsp.setBulkPolicy(BulkDirect, 8);
+  mock.failAddress = 0x0100;
+  dsp.writeParameterBlock(0x0100, block, 8);
+  CHECK(mockParameter(0x0100) == 0);
+  mock.failAddress = 0xFFFF;
+  dsp.writeParameterBlock(0x0100, block, 8);
+  for(uint16_t i = 0; i < 8; i++)
+    CHECK(mockParameter(0x0100 + i) == block[i]);
+
+  // Words that did get there are still left out
+  uint32_t writes = mock.writes;
+  dsp.dcSource(0x0010, (uint32_t)0x123456);
+  dsp.writeParameterBlock(0x0100, block, 8);
+  CHECK(mock.writes == writes);
+}
+
+
+// Takes any DSP object, like application code that doesn't know about groups
+static dspBootStatus startUp(SigmaDSP &dsp)
+{
+  dsp.begin();
+  if(dsp.ping() != 0)
+    return BootBusy;
+  return dsp.bootStatus();
+}
+
+
+static void testGroup()
+{
+  DSPLinuxI2CTransport transport(MOCK_FD, mockIoctl);
+  SigmaDSP first(transport, MOCK_DSP_ADDRESS, 48000.00f);
+  SigmaDSP second(transport, MOCK_DSP_ADDRESS, 48000.00f);
+  SigmaDSP absent(transport, MOCK_DSP_ADDRESS + 1, 48000.00f);
+
+  // Called through SigmaDSP, the group still asks every member
+  SigmaDSP *present[] = { &first, &second };
+  SigmaDSPGroup group(present, 2);
+  mockReset();
+  mock.registers[0x1C][1] = 0x1C;
+  CHECK(startUp(group) == BootRunning);
+  CHECK(((SigmaDSP &)group).waitForBoot(10) == true);
+
+  SigmaDSP *partial[] = { &first, &absent };
+  SigmaDSPGroup broken(partial, 2);
+  CHECK(startUp(broken) == BootBusy);
+  CHECK(((SigmaDSP &)broken).ping() != 0);
+  CHECK(((SigmaDSP &)broken).waitForBoot(10) == false);
+
+  // Every member gets its own write
+  uint32_t writes = mock.writes;
+  group.dcSource(0x0010, (uint32_t)0x123456);
+  CHECK(mockParameter(0x0010) == 0x123456);
+  CHECK(mock.writes == writes + 2 * 3); // Safeload data, address and IST, per member
+}
+
+
+static void testStats()
+{
+  DSPLinuxI2CTransport transport(MOCK_FD, mockIoctl);
+  SigmaDSP dsp(transport, MOCK_DSP_ADDRESS, 48000.00f);
+  DSPStats stats;
+
+  mockReset();
+  dsp.begin();
+  dsp.attachStats(stats);
+
+  // One word: 5 safeload data bytes, a 2-byte address and the 2-byte core register
+  dsp.dcSource(0x0010, (uint32_t)0x123456);
+  const dspStatsEntry_t &dcSource = stats.function(StatsDcSource);
+  CHECK(dcSource.calls == 1);
+  CHECK(dcSource.transactions == 3);
+  CHECK(dcSource.bytesSent == 5 + 2 + 2);
+  CHECK(dcSource.bytesReceived == 0);
+  CHECK(dcSource.safeloads == 1);
+
+  // Readback writes the 2-byte capture selection and reads the value
+  dsp.readBack(0x0100, 0x0123, 3);
+  const dspStatsEntry_t &readBack = stats.function(StatsReadBack);
+  CHECK(readBack.bytesSent == 2);
+  CHECK(readBack.bytesReceived == 3);
+
+  CHECK(stats.totals().bytesSent == dcSource.bytesSent + readBack.bytesSent);
+  CHECK(stats.totals().bytesReceived == dcSource.bytesReceived + readBack.bytesReceived);
+}
+
+
+static void testGraphicEQTable()
+{
+  DSPLinuxI2CTransport transport(MOCK_FD, mockIoctl);
+  SigmaDSP dsp(transport, MOCK_DSP_ADDRESS, 48000.00f);
+
+  // 2 bands x 1 step
+  static const int32_t table[2 * 1 * 5] =
+  {
+    0x100001, 0x100002, 0x100003, 0x100004, 0x100005,
+    0x200001, 0x200002, 0x200003, 0x200004, 0x200005,
+  };
+
+  mockReset();
+  dsp.begin();
+
+  // A table designed for another sample rate is refused and nothing is written
+  uint32_t writes = mock.writes;
+  CHECK(dsp.setGraphicEQTable(table, 2, 1, 44100.00f) == false);
+  dsp.graphicEQ(0x0020, 1, 0);
+  CHECK(mock.writes == writes);
+
+  CHECK(dsp.setGraphicEQTable(table, 2, 1, 48000.00f) == true);
+  dsp.graphicEQ(0x0020, 1, 0);
+  for(uint8_t i = 0; i < 5; i++)
+    CHECK(mockParameter(0x0025 + i) == table[5 + i]);
+}
+
+
+int main()
+{
+  DSPLinuxI2CTransport i2c(MOCK_FD, mockIoctl);
+  DSPSpidevTransport spi(MOCK_FD, mockSpiIoctl);
+
+  testBoot();
+  testSpidevBegin();
+  testSafeload(i2c);
+  testSafeload(spi);
+  testRegisters(i2c);
+  testRegisters(spi);
+  testShadowWriteError(i2c);
+  testShadowWriteError(spi);
+  testGroup();
+  testStats();
+  testGraphicEQTable();
+
+  if(failures != 0)
+    printf("%d check(s) failed\n", failures);
+  return failures != 0;
+}
@@ -0,0 +1,87 @@
+/*
+ * Runs DSPQueueWorker against the mock ADAU1701 and checks that queued updates
+ * reach the DSP from the worker thread, and that stop() sends what's left.
+ */
+
+#include <chrono>
+#include <thread>
+#include "mock_adau1701.h"
+#include "DSPQueueWorker.h"
+#include "DSPUpdateQueue.h"
+
+
+// Waits for a parameter RAM word to take a value, holding the lock while looking
+static bool waitForParameter(DSPQueueWorker &worker, uint16_t address, int32_t value)
+{
+  for(uint16_t i = 0; i < 1000; i++)
+  {
+    {
+      std::lock_guard<std::mutex> lock(worker.mutex());
+      if(mockParameter(address) == value)
+        return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return false;
+}
+
+
+static void testWorker()
+{
+  DSPLinuxI2CTransport transport(MOCK_FD, mockIoctl);
+  SigmaDSP dsp(transport, MOCK_DSP_ADDRESS, 48000.00f);
+  DSPUpdateQueue<4> queue;
+  DSPQueueWorker worker(dsp);
+
+  mockReset();
+  dsp.begin();
+  dsp.attachQueue(queue);
+
+  worker.start();
+  CHECK(worker.running() == true);
+
+  // Updates only get queued by the caller, the worker sends them
+  for(int32_t i = 1; i <= 50; i++)
+  {
+    {
+      std::lock_guard<std::mutex> lock(worker.mutex());
+      dsp.dcSource(0x0010, (uint32_t)i << 16);
+      dsp.dcSource(0x0020, (uint32_t)i << 12);
+    }
+    worker.notify();
+  }
+  CHECK(waitForParameter(worker, 0x0010, 50 << 16));
+  CHECK(waitForParameter(worker, 0x0020, 50 << 12));
+
+  // Whatever is still queued goes out when the worker stops
+  worker.stop();
+  CHECK(worker.running() == false);
+  {
+    std::lock_guard<std::mutex> lock(worker.mutex());
+    dsp.dcSource(0x0030, (uint32_t)0x123456);
+  }
+  CHECK(queue.pending() == 1);
+  worker.stop();
+  CHECK(queue.pending() == 0);
+  CHECK(mockParameter(0x0030) == 0x123456);
+
+  // And it can be started again
+  worker.start();
+  {
+    std::lock_guard<std::mutex> lock(worker.mutex());
+    dsp.dcSource(0x0040, (uint32_t)0x654321);
+  }
+  worker.notify();
+  CHECK(waitForParameter(worker, 0x0040, 0x654321));
+  worker.stop();
+}
+
+
+int main()
+{
+  testWorker();
+
+  if(failures != 0)
+    printf("%d check(s) failed\n", failures);
+  return failures != 0;
+}
@@ -0,0 +1,183 @@
+/*
+ * Checks that DSPQueue keeps the latest value of every parameter word,
+ * also when commit() packs words of several DSP blocks into one safeload group.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "DSPUpdateQueue.h"
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { if(!(condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); failures++; } } while(0)
+
+// Safeload group as SigmaDSP stages it: five 5-byte words, then five 16-bit addresses
+struct group
+{
+  uint8_t count;
+  uint8_t buffer[5 * 5 + 5 * 2];
+};
+
+static group makeGroup(const uint16_t *addresses, uint8_t count, uint8_t value)
+{
+  group g;
+  memset(&g, 0, sizeof(g));
+  g.count = count;
+  for(uint8_t i = 0; i < count; i++)
+  {
+    g.buffer[i * 5 + 4] = value;
+    g.buffer[25 + i * 2] = addresses[i] >> 8;
+    g.buffer[25 + i * 2 + 1] = addresses[i] & 0xFF;
+  }
+  return g;
+}
+
+static bool push(DSPQueue &queue, const uint16_t *addresses, uint8_t count, uint8_t value)
+{
+  group g = makeGroup(addresses, count, value);
+  return queue.push(g.buffer, g.count);
+}
+
+// Pops the oldest group and checks its addresses and values
+static void expectGroup(DSPQueue &queue, const uint16_t *addresses, const uint8_t *values, uint8_t count)
+{
+  group g;
+  CHECK(queue.pop(g.buffer, g.count));
+  CHECK(g.count == count);
+  for(uint8_t i = 0; i < count && i < g.count; i++)
+  {
+    CHECK(((uint16_t)g.buffer[25 + i * 2] << 8 | g.buffer[25 + i * 2 + 1]) == addresses[i]);
+    CHECK(g.buffer[i * 5 + 4] == values[i]);
+  }
+}
+
+
+// commit() packed a volume word and the first EQ words together, the rest of the EQ follows.
+// A later commit() of volume and mute must only take the volume word out of the first group
+static void testOverlappingPackedGroups()
+{
+  DSPUpdateQueue<4> queue;
+  const uint16_t volumeAndEQ[] = { 10, 20, 21, 22 };
+  const uint16_t restOfEQ[] = { 23, 24 };
+  const uint16_t volumeAndMute[] = { 10, 30 };
+
+  CHECK(push(queue, volumeAndEQ, 4, 1));
+  CHECK(push(queue, restOfEQ, 2, 1));
+  CHECK(push(queue, volumeAndMute, 2, 2));
+  CHECK(queue.pending() == 3);
+
+  const uint16_t eq[] = { 20, 21, 22 };
+  const uint8_t eqValues[] = { 1, 1, 1 };
+  expectGroup(queue, eq, eqValues, 3);
+  const uint8_t restValues[] = { 1, 1 };
+  expectGroup(queue, restOfEQ, restValues, 2);
+  const uint8_t latest[] = { 2, 2 };
+  expectGroup(queue, volumeAndMute, latest, 2);
+  CHECK(queue.pending() == 0);
+}
+
+
+// Two packed groups that overlap in one word each
+static void testTwoOverlappingGroups()
+{
+  DSPUpdateQueue<4> queue;
+  const uint16_t first[] = { 10, 11, 12 };
+  const uint16_t second[] = { 12, 13 };
+
+  CHECK(push(queue, first, 3, 1));
+  CHECK(push(queue, second, 2, 2));
+
+  const uint16_t firstLeft[] = { 10, 11 };
+  const uint8_t firstValues[] = { 1, 1 };
+  expectGroup(queue, firstLeft, firstValues, 2);
+  const uint8_t secondValues[] = { 2, 2 };
+  expectGroup(queue, second, secondValues, 2);
+  CHECK(queue.pending() == 0);
+}
+
+
+// A group for exactly the same words replaces the stale one and keeps its place
+static void testSameWordsReplacedInPlace()
+{
+  DSPUpdateQueue<4> queue;
+  const uint16_t eq[] = { 20, 21, 22, 23, 24 };
+  const uint16_t volume[] = { 10 };
+
+  CHECK(push(queue, eq, 5, 1));
+  CHECK(push(queue, volume, 1, 1));
+  CHECK(push(queue, eq, 5, 2));
+  CHECK(queue.pending() == 2);
+
+  const uint8_t eqValues[] = { 2, 2, 2, 2, 2 };
+  expectGroup(queue, eq, eqValues, 5);
+  const uint8_t volumeValues[] = { 1 };
+  expectGroup(queue, volume, volumeValues, 1);
+}
+
+
+// Groups whose words are all superseded are dropped, which also makes room in a full queue
+static void testEmptiedGroupsAreDropped()
+{
+  DSPUpdateQueue<2> queue;
+  const uint16_t volume[] = { 10 };
+  const uint16_t eq[] = { 20, 21 };
+  const uint16_t mute[] = { 30 };
+  const uint16_t volumeAndMute[] = { 10, 30 };
+
+  CHECK(push(queue, volume, 1, 1));
+  CHECK(push(queue, eq, 2, 1));
+
+  // Full and nothing to replace, the queue is left as it was
+  CHECK(push(queue, mute, 1, 1) == false);
+  CHECK(queue.pending() == 2);
+
+  CHECK(push(queue, volumeAndMute, 2, 2));
+  CHECK(queue.pending() == 2);
+
+  const uint8_t eqValues[] = { 1, 1 };
+  expectGroup(queue, eq, eqValues, 2);
+  const uint8_t latest[] = { 2, 2 };
+  expectGroup(queue, volumeAndMute, latest, 2);
+}
+
+
+// Removing groups in the middle of a wrapped ring buffer keeps the order
+static void testWrappedRing()
+{
+  DSPUpdateQueue<3> queue;
+  const uint16_t a[] = { 1 };
+  const uint16_t b[] = { 2 };
+  const uint16_t c[] = { 3 };
+  const uint16_t d[] = { 4 };
+  const uint16_t bAndE[] = { 2, 5 };
+  group g;
+
+  CHECK(push(queue, a, 1, 1));
+  CHECK(push(queue, b, 1, 1));
+  CHECK(queue.pop(g.buffer, g.count));
+  CHECK(push(queue, c, 1, 1));
+  CHECK(push(queue, d, 1, 1)); // Wraps around
+  CHECK(push(queue, bAndE, 2, 2));
+
+  const uint8_t one[] = { 1 };
+  expectGroup(queue, c, one, 1);
+  expectGroup(queue, d, one, 1);
+  const uint8_t two[] = { 2, 2 };
+  expectGroup(queue, bAndE, two, 2);
+  CHECK(queue.pending() == 0);
+}
+
+
+int main()
+{
+  testOverlappingPackedGroups();
+  testTwoOverlappingGroups();
+  testSameWordsReplacedInPlace();
+  testEmptiedGroupsAreDropped();
+  testWrappedRing();
+
+  if(failures != 0)
+    printf("%d check(s) failed\n", failures);
+  return failures != 0;
+}